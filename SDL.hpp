@@ -2,9 +2,57 @@
 
 #include <SDL3/SDL.h>
 
+#include <bit>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
+#include <optional>
 #include <source_location>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Selects how the wrappers report a failing SDL call. Define SDL_HPP_ERROR_POLICY
+// to one of these before including SDL.hpp; the default is throwing.
+//
+// SDL_HPP_ERROR_THROW: Throw a std::runtime_error.
+// SDL_HPP_ERROR_EXPECTED: Return a std::expected<T, sdl::Error> (C++23).
+// SDL_HPP_ERROR_CALLBACK: Call the function set by sdl::SetErrorCallback and return
+//   false/nullptr as the plain SDL function would. Neither allocates nor unwinds.
+// SDL_HPP_ERROR_ABORT: Log the error and abort.
+
+#define SDL_HPP_ERROR_THROW 0
+#define SDL_HPP_ERROR_EXPECTED 1
+#define SDL_HPP_ERROR_CALLBACK 2
+#define SDL_HPP_ERROR_ABORT 3
+
+#ifndef SDL_HPP_ERROR_POLICY
+#define SDL_HPP_ERROR_POLICY SDL_HPP_ERROR_THROW
+#endif
+
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_EXPECTED
+#include <expected>
+#endif
+
+// Define SDL_HPP_SOURCE_LOCATION to 0 to not capture the caller's source location
+// in the checked wrappers. Their location argument then is an empty struct that
+// takes no register, and errors report an empty location.
+
+#ifndef SDL_HPP_SOURCE_LOCATION
+#define SDL_HPP_SOURCE_LOCATION 1
+#endif
+
+// Keeps the error reporting out of line and out of the way of the wrappers' fast path.
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SDL_HPP_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define SDL_HPP_COLD __declspec(noinline)
+#else
+#define SDL_HPP_COLD
+#endif
 
 // Avoid endless recursion
 
@@ -26,18 +74,134 @@
 namespace sdl
 {
 
-inline void SDLThrow(std::source_location location)
+#if SDL_HPP_SOURCE_LOCATION
+using Location = std::source_location;
+#else
+// Empty stand-in for std::source_location, which costs nothing to pass.
+struct Location
+{
+    static constexpr Location current()
+    {
+        return Location{};
+    }
+
+    constexpr const char *file_name() const
+    {
+        return "";
+    }
+
+    constexpr const char *function_name() const
+    {
+        return "";
+    }
+
+    constexpr unsigned line() const
+    {
+        return 0;
+    }
+
+    constexpr unsigned column() const
+    {
+        return 0;
+    }
+};
+#endif
+
+// A failed SDL call. The message is only looked up (via SDL_GetError) when asked for,
+// so it is only valid until the next SDL call on the same thread fails.
+struct Error
+{
+    Location location;
+
+    const char *Message() const
+    {
+        const char *pErrorMessage = SDL_GetError();
+        if (!pErrorMessage || pErrorMessage[0] == '\0')
+        {
+            pErrorMessage = "(unknown)";
+        }
+        return pErrorMessage;
+    }
+
+    int Format(char *buffer, size_t size) const
+    {
+        return SDL_snprintf(buffer, size, "SDL error: %s", Message());
+    }
+};
+
+[[noreturn]] SDL_HPP_COLD inline void SDLThrow(Location location)
 {
     constexpr size_t BufferSize = 256;
     char error[BufferSize];
-    const char *pErrorMessage = SDL_GetError();
-    if (!pErrorMessage || pErrorMessage[0] == '\0')
+    Error{location}.Format(error, BufferSize);
+    SDL_Log("%s", error);
+    throw std::runtime_error{error};
+}
+
+[[noreturn]] SDL_HPP_COLD inline void SDLAbort(Location location)
+{
+    SDL_Log("SDL error: %s (%s:%u)", Error{location}.Message(), location.file_name(),
+            static_cast<unsigned>(location.line()));
+    std::abort();
+}
+
+using ErrorCallback = void (*)(const Error &error);
+
+inline ErrorCallback errorCallback = nullptr;
+
+inline void SetErrorCallback(ErrorCallback callback)
+{
+    errorCallback = callback;
+}
+
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_EXPECTED
+template <class T> using Result = std::expected<T, Error>;
+#elif SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_CALLBACK
+// As the plain SDL functions do, the checked bool functions return whether they succeeded.
+template <class T> struct CallbackResult
+{
+    using Type = T;
+};
+
+template <> struct CallbackResult<void>
+{
+    using Type = bool;
+};
+
+template <class T> using Result = typename CallbackResult<T>::Type;
+#else
+template <class T> using Result = T;
+#endif
+
+inline Result<void> Success()
+{
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_CALLBACK
+    return true;
+#else
+    return Result<void>();
+#endif
+}
+
+template <class T> SDL_HPP_COLD Result<T> Fail(Location location)
+{
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_EXPECTED
+    return std::unexpected{Error{location}};
+#elif SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_CALLBACK
+    if (errorCallback)
     {
-        pErrorMessage = "(unknown)";
+        errorCallback(Error{location});
     }
-    SDL_snprintf(error, BufferSize, "SDL error: %s", pErrorMessage);
-    SDL_Log(error);
-    throw std::runtime_error{error};
+    else
+    {
+        SDL_Log("SDL error: %s", Error{location}.Message());
+    }
+    // false for Result<void>, nullptr or zero otherwise.
+    return Result<T>();
+#elif SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_ABORT
+    SDLAbort(location);
+#else
+    SDLThrow(location);
+#endif
 }
 
 struct FreeVoid
@@ -62,26 +226,175 @@ template <class T> struct Destroyer
     }
 };
 
+// SDL_WaitThread also takes a status pointer, so the generator doesn't pick it up.
+// An sdl::Thread joins the thread when going out of scope.
+template <> inline void Destroy<SDL_Thread>(SDL_Thread *thread)
+{
+    SDL_WaitThread(thread, nullptr);
+}
+
+using Thread = std::unique_ptr<SDL_Thread, Destroyer<SDL_Thread>>;
+
+// Specialized for the types having an SDL_Unlock* function, so e.g. an sdl::LockedTexture
+// created after a successful sdl::LockTexture unlocks the texture when going out of scope.
+template <class T> void Unlock(T *object)
+{
+}
+
+template <class T> struct Unlocker
+{
+    void operator()(T *object)
+    {
+        Unlock<T>(object);
+    }
+};
+
+// SDL_SpinLock is an int, so its guard gets a deleter of its own rather than an Unlock<int>.
+struct SpinLockUnlocker
+{
+    void operator()(SDL_SpinLock *lock)
+    {
+        SDL_UnlockSpinlock(lock);
+    }
+};
+
+using LockedSpinLock = std::unique_ptr<SDL_SpinLock, SpinLockUnlocker>;
+
+// Masks, shifts and bits of the channels of a packed pixel format, known at compile time.
+template <int bitsPerPixel, int bytesPerPixel, Uint32 rMask, Uint32 gMask, Uint32 bMask,
+          Uint32 aMask>
+struct PackedPixelFormatTraits
+{
+    static constexpr int BitsPerPixel = bitsPerPixel;
+    static constexpr int BytesPerPixel = bytesPerPixel;
+    static constexpr Uint32 RMask = rMask;
+    static constexpr Uint32 GMask = gMask;
+    static constexpr Uint32 BMask = bMask;
+    static constexpr Uint32 AMask = aMask;
+    static constexpr int RShift = rMask ? std::countr_zero(rMask) : 0;
+    static constexpr int GShift = gMask ? std::countr_zero(gMask) : 0;
+    static constexpr int BShift = bMask ? std::countr_zero(bMask) : 0;
+    static constexpr int AShift = aMask ? std::countr_zero(aMask) : 0;
+    static constexpr int RBits = std::popcount(rMask);
+    static constexpr int GBits = std::popcount(gMask);
+    static constexpr int BBits = std::popcount(bMask);
+    static constexpr int ABits = std::popcount(aMask);
+};
+
+// Specialized from the SDL_PixelFormat enum for the packed formats of up to 8 bits per
+// channel, as a PackedPixelFormatTraits.
+template <SDL_PixelFormat Format> struct PixelFormatTraits;
+
 template <class T> void ReleaseFromDevice(SDL_GPUDevice *device, T *object)
 {
 }
 
 template <class T> struct DeviceOwned
 {
+    DeviceOwned() = default;
     DeviceOwned(SDL_GPUDevice *device, T *object) : m_device{device}, m_object{object} {};
     DeviceOwned(const DeviceOwned &) = delete;
+    DeviceOwned(DeviceOwned &&other) noexcept
+        : m_device{other.m_device}, m_object{other.Detach()} {};
 
     DeviceOwned &operator=(const DeviceOwned &) = delete;
 
+    DeviceOwned &operator=(DeviceOwned &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            m_device = other.m_device;
+            m_object = other.Detach();
+        }
+        return *this;
+    }
+
     ~DeviceOwned()
     {
-        if (m_object)
+        Reset();
+    }
+
+    explicit operator bool() const
+    {
+        return m_object != nullptr;
+    }
+
+    SDL_GPUDevice *Device() const
+    {
+        return m_device;
+    }
+
+    T *Get() const
+    {
+        return m_object;
+    }
+
+    T *Detach()
+    {
+        T *object = m_object;
+        m_object = nullptr;
+        return object;
+    }
+
+    // Releases the currently owned object (if any) and takes ownership of the given one.
+    void Reset(T *object = nullptr)
+    {
+        T *previous = m_object;
+        m_object = object;
+        if (previous)
+        {
+            ReleaseFromDevice(m_device, previous);
+        }
+    }
+
+  private:
+    SDL_GPUDevice *m_device = nullptr;
+    T *m_object = nullptr;
+};
+
+// The default Context for SharedDeviceOwned: One SDL_GPUDevice for the whole application.
+struct GPUDeviceContext
+{
+    static SDL_GPUDevice *Device()
+    {
+        return device;
+    }
+
+    static inline SDL_GPUDevice *device = nullptr;
+};
+
+// Like DeviceOwned, but gets the device from Context::Device() instead of storing it,
+// so a handle is only the size of a pointer.
+template <class T, class Context = GPUDeviceContext> struct SharedDeviceOwned
+{
+    SharedDeviceOwned() = default;
+    explicit SharedDeviceOwned(T *object) : m_object{object} {};
+    SharedDeviceOwned(const SharedDeviceOwned &) = delete;
+    SharedDeviceOwned(SharedDeviceOwned &&other) noexcept : m_object{other.Detach()} {};
+
+    SharedDeviceOwned &operator=(const SharedDeviceOwned &) = delete;
+
+    SharedDeviceOwned &operator=(SharedDeviceOwned &&other) noexcept
+    {
+        if (this != &other)
         {
-            ReleaseFromDevice(m_device, m_object);
+            Reset(other.Detach());
         }
+        return *this;
+    }
+
+    ~SharedDeviceOwned()
+    {
+        Reset();
+    }
+
+    explicit operator bool() const
+    {
+        return m_object != nullptr;
     }
 
-    T *Get()
+    T *Get() const
     {
         return m_object;
     }
@@ -93,19 +406,28 @@ template <class T> struct DeviceOwned
         return object;
     }
 
+    void Reset(T *object = nullptr)
+    {
+        T *previous = m_object;
+        m_object = object;
+        if (previous)
+        {
+            ReleaseFromDevice(Context::Device(), previous);
+        }
+    }
+
   private:
-    SDL_GPUDevice *m_device;
     T *m_object = nullptr;
 };
 
-struct Haptic
+struct HapticEffect
 {
-    Haptic(SDL_Haptic *haptic, int effect) : m_haptic{haptic}, m_effect{effect} {};
-    Haptic(const Haptic &) = delete;
+    HapticEffect(SDL_Haptic *haptic, int effect) : m_haptic{haptic}, m_effect{effect} {};
+    HapticEffect(const HapticEffect &) = delete;
 
-    Haptic &operator=(const Haptic &) = delete;
+    HapticEffect &operator=(const HapticEffect &) = delete;
 
-    ~Haptic()
+    ~HapticEffect()
     {
         if (m_haptic)
         {
@@ -141,6 +463,37 @@ struct Properties
     SDL_PropertiesID m_properties;
 };
 
+struct AudioDevice
+{
+    AudioDevice(SDL_AudioDeviceID device) : m_device{device} {};
+    AudioDevice(const AudioDevice &) = delete;
+
+    AudioDevice &operator=(const AudioDevice &) = delete;
+
+    ~AudioDevice()
+    {
+        if (m_device)
+        {
+            SDL_CloseAudioDevice(m_device);
+        }
+    }
+
+    SDL_AudioDeviceID Get() const
+    {
+        return m_device;
+    }
+
+    SDL_AudioDeviceID Detach()
+    {
+        SDL_AudioDeviceID device = m_device;
+        m_device = 0;
+        return device;
+    }
+
+  private:
+    SDL_AudioDeviceID m_device;
+};
+
 struct CameraSurface
 {
     CameraSurface(SDL_Surface *surface, SDL_Camera *camera)
@@ -170,6 +523,56 @@ struct CameraSurface
     SDL_Camera *m_camera;
 };
 
+template <int Capacity> struct EventBatch
+{
+    static_assert(Capacity > 0);
+
+    // Pumps the event loop, then moves up to Capacity pending events into the batch
+    // with a single SDL_PeepEvents call. A full batch means more events may be waiting.
+    Result<int> Drain(Location location = Location::current())
+    {
+        SDL_PumpEvents();
+        int count = SDL_PeepEvents(m_events, Capacity, SDL_GETEVENT, SDL_EVENT_FIRST,
+                                   SDL_EVENT_LAST);
+        if (count < 0) [[unlikely]]
+        {
+            m_count = 0;
+            return Fail<int>(location);
+        }
+        m_count = count;
+        return m_count;
+    }
+
+    int Size() const
+    {
+        return m_count;
+    }
+
+    bool IsFull() const
+    {
+        return m_count == Capacity;
+    }
+
+    const SDL_Event &operator[](int index) const
+    {
+        return m_events[index];
+    }
+
+    const SDL_Event *begin() const
+    {
+        return m_events;
+    }
+
+    const SDL_Event *end() const
+    {
+        return m_events + m_count;
+    }
+
+  private:
+    SDL_Event m_events[Capacity];
+    int m_count = 0;
+};
+
 template<>
 inline void Destroy<SDL_Environment>(SDL_Environment *env)
 {
@@ -218,6 +621,14 @@ inline void Destroy<SDL_Condition>(SDL_Condition *cond)
 
 using Condition = std::unique_ptr<SDL_Condition, Destroyer<SDL_Condition>>;
 
+template<>
+inline void Destroy<SDL_IOStream>(SDL_IOStream *context)
+{
+    SDL_CloseIO(context);
+}
+
+using IOStream = std::unique_ptr<SDL_IOStream, Destroyer<SDL_IOStream>>;
+
 template<>
 inline void Destroy<SDL_AudioStream>(SDL_AudioStream *stream)
 {
@@ -242,14 +653,46 @@ inline void Destroy<SDL_Surface>(SDL_Surface *surface)
 
 using Surface = std::unique_ptr<SDL_Surface, Destroyer<SDL_Surface>>;
 
+template<>
+inline void Destroy<SDL_Camera>(SDL_Camera *camera)
+{
+    SDL_CloseCamera(camera);
+}
+
+using Camera = std::unique_ptr<SDL_Camera, Destroyer<SDL_Camera>>;
+
 template<>
 inline void Destroy<SDL_Window>(SDL_Window *window)
 {
-    SDL_DestroyWindowSurface(window);
+    SDL_DestroyWindow(window);
 }
 
 using Window = std::unique_ptr<SDL_Window, Destroyer<SDL_Window>>;
 
+template<>
+inline void Destroy<SDL_Sensor>(SDL_Sensor *sensor)
+{
+    SDL_CloseSensor(sensor);
+}
+
+using Sensor = std::unique_ptr<SDL_Sensor, Destroyer<SDL_Sensor>>;
+
+template<>
+inline void Destroy<SDL_Joystick>(SDL_Joystick *joystick)
+{
+    SDL_CloseJoystick(joystick);
+}
+
+using Joystick = std::unique_ptr<SDL_Joystick, Destroyer<SDL_Joystick>>;
+
+template<>
+inline void Destroy<SDL_Gamepad>(SDL_Gamepad *gamepad)
+{
+    SDL_CloseGamepad(gamepad);
+}
+
+using Gamepad = std::unique_ptr<SDL_Gamepad, Destroyer<SDL_Gamepad>>;
+
 template<>
 inline void Destroy<SDL_Cursor>(SDL_Cursor *cursor)
 {
@@ -320,6 +763,30 @@ inline void ReleaseFromDevice<SDL_GPUFence>(SDL_GPUDevice *device,SDL_GPUFence *
     SDL_ReleaseGPUFence(device, fence);
 }
 
+template<>
+inline void Destroy<SDL_Haptic>(SDL_Haptic *haptic)
+{
+    SDL_CloseHaptic(haptic);
+}
+
+using Haptic = std::unique_ptr<SDL_Haptic, Destroyer<SDL_Haptic>>;
+
+template<>
+inline void Destroy<SDL_hid_device_info>(SDL_hid_device_info *devs)
+{
+    SDL_hid_free_enumeration(devs);
+}
+
+using hid_device_info = std::unique_ptr<SDL_hid_device_info, Destroyer<SDL_hid_device_info>>;
+
+template<>
+inline void Destroy<SDL_hid_device>(SDL_hid_device *dev)
+{
+    SDL_hid_close(dev);
+}
+
+using hid_device = std::unique_ptr<SDL_hid_device, Destroyer<SDL_hid_device>>;
+
 template<>
 inline void Destroy<SDL_Process>(SDL_Process *process)
 {
@@ -344,6 +811,14 @@ inline void Destroy<SDL_Renderer>(SDL_Renderer *renderer)
 
 using Renderer = std::unique_ptr<SDL_Renderer, Destroyer<SDL_Renderer>>;
 
+template<>
+inline void Destroy<SDL_Storage>(SDL_Storage *storage)
+{
+    SDL_CloseStorage(storage);
+}
+
+using Storage = std::unique_ptr<SDL_Storage, Destroyer<SDL_Storage>>;
+
 template<>
 inline void Destroy<SDL_Tray>(SDL_Tray *tray)
 {
@@ -352,37 +827,192 @@ inline void Destroy<SDL_Tray>(SDL_Tray *tray)
 
 using Tray = std::unique_ptr<SDL_Tray, Destroyer<SDL_Tray>>;
 
-inline void *malloc(size_t size, std::source_location location = std::source_location::current())
+template<>
+inline void Unlock<SDL_Mutex>(SDL_Mutex *mutex)
 {
-    void *result = SDL_malloc(size);
-    if (!result)
-    {
-        SDLThrow(location);
-    }
-    return result;
+    SDL_UnlockMutex(mutex);
 }
 
-inline void *calloc(size_t nmemb, size_t size, std::source_location location = std::source_location::current())
+using LockedMutex = std::unique_ptr<SDL_Mutex, Unlocker<SDL_Mutex>>;
+
+template<>
+inline void Unlock<SDL_RWLock>(SDL_RWLock *rwlock)
 {
-    void *result = SDL_calloc(nmemb, size);
-    if (!result)
-    {
-        SDLThrow(location);
-    }
-    return result;
+    SDL_UnlockRWLock(rwlock);
 }
 
-inline void *realloc(void *mem, size_t size, std::source_location location = std::source_location::current())
+using LockedRWLock = std::unique_ptr<SDL_RWLock, Unlocker<SDL_RWLock>>;
+
+template<>
+inline void Unlock<SDL_AudioStream>(SDL_AudioStream *stream)
 {
-    void *result = SDL_realloc(mem, size);
-    if (!result)
-    {
-        SDLThrow(location);
-    }
-    return result;
+    SDL_UnlockAudioStream(stream);
 }
 
-inline void free(void *mem)
+using LockedAudioStream = std::unique_ptr<SDL_AudioStream, Unlocker<SDL_AudioStream>>;
+
+template<>
+inline void Unlock<SDL_Surface>(SDL_Surface *surface)
+{
+    SDL_UnlockSurface(surface);
+}
+
+using LockedSurface = std::unique_ptr<SDL_Surface, Unlocker<SDL_Surface>>;
+
+template<>
+inline void Unlock<SDL_Texture>(SDL_Texture *texture)
+{
+    SDL_UnlockTexture(texture);
+}
+
+using LockedTexture = std::unique_ptr<SDL_Texture, Unlocker<SDL_Texture>>;
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_RGB332> : PackedPixelFormatTraits<8, 1, 0xe0u, 0x1cu, 0x3u, 0x0u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_XRGB4444> : PackedPixelFormatTraits<12, 2, 0xf00u, 0xf0u, 0xfu, 0x0u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_XBGR4444> : PackedPixelFormatTraits<12, 2, 0xfu, 0xf0u, 0xf00u, 0x0u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_XRGB1555> : PackedPixelFormatTraits<15, 2, 0x7c00u, 0x3e0u, 0x1fu, 0x0u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_XBGR1555> : PackedPixelFormatTraits<15, 2, 0x1fu, 0x3e0u, 0x7c00u, 0x0u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_ARGB4444> : PackedPixelFormatTraits<16, 2, 0xf00u, 0xf0u, 0xfu, 0xf000u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_RGBA4444> : PackedPixelFormatTraits<16, 2, 0xf000u, 0xf00u, 0xf0u, 0xfu>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_ABGR4444> : PackedPixelFormatTraits<16, 2, 0xfu, 0xf0u, 0xf00u, 0xf000u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_BGRA4444> : PackedPixelFormatTraits<16, 2, 0xf0u, 0xf00u, 0xf000u, 0xfu>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_ARGB1555> : PackedPixelFormatTraits<16, 2, 0x7c00u, 0x3e0u, 0x1fu, 0x8000u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_RGBA5551> : PackedPixelFormatTraits<16, 2, 0xf800u, 0x7c0u, 0x3eu, 0x1u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_ABGR1555> : PackedPixelFormatTraits<16, 2, 0x1fu, 0x3e0u, 0x7c00u, 0x8000u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_BGRA5551> : PackedPixelFormatTraits<16, 2, 0x3eu, 0x7c0u, 0xf800u, 0x1u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_RGB565> : PackedPixelFormatTraits<16, 2, 0xf800u, 0x7e0u, 0x1fu, 0x0u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_BGR565> : PackedPixelFormatTraits<16, 2, 0x1fu, 0x7e0u, 0xf800u, 0x0u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_XRGB8888> : PackedPixelFormatTraits<24, 4, 0xff0000u, 0xff00u, 0xffu, 0x0u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_RGBX8888> : PackedPixelFormatTraits<24, 4, 0xff000000u, 0xff0000u, 0xff00u, 0x0u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_XBGR8888> : PackedPixelFormatTraits<24, 4, 0xffu, 0xff00u, 0xff0000u, 0x0u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_BGRX8888> : PackedPixelFormatTraits<24, 4, 0xff00u, 0xff0000u, 0xff000000u, 0x0u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_ARGB8888> : PackedPixelFormatTraits<32, 4, 0xff0000u, 0xff00u, 0xffu, 0xff000000u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_RGBA8888> : PackedPixelFormatTraits<32, 4, 0xff000000u, 0xff0000u, 0xff00u, 0xffu>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_ABGR8888> : PackedPixelFormatTraits<32, 4, 0xffu, 0xff00u, 0xff0000u, 0xff000000u>
+{
+};
+
+template<>
+struct PixelFormatTraits<SDL_PIXELFORMAT_BGRA8888> : PackedPixelFormatTraits<32, 4, 0xff00u, 0xff0000u, 0xff000000u, 0xffu>
+{
+};
+
+inline Result<void *> malloc(size_t size, Location location = Location::current())
+{
+    void *result = SDL_malloc(size);
+    if (!result) [[unlikely]]
+    {
+        return Fail<void *>(location);
+    }
+    return result;
+}
+
+inline Result<void *> calloc(size_t nmemb, size_t size, Location location = Location::current())
+{
+    void *result = SDL_calloc(nmemb, size);
+    if (!result) [[unlikely]]
+    {
+        return Fail<void *>(location);
+    }
+    return result;
+}
+
+inline Result<void *> realloc(void *mem, size_t size, Location location = Location::current())
+{
+    void *result = SDL_realloc(mem, size);
+    if (!result) [[unlikely]]
+    {
+        return Fail<void *>(location);
+    }
+    return result;
+}
+
+inline void free(void *mem)
 {
     SDL_free(mem);
 }
@@ -397,20 +1027,21 @@ inline void GetMemoryFunctions(SDL_malloc_func *malloc_func, SDL_calloc_func *ca
     SDL_GetMemoryFunctions(malloc_func, calloc_func, realloc_func, free_func);
 }
 
-inline void SetMemoryFunctions(SDL_malloc_func malloc_func, SDL_calloc_func calloc_func, SDL_realloc_func realloc_func, SDL_free_func free_func, std::source_location location = std::source_location::current())
+inline Result<void> SetMemoryFunctions(SDL_malloc_func malloc_func, SDL_calloc_func calloc_func, SDL_realloc_func realloc_func, SDL_free_func free_func, Location location = Location::current())
 {
-    if (!SDL_SetMemoryFunctions(malloc_func, calloc_func, realloc_func, free_func))
+    if (!SDL_SetMemoryFunctions(malloc_func, calloc_func, realloc_func, free_func)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void *aligned_alloc(size_t alignment, size_t size, std::source_location location = std::source_location::current())
+inline Result<void *> aligned_alloc(size_t alignment, size_t size, Location location = Location::current())
 {
     void *result = SDL_aligned_alloc(alignment, size);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
@@ -425,60 +1056,62 @@ inline int GetNumAllocations()
     return SDL_GetNumAllocations();
 }
 
-inline SDL_Environment *GetEnvironment(std::source_location location = std::source_location::current())
+inline Result<SDL_Environment *> GetEnvironment(Location location = Location::current())
 {
     SDL_Environment *result = SDL_GetEnvironment();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Environment *>(location);
     }
     return result;
 }
 
-inline SDL_Environment *CreateEnvironment(bool populated, std::source_location location = std::source_location::current())
+inline Result<SDL_Environment *> CreateEnvironment(bool populated, Location location = Location::current())
 {
     SDL_Environment *result = SDL_CreateEnvironment(populated);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Environment *>(location);
     }
     return result;
 }
 
-inline const char *GetEnvironmentVariable(SDL_Environment *env, const char *name, std::source_location location = std::source_location::current())
+inline Result<const char *> GetEnvironmentVariable(SDL_Environment *env, const char *name, Location location = Location::current())
 {
     const char *result = SDL_GetEnvironmentVariable(env, name);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline char **GetEnvironmentVariables(SDL_Environment *env, std::source_location location = std::source_location::current())
+inline Result<char **> GetEnvironmentVariables(SDL_Environment *env, Location location = Location::current())
 {
     char **result = SDL_GetEnvironmentVariables(env);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char **>(location);
     }
     return result;
 }
 
-inline void SetEnvironmentVariable(SDL_Environment *env, const char *name, const char *value, bool overwrite, std::source_location location = std::source_location::current())
+inline Result<void> SetEnvironmentVariable(SDL_Environment *env, const char *name, const char *value, bool overwrite, Location location = Location::current())
 {
-    if (!SDL_SetEnvironmentVariable(env, name, value, overwrite))
+    if (!SDL_SetEnvironmentVariable(env, name, value, overwrite)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void UnsetEnvironmentVariable(SDL_Environment *env, const char *name, std::source_location location = std::source_location::current())
+inline Result<void> UnsetEnvironmentVariable(SDL_Environment *env, const char *name, Location location = Location::current())
 {
-    if (!SDL_UnsetEnvironmentVariable(env, name))
+    if (!SDL_UnsetEnvironmentVariable(env, name)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void DestroyEnvironment(SDL_Environment *env)
@@ -486,22 +1119,22 @@ inline void DestroyEnvironment(SDL_Environment *env)
     SDL_DestroyEnvironment(env);
 }
 
-inline const char *getenv(const char *name, std::source_location location = std::source_location::current())
+inline Result<const char *> getenv(const char *name, Location location = Location::current())
 {
     const char *result = SDL_getenv(name);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline const char *getenv_unsafe(const char *name, std::source_location location = std::source_location::current())
+inline Result<const char *> getenv_unsafe(const char *name, Location location = Location::current())
 {
     const char *result = SDL_getenv_unsafe(name);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -521,12 +1154,12 @@ inline void qsort(void *base, size_t nmemb, size_t size, SDL_CompareCallback com
     SDL_qsort(base, nmemb, size, compare);
 }
 
-inline void *bsearch(const void *key, const void *base, size_t nmemb, size_t size, SDL_CompareCallback compare, std::source_location location = std::source_location::current())
+inline Result<void *> bsearch(const void *key, const void *base, size_t nmemb, size_t size, SDL_CompareCallback compare, Location location = Location::current())
 {
     void *result = SDL_bsearch(key, base, nmemb, size, compare);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
@@ -536,12 +1169,12 @@ inline void qsort_r(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r
     SDL_qsort_r(base, nmemb, size, compare, userdata);
 }
 
-inline void *bsearch_r(const void *key, const void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void *> bsearch_r(const void *key, const void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata, Location location = Location::current())
 {
     void *result = SDL_bsearch_r(key, base, nmemb, size, compare, userdata);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
@@ -636,42 +1269,42 @@ inline Uint32 murmur3_32(const void *data, size_t len, Uint32 seed)
     return SDL_murmur3_32(data, len, seed);
 }
 
-inline void *memcpy(void *dst, const void *src, size_t len, std::source_location location = std::source_location::current())
+inline Result<void *> memcpy(void *dst, const void *src, size_t len, Location location = Location::current())
 {
     void *result = SDL_memcpy(dst, src, len);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline void *memmove(void *dst, const void *src, size_t len, std::source_location location = std::source_location::current())
+inline Result<void *> memmove(void *dst, const void *src, size_t len, Location location = Location::current())
 {
     void *result = SDL_memmove(dst, src, len);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline void *memset(void *dst, int c, size_t len, std::source_location location = std::source_location::current())
+inline Result<void *> memset(void *dst, int c, size_t len, Location location = Location::current())
 {
     void *result = SDL_memset(dst, c, len);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline void *memset4(void *dst, Uint32 val, size_t dwords, std::source_location location = std::source_location::current())
+inline Result<void *> memset4(void *dst, Uint32 val, size_t dwords, Location location = Location::current())
 {
     void *result = SDL_memset4(dst, val, dwords);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
@@ -701,32 +1334,32 @@ inline size_t wcslcat(wchar_t *dst, const wchar_t *src, size_t maxlen)
     return SDL_wcslcat(dst, src, maxlen);
 }
 
-inline wchar_t *wcsdup(const wchar_t *wstr, std::source_location location = std::source_location::current())
+inline Result<wchar_t *> wcsdup(const wchar_t *wstr, Location location = Location::current())
 {
     wchar_t *result = SDL_wcsdup(wstr);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<wchar_t *>(location);
     }
     return result;
 }
 
-inline wchar_t *wcsstr(const wchar_t *haystack, const wchar_t *needle, std::source_location location = std::source_location::current())
+inline Result<wchar_t *> wcsstr(const wchar_t *haystack, const wchar_t *needle, Location location = Location::current())
 {
     wchar_t *result = SDL_wcsstr(haystack, needle);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<wchar_t *>(location);
     }
     return result;
 }
 
-inline wchar_t *wcsnstr(const wchar_t *haystack, const wchar_t *needle, size_t maxlen, std::source_location location = std::source_location::current())
+inline Result<wchar_t *> wcsnstr(const wchar_t *haystack, const wchar_t *needle, size_t maxlen, Location location = Location::current())
 {
     wchar_t *result = SDL_wcsnstr(haystack, needle, maxlen);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<wchar_t *>(location);
     }
     return result;
 }
@@ -781,112 +1414,112 @@ inline size_t strlcat(char *dst, const char *src, size_t maxlen)
     return SDL_strlcat(dst, src, maxlen);
 }
 
-inline char *strdup(const char *str, std::source_location location = std::source_location::current())
+inline Result<char *> strdup(const char *str, Location location = Location::current())
 {
     char *result = SDL_strdup(str);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *strndup(const char *str, size_t maxlen, std::source_location location = std::source_location::current())
+inline Result<char *> strndup(const char *str, size_t maxlen, Location location = Location::current())
 {
     char *result = SDL_strndup(str, maxlen);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *strrev(char *str, std::source_location location = std::source_location::current())
+inline Result<char *> strrev(char *str, Location location = Location::current())
 {
     char *result = SDL_strrev(str);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *strupr(char *str, std::source_location location = std::source_location::current())
+inline Result<char *> strupr(char *str, Location location = Location::current())
 {
     char *result = SDL_strupr(str);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *strlwr(char *str, std::source_location location = std::source_location::current())
+inline Result<char *> strlwr(char *str, Location location = Location::current())
 {
     char *result = SDL_strlwr(str);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *strchr(const char *str, int c, std::source_location location = std::source_location::current())
+inline Result<char *> strchr(const char *str, int c, Location location = Location::current())
 {
     char *result = SDL_strchr(str, c);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *strrchr(const char *str, int c, std::source_location location = std::source_location::current())
+inline Result<char *> strrchr(const char *str, int c, Location location = Location::current())
 {
     char *result = SDL_strrchr(str, c);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *strstr(const char *haystack, const char *needle, std::source_location location = std::source_location::current())
+inline Result<char *> strstr(const char *haystack, const char *needle, Location location = Location::current())
 {
     char *result = SDL_strstr(haystack, needle);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *strnstr(const char *haystack, const char *needle, size_t maxlen, std::source_location location = std::source_location::current())
+inline Result<char *> strnstr(const char *haystack, const char *needle, size_t maxlen, Location location = Location::current())
 {
     char *result = SDL_strnstr(haystack, needle, maxlen);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *strcasestr(const char *haystack, const char *needle, std::source_location location = std::source_location::current())
+inline Result<char *> strcasestr(const char *haystack, const char *needle, Location location = Location::current())
 {
     char *result = SDL_strcasestr(haystack, needle);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *strtok_r(char *str, const char *delim, char **saveptr, std::source_location location = std::source_location::current())
+inline Result<char *> strtok_r(char *str, const char *delim, char **saveptr, Location location = Location::current())
 {
     char *result = SDL_strtok_r(str, delim, saveptr);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
@@ -901,62 +1534,62 @@ inline size_t utf8strnlen(const char *str, size_t bytes)
     return SDL_utf8strnlen(str, bytes);
 }
 
-inline char *itoa(int value, char *str, int radix, std::source_location location = std::source_location::current())
+inline Result<char *> itoa(int value, char *str, int radix, Location location = Location::current())
 {
     char *result = SDL_itoa(value, str, radix);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *uitoa(unsigned int value, char *str, int radix, std::source_location location = std::source_location::current())
+inline Result<char *> uitoa(unsigned int value, char *str, int radix, Location location = Location::current())
 {
     char *result = SDL_uitoa(value, str, radix);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *ltoa(long value, char *str, int radix, std::source_location location = std::source_location::current())
+inline Result<char *> ltoa(long value, char *str, int radix, Location location = Location::current())
 {
     char *result = SDL_ltoa(value, str, radix);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *ultoa(unsigned long value, char *str, int radix, std::source_location location = std::source_location::current())
+inline Result<char *> ultoa(unsigned long value, char *str, int radix, Location location = Location::current())
 {
     char *result = SDL_ultoa(value, str, radix);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *lltoa(long long value, char *str, int radix, std::source_location location = std::source_location::current())
+inline Result<char *> lltoa(long long value, char *str, int radix, Location location = Location::current())
 {
     char *result = SDL_lltoa(value, str, radix);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *ulltoa(unsigned long long value, char *str, int radix, std::source_location location = std::source_location::current())
+inline Result<char *> ulltoa(unsigned long long value, char *str, int radix, Location location = Location::current())
 {
     char *result = SDL_ulltoa(value, str, radix);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
@@ -1016,12 +1649,12 @@ inline int strncasecmp(const char *str1, const char *str2, size_t maxlen)
     return SDL_strncasecmp(str1, str2, maxlen);
 }
 
-inline char *strpbrk(const char *str, const char *breakset, std::source_location location = std::source_location::current())
+inline Result<char *> strpbrk(const char *str, const char *breakset, Location location = Location::current())
 {
     char *result = SDL_strpbrk(str, breakset);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
@@ -1036,12 +1669,12 @@ inline Uint32 StepBackUTF8(const char *start, const char **pstr)
     return SDL_StepBackUTF8(start, pstr);
 }
 
-inline char *UCS4ToUTF8(Uint32 codepoint, char *dst, std::source_location location = std::source_location::current())
+inline Result<char *> UCS4ToUTF8(Uint32 codepoint, char *dst, Location location = Location::current())
 {
     char *result = SDL_UCS4ToUTF8(codepoint, dst);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
@@ -1356,30 +1989,24 @@ inline size_t iconv(SDL_iconv_t cd, const char **inbuf, size_t *inbytesleft, cha
     return SDL_iconv(cd, inbuf, inbytesleft, outbuf, outbytesleft);
 }
 
-inline char *iconv_string(const char *tocode, const char *fromcode, const char *inbuf, size_t inbytesleft, std::source_location location = std::source_location::current())
+inline Result<char *> iconv_string(const char *tocode, const char *fromcode, const char *inbuf, size_t inbytesleft, Location location = Location::current())
 {
     char *result = SDL_iconv_string(tocode, fromcode, inbuf, inbytesleft);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline void size_mul_check_overflow(size_t a, size_t b, size_t *ret, std::source_location location = std::source_location::current())
+inline bool size_mul_check_overflow(size_t a, size_t b, size_t *ret)
 {
-    if (!SDL_size_mul_check_overflow(a, b, ret))
-    {
-        SDLThrow(location);
-    }
+    return SDL_size_mul_check_overflow(a, b, ret);
 }
 
-inline void size_add_check_overflow(size_t a, size_t b, size_t *ret, std::source_location location = std::source_location::current())
+inline bool size_add_check_overflow(size_t a, size_t b, size_t *ret)
 {
-    if (!SDL_size_add_check_overflow(a, b, ret))
-    {
-        SDLThrow(location);
-    }
+    return SDL_size_add_check_overflow(a, b, ret);
 }
 
 inline SDL_AssertState ReportAssertion(SDL_AssertData *data, const char *func, const char *file, int line)
@@ -1402,12 +2029,12 @@ inline SDL_AssertionHandler GetAssertionHandler(void **puserdata)
     return SDL_GetAssertionHandler(puserdata);
 }
 
-inline const SDL_AssertData *GetAssertionReport(std::source_location location = std::source_location::current())
+inline Result<const SDL_AssertData *> GetAssertionReport(Location location = Location::current())
 {
     const SDL_AssertData *result = SDL_GetAssertionReport();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const SDL_AssertData *>(location);
     }
     return result;
 }
@@ -1417,12 +2044,12 @@ inline void ResetAssertionReport()
     SDL_ResetAssertionReport();
 }
 
-inline SDL_AsyncIO *AsyncIOFromFile(const char *file, const char *mode, std::source_location location = std::source_location::current())
+inline Result<SDL_AsyncIO *> AsyncIOFromFile(const char *file, const char *mode, Location location = Location::current())
 {
     SDL_AsyncIO *result = SDL_AsyncIOFromFile(file, mode);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_AsyncIO *>(location);
     }
     return result;
 }
@@ -1432,36 +2059,39 @@ inline Sint64 GetAsyncIOSize(SDL_AsyncIO *asyncio)
     return SDL_GetAsyncIOSize(asyncio);
 }
 
-inline void ReadAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> ReadAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata, Location location = Location::current())
 {
-    if (!SDL_ReadAsyncIO(asyncio, ptr, offset, size, queue, userdata))
+    if (!SDL_ReadAsyncIO(asyncio, ptr, offset, size, queue, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> WriteAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata, Location location = Location::current())
 {
-    if (!SDL_WriteAsyncIO(asyncio, ptr, offset, size, queue, userdata))
+    if (!SDL_WriteAsyncIO(asyncio, ptr, offset, size, queue, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void CloseAsyncIO(SDL_AsyncIO *asyncio, bool flush, SDL_AsyncIOQueue *queue, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> CloseAsyncIO(SDL_AsyncIO *asyncio, bool flush, SDL_AsyncIOQueue *queue, void *userdata, Location location = Location::current())
 {
-    if (!SDL_CloseAsyncIO(asyncio, flush, queue, userdata))
+    if (!SDL_CloseAsyncIO(asyncio, flush, queue, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_AsyncIOQueue *CreateAsyncIOQueue(std::source_location location = std::source_location::current())
+inline Result<SDL_AsyncIOQueue *> CreateAsyncIOQueue(Location location = Location::current())
 {
     SDL_AsyncIOQueue *result = SDL_CreateAsyncIOQueue();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_AsyncIOQueue *>(location);
     }
     return result;
 }
@@ -1471,20 +2101,14 @@ inline void DestroyAsyncIOQueue(SDL_AsyncIOQueue *queue)
     SDL_DestroyAsyncIOQueue(queue);
 }
 
-inline void GetAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome, std::source_location location = std::source_location::current())
+inline bool GetAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome)
 {
-    if (!SDL_GetAsyncIOResult(queue, outcome))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetAsyncIOResult(queue, outcome);
 }
 
-inline void WaitAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome, Sint32 timeoutMS, std::source_location location = std::source_location::current())
+inline bool WaitAsyncIOResult(SDL_AsyncIOQueue *queue, SDL_AsyncIOOutcome *outcome, Sint32 timeoutMS)
 {
-    if (!SDL_WaitAsyncIOResult(queue, outcome, timeoutMS))
-    {
-        SDLThrow(location);
-    }
+    return SDL_WaitAsyncIOResult(queue, outcome, timeoutMS);
 }
 
 inline void SignalAsyncIOQueue(SDL_AsyncIOQueue *queue)
@@ -1492,20 +2116,18 @@ inline void SignalAsyncIOQueue(SDL_AsyncIOQueue *queue)
     SDL_SignalAsyncIOQueue(queue);
 }
 
-inline void LoadFileAsync(const char *file, SDL_AsyncIOQueue *queue, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> LoadFileAsync(const char *file, SDL_AsyncIOQueue *queue, void *userdata, Location location = Location::current())
 {
-    if (!SDL_LoadFileAsync(file, queue, userdata))
+    if (!SDL_LoadFileAsync(file, queue, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void TryLockSpinlock(SDL_SpinLock *lock, std::source_location location = std::source_location::current())
+inline bool TryLockSpinlock(SDL_SpinLock *lock)
 {
-    if (!SDL_TryLockSpinlock(lock))
-    {
-        SDLThrow(location);
-    }
+    return SDL_TryLockSpinlock(lock);
 }
 
 inline void LockSpinlock(SDL_SpinLock *lock)
@@ -1528,12 +2150,9 @@ inline void MemoryBarrierAcquireFunction()
     SDL_MemoryBarrierAcquireFunction();
 }
 
-inline void CompareAndSwapAtomicInt(SDL_AtomicInt *a, int oldval, int newval, std::source_location location = std::source_location::current())
+inline bool CompareAndSwapAtomicInt(SDL_AtomicInt *a, int oldval, int newval)
 {
-    if (!SDL_CompareAndSwapAtomicInt(a, oldval, newval))
-    {
-        SDLThrow(location);
-    }
+    return SDL_CompareAndSwapAtomicInt(a, oldval, newval);
 }
 
 inline int SetAtomicInt(SDL_AtomicInt *a, int v)
@@ -1551,12 +2170,9 @@ inline int AddAtomicInt(SDL_AtomicInt *a, int v)
     return SDL_AddAtomicInt(a, v);
 }
 
-inline void CompareAndSwapAtomicU32(SDL_AtomicU32 *a, Uint32 oldval, Uint32 newval, std::source_location location = std::source_location::current())
+inline bool CompareAndSwapAtomicU32(SDL_AtomicU32 *a, Uint32 oldval, Uint32 newval)
 {
-    if (!SDL_CompareAndSwapAtomicU32(a, oldval, newval))
-    {
-        SDLThrow(location);
-    }
+    return SDL_CompareAndSwapAtomicU32(a, oldval, newval);
 }
 
 inline Uint32 SetAtomicU32(SDL_AtomicU32 *a, Uint32 v)
@@ -1569,30 +2185,27 @@ inline Uint32 GetAtomicU32(SDL_AtomicU32 *a)
     return SDL_GetAtomicU32(a);
 }
 
-inline void CompareAndSwapAtomicPointer(void **a, void *oldval, void *newval, std::source_location location = std::source_location::current())
+inline bool CompareAndSwapAtomicPointer(void **a, void *oldval, void *newval)
 {
-    if (!SDL_CompareAndSwapAtomicPointer(a, oldval, newval))
-    {
-        SDLThrow(location);
-    }
+    return SDL_CompareAndSwapAtomicPointer(a, oldval, newval);
 }
 
-inline void *SetAtomicPointer(void **a, void *v, std::source_location location = std::source_location::current())
+inline Result<void *> SetAtomicPointer(void **a, void *v, Location location = Location::current())
 {
     void *result = SDL_SetAtomicPointer(a, v);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline void *GetAtomicPointer(void **a, std::source_location location = std::source_location::current())
+inline Result<void *> GetAtomicPointer(void **a, Location location = Location::current())
 {
     void *result = SDL_GetAtomicPointer(a);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
@@ -1602,38 +2215,33 @@ inline float SwapFloat(float x)
     return SDL_SwapFloat(x);
 }
 
-inline void SetErrorV(const char *fmt, va_list ap, std::source_location location = std::source_location::current())
+inline bool SetErrorV(const char *fmt, va_list ap)
 {
-    if (!SDL_SetErrorV(fmt, ap))
-    {
-        SDLThrow(location);
-    }
+    return SDL_SetErrorV(fmt, ap);
 }
 
-inline void OutOfMemory(std::source_location location = std::source_location::current())
+inline bool OutOfMemory()
 {
-    if (!SDL_OutOfMemory())
-    {
-        SDLThrow(location);
-    }
+    return SDL_OutOfMemory();
 }
 
-inline const char *GetError(std::source_location location = std::source_location::current())
+inline Result<const char *> GetError(Location location = Location::current())
 {
     const char *result = SDL_GetError();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline void ClearError(std::source_location location = std::source_location::current())
+inline Result<void> ClearError(Location location = Location::current())
 {
-    if (!SDL_ClearError())
+    if (!SDL_ClearError()) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline SDL_PropertiesID GetGlobalProperties()
@@ -1646,20 +2254,22 @@ inline SDL_PropertiesID CreateProperties()
     return SDL_CreateProperties();
 }
 
-inline void CopyProperties(SDL_PropertiesID src, SDL_PropertiesID dst, std::source_location location = std::source_location::current())
+inline Result<void> CopyProperties(SDL_PropertiesID src, SDL_PropertiesID dst, Location location = Location::current())
 {
-    if (!SDL_CopyProperties(src, dst))
+    if (!SDL_CopyProperties(src, dst)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void LockProperties(SDL_PropertiesID props, std::source_location location = std::source_location::current())
+inline Result<void> LockProperties(SDL_PropertiesID props, Location location = Location::current())
 {
-    if (!SDL_LockProperties(props))
+    if (!SDL_LockProperties(props)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void UnlockProperties(SDL_PropertiesID props)
@@ -1667,60 +2277,63 @@ inline void UnlockProperties(SDL_PropertiesID props)
     SDL_UnlockProperties(props);
 }
 
-inline void SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> SetPointerPropertyWithCleanup(SDL_PropertiesID props, const char *name, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata, Location location = Location::current())
 {
-    if (!SDL_SetPointerPropertyWithCleanup(props, name, value, cleanup, userdata))
+    if (!SDL_SetPointerPropertyWithCleanup(props, name, value, cleanup, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetPointerProperty(SDL_PropertiesID props, const char *name, void *value, std::source_location location = std::source_location::current())
+inline Result<void> SetPointerProperty(SDL_PropertiesID props, const char *name, void *value, Location location = Location::current())
 {
-    if (!SDL_SetPointerProperty(props, name, value))
+    if (!SDL_SetPointerProperty(props, name, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetStringProperty(SDL_PropertiesID props, const char *name, const char *value, std::source_location location = std::source_location::current())
+inline Result<void> SetStringProperty(SDL_PropertiesID props, const char *name, const char *value, Location location = Location::current())
 {
-    if (!SDL_SetStringProperty(props, name, value))
+    if (!SDL_SetStringProperty(props, name, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 value, std::source_location location = std::source_location::current())
+inline Result<void> SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 value, Location location = Location::current())
 {
-    if (!SDL_SetNumberProperty(props, name, value))
+    if (!SDL_SetNumberProperty(props, name, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetFloatProperty(SDL_PropertiesID props, const char *name, float value, std::source_location location = std::source_location::current())
+inline Result<void> SetFloatProperty(SDL_PropertiesID props, const char *name, float value, Location location = Location::current())
 {
-    if (!SDL_SetFloatProperty(props, name, value))
+    if (!SDL_SetFloatProperty(props, name, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetBooleanProperty(SDL_PropertiesID props, const char *name, bool value, std::source_location location = std::source_location::current())
+inline Result<void> SetBooleanProperty(SDL_PropertiesID props, const char *name, bool value, Location location = Location::current())
 {
-    if (!SDL_SetBooleanProperty(props, name, value))
+    if (!SDL_SetBooleanProperty(props, name, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void HasProperty(SDL_PropertiesID props, const char *name, std::source_location location = std::source_location::current())
+inline bool HasProperty(SDL_PropertiesID props, const char *name)
 {
-    if (!SDL_HasProperty(props, name))
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasProperty(props, name);
 }
 
 inline SDL_PropertyType GetPropertyType(SDL_PropertiesID props, const char *name)
@@ -1728,22 +2341,22 @@ inline SDL_PropertyType GetPropertyType(SDL_PropertiesID props, const char *name
     return SDL_GetPropertyType(props, name);
 }
 
-inline void *GetPointerProperty(SDL_PropertiesID props, const char *name, void *default_value, std::source_location location = std::source_location::current())
+inline Result<void *> GetPointerProperty(SDL_PropertiesID props, const char *name, void *default_value, Location location = Location::current())
 {
     void *result = SDL_GetPointerProperty(props, name, default_value);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline const char *GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value, std::source_location location = std::source_location::current())
+inline Result<const char *> GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value, Location location = Location::current())
 {
     const char *result = SDL_GetStringProperty(props, name, default_value);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -1758,28 +2371,27 @@ inline float GetFloatProperty(SDL_PropertiesID props, const char *name, float de
     return SDL_GetFloatProperty(props, name, default_value);
 }
 
-inline void GetBooleanProperty(SDL_PropertiesID props, const char *name, bool default_value, std::source_location location = std::source_location::current())
+inline bool GetBooleanProperty(SDL_PropertiesID props, const char *name, bool default_value)
 {
-    if (!SDL_GetBooleanProperty(props, name, default_value))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetBooleanProperty(props, name, default_value);
 }
 
-inline void ClearProperty(SDL_PropertiesID props, const char *name, std::source_location location = std::source_location::current())
+inline Result<void> ClearProperty(SDL_PropertiesID props, const char *name, Location location = Location::current())
 {
-    if (!SDL_ClearProperty(props, name))
+    if (!SDL_ClearProperty(props, name)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void EnumerateProperties(SDL_PropertiesID props, SDL_EnumeratePropertiesCallback callback, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> EnumerateProperties(SDL_PropertiesID props, SDL_EnumeratePropertiesCallback callback, void *userdata, Location location = Location::current())
 {
-    if (!SDL_EnumerateProperties(props, callback, userdata))
+    if (!SDL_EnumerateProperties(props, callback, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void DestroyProperties(SDL_PropertiesID props)
@@ -1787,32 +2399,32 @@ inline void DestroyProperties(SDL_PropertiesID props)
     SDL_DestroyProperties(props);
 }
 
-inline SDL_Thread *CreateThreadRuntime(SDL_ThreadFunction fn, const char *name, void *data, SDL_FunctionPointer pfnBeginThread, SDL_FunctionPointer pfnEndThread, std::source_location location = std::source_location::current())
+inline Result<SDL_Thread *> CreateThreadRuntime(SDL_ThreadFunction fn, const char *name, void *data, SDL_FunctionPointer pfnBeginThread, SDL_FunctionPointer pfnEndThread, Location location = Location::current())
 {
     SDL_Thread *result = SDL_CreateThreadRuntime(fn, name, data, pfnBeginThread, pfnEndThread);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Thread *>(location);
     }
     return result;
 }
 
-inline SDL_Thread *CreateThreadWithPropertiesRuntime(SDL_PropertiesID props, SDL_FunctionPointer pfnBeginThread, SDL_FunctionPointer pfnEndThread, std::source_location location = std::source_location::current())
+inline Result<SDL_Thread *> CreateThreadWithPropertiesRuntime(SDL_PropertiesID props, SDL_FunctionPointer pfnBeginThread, SDL_FunctionPointer pfnEndThread, Location location = Location::current())
 {
     SDL_Thread *result = SDL_CreateThreadWithPropertiesRuntime(props, pfnBeginThread, pfnEndThread);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Thread *>(location);
     }
     return result;
 }
 
-inline const char *GetThreadName(SDL_Thread *thread, std::source_location location = std::source_location::current())
+inline Result<const char *> GetThreadName(SDL_Thread *thread, Location location = Location::current())
 {
     const char *result = SDL_GetThreadName(thread);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -1827,12 +2439,13 @@ inline SDL_ThreadID GetThreadID(SDL_Thread *thread)
     return SDL_GetThreadID(thread);
 }
 
-inline void SetCurrentThreadPriority(SDL_ThreadPriority priority, std::source_location location = std::source_location::current())
+inline Result<void> SetCurrentThreadPriority(SDL_ThreadPriority priority, Location location = Location::current())
 {
-    if (!SDL_SetCurrentThreadPriority(priority))
+    if (!SDL_SetCurrentThreadPriority(priority)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void WaitThread(SDL_Thread *thread, int *status)
@@ -1850,22 +2463,23 @@ inline void DetachThread(SDL_Thread *thread)
     SDL_DetachThread(thread);
 }
 
-inline void *GetTLS(SDL_TLSID *id, std::source_location location = std::source_location::current())
+inline Result<void *> GetTLS(SDL_TLSID *id, Location location = Location::current())
 {
     void *result = SDL_GetTLS(id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline void SetTLS(SDL_TLSID *id, const void *value, SDL_TLSDestructorCallback destructor, std::source_location location = std::source_location::current())
+inline Result<void> SetTLS(SDL_TLSID *id, const void *value, SDL_TLSDestructorCallback destructor, Location location = Location::current())
 {
-    if (!SDL_SetTLS(id, value, destructor))
+    if (!SDL_SetTLS(id, value, destructor)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void CleanupTLS()
@@ -1873,12 +2487,12 @@ inline void CleanupTLS()
     SDL_CleanupTLS();
 }
 
-inline SDL_Mutex *CreateMutex(std::source_location location = std::source_location::current())
+inline Result<SDL_Mutex *> CreateMutex(Location location = Location::current())
 {
     SDL_Mutex *result = SDL_CreateMutex();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Mutex *>(location);
     }
     return result;
 }
@@ -1888,12 +2502,9 @@ inline void LockMutex(SDL_Mutex *mutex)
     SDL_LockMutex(mutex);
 }
 
-inline void TryLockMutex(SDL_Mutex *mutex, std::source_location location = std::source_location::current())
+inline bool TryLockMutex(SDL_Mutex *mutex)
 {
-    if (!SDL_TryLockMutex(mutex))
-    {
-        SDLThrow(location);
-    }
+    return SDL_TryLockMutex(mutex);
 }
 
 inline void UnlockMutex(SDL_Mutex *mutex)
@@ -1906,12 +2517,12 @@ inline void DestroyMutex(SDL_Mutex *mutex)
     SDL_DestroyMutex(mutex);
 }
 
-inline SDL_RWLock *CreateRWLock(std::source_location location = std::source_location::current())
+inline Result<SDL_RWLock *> CreateRWLock(Location location = Location::current())
 {
     SDL_RWLock *result = SDL_CreateRWLock();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_RWLock *>(location);
     }
     return result;
 }
@@ -1926,20 +2537,14 @@ inline void LockRWLockForWriting(SDL_RWLock *rwlock)
     SDL_LockRWLockForWriting(rwlock);
 }
 
-inline void TryLockRWLockForReading(SDL_RWLock *rwlock, std::source_location location = std::source_location::current())
+inline bool TryLockRWLockForReading(SDL_RWLock *rwlock)
 {
-    if (!SDL_TryLockRWLockForReading(rwlock))
-    {
-        SDLThrow(location);
-    }
+    return SDL_TryLockRWLockForReading(rwlock);
 }
 
-inline void TryLockRWLockForWriting(SDL_RWLock *rwlock, std::source_location location = std::source_location::current())
+inline bool TryLockRWLockForWriting(SDL_RWLock *rwlock)
 {
-    if (!SDL_TryLockRWLockForWriting(rwlock))
-    {
-        SDLThrow(location);
-    }
+    return SDL_TryLockRWLockForWriting(rwlock);
 }
 
 inline void UnlockRWLock(SDL_RWLock *rwlock)
@@ -1952,12 +2557,12 @@ inline void DestroyRWLock(SDL_RWLock *rwlock)
     SDL_DestroyRWLock(rwlock);
 }
 
-inline SDL_Semaphore *CreateSemaphore(Uint32 initial_value, std::source_location location = std::source_location::current())
+inline Result<SDL_Semaphore *> CreateSemaphore(Uint32 initial_value, Location location = Location::current())
 {
     SDL_Semaphore *result = SDL_CreateSemaphore(initial_value);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Semaphore *>(location);
     }
     return result;
 }
@@ -1972,20 +2577,14 @@ inline void WaitSemaphore(SDL_Semaphore *sem)
     SDL_WaitSemaphore(sem);
 }
 
-inline void TryWaitSemaphore(SDL_Semaphore *sem, std::source_location location = std::source_location::current())
+inline bool TryWaitSemaphore(SDL_Semaphore *sem)
 {
-    if (!SDL_TryWaitSemaphore(sem))
-    {
-        SDLThrow(location);
-    }
+    return SDL_TryWaitSemaphore(sem);
 }
 
-inline void WaitSemaphoreTimeout(SDL_Semaphore *sem, Sint32 timeoutMS, std::source_location location = std::source_location::current())
+inline bool WaitSemaphoreTimeout(SDL_Semaphore *sem, Sint32 timeoutMS)
 {
-    if (!SDL_WaitSemaphoreTimeout(sem, timeoutMS))
-    {
-        SDLThrow(location);
-    }
+    return SDL_WaitSemaphoreTimeout(sem, timeoutMS);
 }
 
 inline void SignalSemaphore(SDL_Semaphore *sem)
@@ -1998,12 +2597,12 @@ inline Uint32 GetSemaphoreValue(SDL_Semaphore *sem)
     return SDL_GetSemaphoreValue(sem);
 }
 
-inline SDL_Condition *CreateCondition(std::source_location location = std::source_location::current())
+inline Result<SDL_Condition *> CreateCondition(Location location = Location::current())
 {
     SDL_Condition *result = SDL_CreateCondition();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Condition *>(location);
     }
     return result;
 }
@@ -2028,28 +2627,19 @@ inline void WaitCondition(SDL_Condition *cond, SDL_Mutex *mutex)
     SDL_WaitCondition(cond, mutex);
 }
 
-inline void WaitConditionTimeout(SDL_Condition *cond, SDL_Mutex *mutex, Sint32 timeoutMS, std::source_location location = std::source_location::current())
+inline bool WaitConditionTimeout(SDL_Condition *cond, SDL_Mutex *mutex, Sint32 timeoutMS)
 {
-    if (!SDL_WaitConditionTimeout(cond, mutex, timeoutMS))
-    {
-        SDLThrow(location);
-    }
+    return SDL_WaitConditionTimeout(cond, mutex, timeoutMS);
 }
 
-inline void ShouldInit(SDL_InitState *state, std::source_location location = std::source_location::current())
+inline bool ShouldInit(SDL_InitState *state)
 {
-    if (!SDL_ShouldInit(state))
-    {
-        SDLThrow(location);
-    }
+    return SDL_ShouldInit(state);
 }
 
-inline void ShouldQuit(SDL_InitState *state, std::source_location location = std::source_location::current())
+inline bool ShouldQuit(SDL_InitState *state)
 {
-    if (!SDL_ShouldQuit(state))
-    {
-        SDLThrow(location);
-    }
+    return SDL_ShouldQuit(state);
 }
 
 inline void SetInitialized(SDL_InitState *state, bool initialized)
@@ -2057,62 +2647,63 @@ inline void SetInitialized(SDL_InitState *state, bool initialized)
     SDL_SetInitialized(state, initialized);
 }
 
-inline SDL_IOStream *IOFromFile(const char *file, const char *mode, std::source_location location = std::source_location::current())
+inline Result<SDL_IOStream *> IOFromFile(const char *file, const char *mode, Location location = Location::current())
 {
     SDL_IOStream *result = SDL_IOFromFile(file, mode);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_IOStream *>(location);
     }
     return result;
 }
 
-inline SDL_IOStream *IOFromMem(void *mem, size_t size, std::source_location location = std::source_location::current())
+inline Result<SDL_IOStream *> IOFromMem(void *mem, size_t size, Location location = Location::current())
 {
     SDL_IOStream *result = SDL_IOFromMem(mem, size);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_IOStream *>(location);
     }
     return result;
 }
 
-inline SDL_IOStream *IOFromConstMem(const void *mem, size_t size, std::source_location location = std::source_location::current())
+inline Result<SDL_IOStream *> IOFromConstMem(const void *mem, size_t size, Location location = Location::current())
 {
     SDL_IOStream *result = SDL_IOFromConstMem(mem, size);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_IOStream *>(location);
     }
     return result;
 }
 
-inline SDL_IOStream *IOFromDynamicMem(std::source_location location = std::source_location::current())
+inline Result<SDL_IOStream *> IOFromDynamicMem(Location location = Location::current())
 {
     SDL_IOStream *result = SDL_IOFromDynamicMem();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_IOStream *>(location);
     }
     return result;
 }
 
-inline SDL_IOStream *OpenIO(const SDL_IOStreamInterface *iface, void *userdata, std::source_location location = std::source_location::current())
+inline Result<SDL_IOStream *> OpenIO(const SDL_IOStreamInterface *iface, void *userdata, Location location = Location::current())
 {
     SDL_IOStream *result = SDL_OpenIO(iface, userdata);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_IOStream *>(location);
     }
     return result;
 }
 
-inline void CloseIO(SDL_IOStream *context, std::source_location location = std::source_location::current())
+inline Result<void> CloseIO(SDL_IOStream *context, Location location = Location::current())
 {
-    if (!SDL_CloseIO(context))
+    if (!SDL_CloseIO(context)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline SDL_PropertiesID GetIOProperties(SDL_IOStream *context)
@@ -2155,272 +2746,303 @@ inline size_t IOvprintf(SDL_IOStream *context, const char *fmt, va_list ap)
     return SDL_IOvprintf(context, fmt, ap);
 }
 
-inline void FlushIO(SDL_IOStream *context, std::source_location location = std::source_location::current())
+inline Result<void> FlushIO(SDL_IOStream *context, Location location = Location::current())
 {
-    if (!SDL_FlushIO(context))
+    if (!SDL_FlushIO(context)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void *LoadFile_IO(SDL_IOStream *src, size_t *datasize, bool closeio, std::source_location location = std::source_location::current())
+inline Result<void *> LoadFile_IO(SDL_IOStream *src, size_t *datasize, bool closeio, Location location = Location::current())
 {
     void *result = SDL_LoadFile_IO(src, datasize, closeio);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline void *LoadFile(const char *file, size_t *datasize, std::source_location location = std::source_location::current())
+inline Result<void *> LoadFile(const char *file, size_t *datasize, Location location = Location::current())
 {
     void *result = SDL_LoadFile(file, datasize);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline void SaveFile_IO(SDL_IOStream *src, const void *data, size_t datasize, bool closeio, std::source_location location = std::source_location::current())
+inline Result<void> SaveFile_IO(SDL_IOStream *src, const void *data, size_t datasize, bool closeio, Location location = Location::current())
 {
-    if (!SDL_SaveFile_IO(src, data, datasize, closeio))
+    if (!SDL_SaveFile_IO(src, data, datasize, closeio)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SaveFile(const char *file, const void *data, size_t datasize, std::source_location location = std::source_location::current())
+inline Result<void> SaveFile(const char *file, const void *data, size_t datasize, Location location = Location::current())
 {
-    if (!SDL_SaveFile(file, data, datasize))
+    if (!SDL_SaveFile(file, data, datasize)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadU8(SDL_IOStream *src, Uint8 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadU8(SDL_IOStream *src, Uint8 *value, Location location = Location::current())
 {
-    if (!SDL_ReadU8(src, value))
+    if (!SDL_ReadU8(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadS8(SDL_IOStream *src, Sint8 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadS8(SDL_IOStream *src, Sint8 *value, Location location = Location::current())
 {
-    if (!SDL_ReadS8(src, value))
+    if (!SDL_ReadS8(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadU16LE(SDL_IOStream *src, Uint16 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadU16LE(SDL_IOStream *src, Uint16 *value, Location location = Location::current())
 {
-    if (!SDL_ReadU16LE(src, value))
+    if (!SDL_ReadU16LE(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadS16LE(SDL_IOStream *src, Sint16 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadS16LE(SDL_IOStream *src, Sint16 *value, Location location = Location::current())
 {
-    if (!SDL_ReadS16LE(src, value))
+    if (!SDL_ReadS16LE(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadU16BE(SDL_IOStream *src, Uint16 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadU16BE(SDL_IOStream *src, Uint16 *value, Location location = Location::current())
 {
-    if (!SDL_ReadU16BE(src, value))
+    if (!SDL_ReadU16BE(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadS16BE(SDL_IOStream *src, Sint16 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadS16BE(SDL_IOStream *src, Sint16 *value, Location location = Location::current())
 {
-    if (!SDL_ReadS16BE(src, value))
+    if (!SDL_ReadS16BE(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadU32LE(SDL_IOStream *src, Uint32 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadU32LE(SDL_IOStream *src, Uint32 *value, Location location = Location::current())
 {
-    if (!SDL_ReadU32LE(src, value))
+    if (!SDL_ReadU32LE(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadS32LE(SDL_IOStream *src, Sint32 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadS32LE(SDL_IOStream *src, Sint32 *value, Location location = Location::current())
 {
-    if (!SDL_ReadS32LE(src, value))
+    if (!SDL_ReadS32LE(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadU32BE(SDL_IOStream *src, Uint32 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadU32BE(SDL_IOStream *src, Uint32 *value, Location location = Location::current())
 {
-    if (!SDL_ReadU32BE(src, value))
+    if (!SDL_ReadU32BE(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadS32BE(SDL_IOStream *src, Sint32 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadS32BE(SDL_IOStream *src, Sint32 *value, Location location = Location::current())
 {
-    if (!SDL_ReadS32BE(src, value))
+    if (!SDL_ReadS32BE(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadU64LE(SDL_IOStream *src, Uint64 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadU64LE(SDL_IOStream *src, Uint64 *value, Location location = Location::current())
 {
-    if (!SDL_ReadU64LE(src, value))
+    if (!SDL_ReadU64LE(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadS64LE(SDL_IOStream *src, Sint64 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadS64LE(SDL_IOStream *src, Sint64 *value, Location location = Location::current())
 {
-    if (!SDL_ReadS64LE(src, value))
+    if (!SDL_ReadS64LE(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadU64BE(SDL_IOStream *src, Uint64 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadU64BE(SDL_IOStream *src, Uint64 *value, Location location = Location::current())
 {
-    if (!SDL_ReadU64BE(src, value))
+    if (!SDL_ReadU64BE(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadS64BE(SDL_IOStream *src, Sint64 *value, std::source_location location = std::source_location::current())
+inline Result<void> ReadS64BE(SDL_IOStream *src, Sint64 *value, Location location = Location::current())
 {
-    if (!SDL_ReadS64BE(src, value))
+    if (!SDL_ReadS64BE(src, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteU8(SDL_IOStream *dst, Uint8 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteU8(SDL_IOStream *dst, Uint8 value, Location location = Location::current())
 {
-    if (!SDL_WriteU8(dst, value))
+    if (!SDL_WriteU8(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteS8(SDL_IOStream *dst, Sint8 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteS8(SDL_IOStream *dst, Sint8 value, Location location = Location::current())
 {
-    if (!SDL_WriteS8(dst, value))
+    if (!SDL_WriteS8(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteU16LE(SDL_IOStream *dst, Uint16 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteU16LE(SDL_IOStream *dst, Uint16 value, Location location = Location::current())
 {
-    if (!SDL_WriteU16LE(dst, value))
+    if (!SDL_WriteU16LE(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteS16LE(SDL_IOStream *dst, Sint16 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteS16LE(SDL_IOStream *dst, Sint16 value, Location location = Location::current())
 {
-    if (!SDL_WriteS16LE(dst, value))
+    if (!SDL_WriteS16LE(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteU16BE(SDL_IOStream *dst, Uint16 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteU16BE(SDL_IOStream *dst, Uint16 value, Location location = Location::current())
 {
-    if (!SDL_WriteU16BE(dst, value))
+    if (!SDL_WriteU16BE(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteS16BE(SDL_IOStream *dst, Sint16 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteS16BE(SDL_IOStream *dst, Sint16 value, Location location = Location::current())
 {
-    if (!SDL_WriteS16BE(dst, value))
+    if (!SDL_WriteS16BE(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteU32LE(SDL_IOStream *dst, Uint32 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteU32LE(SDL_IOStream *dst, Uint32 value, Location location = Location::current())
 {
-    if (!SDL_WriteU32LE(dst, value))
+    if (!SDL_WriteU32LE(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteS32LE(SDL_IOStream *dst, Sint32 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteS32LE(SDL_IOStream *dst, Sint32 value, Location location = Location::current())
 {
-    if (!SDL_WriteS32LE(dst, value))
+    if (!SDL_WriteS32LE(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteU32BE(SDL_IOStream *dst, Uint32 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteU32BE(SDL_IOStream *dst, Uint32 value, Location location = Location::current())
 {
-    if (!SDL_WriteU32BE(dst, value))
+    if (!SDL_WriteU32BE(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteS32BE(SDL_IOStream *dst, Sint32 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteS32BE(SDL_IOStream *dst, Sint32 value, Location location = Location::current())
 {
-    if (!SDL_WriteS32BE(dst, value))
+    if (!SDL_WriteS32BE(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteU64LE(SDL_IOStream *dst, Uint64 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteU64LE(SDL_IOStream *dst, Uint64 value, Location location = Location::current())
 {
-    if (!SDL_WriteU64LE(dst, value))
+    if (!SDL_WriteU64LE(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteS64LE(SDL_IOStream *dst, Sint64 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteS64LE(SDL_IOStream *dst, Sint64 value, Location location = Location::current())
 {
-    if (!SDL_WriteS64LE(dst, value))
+    if (!SDL_WriteS64LE(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteU64BE(SDL_IOStream *dst, Uint64 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteU64BE(SDL_IOStream *dst, Uint64 value, Location location = Location::current())
 {
-    if (!SDL_WriteU64BE(dst, value))
+    if (!SDL_WriteU64BE(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteS64BE(SDL_IOStream *dst, Sint64 value, std::source_location location = std::source_location::current())
+inline Result<void> WriteS64BE(SDL_IOStream *dst, Sint64 value, Location location = Location::current())
 {
-    if (!SDL_WriteS64BE(dst, value))
+    if (!SDL_WriteS64BE(dst, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline int GetNumAudioDrivers()
@@ -2428,70 +3050,71 @@ inline int GetNumAudioDrivers()
     return SDL_GetNumAudioDrivers();
 }
 
-inline const char *GetAudioDriver(int index, std::source_location location = std::source_location::current())
+inline Result<const char *> GetAudioDriver(int index, Location location = Location::current())
 {
     const char *result = SDL_GetAudioDriver(index);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline const char *GetCurrentAudioDriver(std::source_location location = std::source_location::current())
+inline Result<const char *> GetCurrentAudioDriver(Location location = Location::current())
 {
     const char *result = SDL_GetCurrentAudioDriver();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline SDL_AudioDeviceID *GetAudioPlaybackDevices(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_AudioDeviceID *> GetAudioPlaybackDevices(int *count, Location location = Location::current())
 {
     SDL_AudioDeviceID *result = SDL_GetAudioPlaybackDevices(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_AudioDeviceID *>(location);
     }
     return result;
 }
 
-inline SDL_AudioDeviceID *GetAudioRecordingDevices(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_AudioDeviceID *> GetAudioRecordingDevices(int *count, Location location = Location::current())
 {
     SDL_AudioDeviceID *result = SDL_GetAudioRecordingDevices(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_AudioDeviceID *>(location);
     }
     return result;
 }
 
-inline const char *GetAudioDeviceName(SDL_AudioDeviceID devid, std::source_location location = std::source_location::current())
+inline Result<const char *> GetAudioDeviceName(SDL_AudioDeviceID devid, Location location = Location::current())
 {
     const char *result = SDL_GetAudioDeviceName(devid);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline void GetAudioDeviceFormat(SDL_AudioDeviceID devid, SDL_AudioSpec *spec, int *sample_frames, std::source_location location = std::source_location::current())
+inline Result<void> GetAudioDeviceFormat(SDL_AudioDeviceID devid, SDL_AudioSpec *spec, int *sample_frames, Location location = Location::current())
 {
-    if (!SDL_GetAudioDeviceFormat(devid, spec, sample_frames))
+    if (!SDL_GetAudioDeviceFormat(devid, spec, sample_frames)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline int *GetAudioDeviceChannelMap(SDL_AudioDeviceID devid, int *count, std::source_location location = std::source_location::current())
+inline Result<int *> GetAudioDeviceChannelMap(SDL_AudioDeviceID devid, int *count, Location location = Location::current())
 {
     int *result = SDL_GetAudioDeviceChannelMap(devid, count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<int *>(location);
     }
     return result;
 }
@@ -2501,44 +3124,37 @@ inline SDL_AudioDeviceID OpenAudioDevice(SDL_AudioDeviceID devid, const SDL_Audi
     return SDL_OpenAudioDevice(devid, spec);
 }
 
-inline void IsAudioDevicePhysical(SDL_AudioDeviceID devid, std::source_location location = std::source_location::current())
+inline bool IsAudioDevicePhysical(SDL_AudioDeviceID devid)
 {
-    if (!SDL_IsAudioDevicePhysical(devid))
-    {
-        SDLThrow(location);
-    }
+    return SDL_IsAudioDevicePhysical(devid);
 }
 
-inline void IsAudioDevicePlayback(SDL_AudioDeviceID devid, std::source_location location = std::source_location::current())
+inline bool IsAudioDevicePlayback(SDL_AudioDeviceID devid)
 {
-    if (!SDL_IsAudioDevicePlayback(devid))
-    {
-        SDLThrow(location);
-    }
+    return SDL_IsAudioDevicePlayback(devid);
 }
 
-inline void PauseAudioDevice(SDL_AudioDeviceID devid, std::source_location location = std::source_location::current())
+inline Result<void> PauseAudioDevice(SDL_AudioDeviceID devid, Location location = Location::current())
 {
-    if (!SDL_PauseAudioDevice(devid))
+    if (!SDL_PauseAudioDevice(devid)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ResumeAudioDevice(SDL_AudioDeviceID devid, std::source_location location = std::source_location::current())
+inline Result<void> ResumeAudioDevice(SDL_AudioDeviceID devid, Location location = Location::current())
 {
-    if (!SDL_ResumeAudioDevice(devid))
+    if (!SDL_ResumeAudioDevice(devid)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void AudioDevicePaused(SDL_AudioDeviceID devid, std::source_location location = std::source_location::current())
+inline bool AudioDevicePaused(SDL_AudioDeviceID devid)
 {
-    if (!SDL_AudioDevicePaused(devid))
-    {
-        SDLThrow(location);
-    }
+    return SDL_AudioDevicePaused(devid);
 }
 
 inline float GetAudioDeviceGain(SDL_AudioDeviceID devid)
@@ -2546,12 +3162,13 @@ inline float GetAudioDeviceGain(SDL_AudioDeviceID devid)
     return SDL_GetAudioDeviceGain(devid);
 }
 
-inline void SetAudioDeviceGain(SDL_AudioDeviceID devid, float gain, std::source_location location = std::source_location::current())
+inline Result<void> SetAudioDeviceGain(SDL_AudioDeviceID devid, float gain, Location location = Location::current())
 {
-    if (!SDL_SetAudioDeviceGain(devid, gain))
+    if (!SDL_SetAudioDeviceGain(devid, gain)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void CloseAudioDevice(SDL_AudioDeviceID devid)
@@ -2559,20 +3176,22 @@ inline void CloseAudioDevice(SDL_AudioDeviceID devid)
     SDL_CloseAudioDevice(devid);
 }
 
-inline void BindAudioStreams(SDL_AudioDeviceID devid, SDL_AudioStream *const *streams, int num_streams, std::source_location location = std::source_location::current())
+inline Result<void> BindAudioStreams(SDL_AudioDeviceID devid, SDL_AudioStream *const *streams, int num_streams, Location location = Location::current())
 {
-    if (!SDL_BindAudioStreams(devid, streams, num_streams))
+    if (!SDL_BindAudioStreams(devid, streams, num_streams)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void BindAudioStream(SDL_AudioDeviceID devid, SDL_AudioStream *stream, std::source_location location = std::source_location::current())
+inline Result<void> BindAudioStream(SDL_AudioDeviceID devid, SDL_AudioStream *stream, Location location = Location::current())
 {
-    if (!SDL_BindAudioStream(devid, stream))
+    if (!SDL_BindAudioStream(devid, stream)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void UnbindAudioStreams(SDL_AudioStream *const *streams, int num_streams)
@@ -2590,12 +3209,12 @@ inline SDL_AudioDeviceID GetAudioStreamDevice(SDL_AudioStream *stream)
     return SDL_GetAudioStreamDevice(stream);
 }
 
-inline SDL_AudioStream *CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec, std::source_location location = std::source_location::current())
+inline Result<SDL_AudioStream *> CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec, Location location = Location::current())
 {
     SDL_AudioStream *result = SDL_CreateAudioStream(src_spec, dst_spec);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_AudioStream *>(location);
     }
     return result;
 }
@@ -2605,20 +3224,22 @@ inline SDL_PropertiesID GetAudioStreamProperties(SDL_AudioStream *stream)
     return SDL_GetAudioStreamProperties(stream);
 }
 
-inline void GetAudioStreamFormat(SDL_AudioStream *stream, SDL_AudioSpec *src_spec, SDL_AudioSpec *dst_spec, std::source_location location = std::source_location::current())
+inline Result<void> GetAudioStreamFormat(SDL_AudioStream *stream, SDL_AudioSpec *src_spec, SDL_AudioSpec *dst_spec, Location location = Location::current())
 {
-    if (!SDL_GetAudioStreamFormat(stream, src_spec, dst_spec))
+    if (!SDL_GetAudioStreamFormat(stream, src_spec, dst_spec)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec, std::source_location location = std::source_location::current())
+inline Result<void> SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_spec, const SDL_AudioSpec *dst_spec, Location location = Location::current())
 {
-    if (!SDL_SetAudioStreamFormat(stream, src_spec, dst_spec))
+    if (!SDL_SetAudioStreamFormat(stream, src_spec, dst_spec)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline float GetAudioStreamFrequencyRatio(SDL_AudioStream *stream)
@@ -2626,12 +3247,13 @@ inline float GetAudioStreamFrequencyRatio(SDL_AudioStream *stream)
     return SDL_GetAudioStreamFrequencyRatio(stream);
 }
 
-inline void SetAudioStreamFrequencyRatio(SDL_AudioStream *stream, float ratio, std::source_location location = std::source_location::current())
+inline Result<void> SetAudioStreamFrequencyRatio(SDL_AudioStream *stream, float ratio, Location location = Location::current())
 {
-    if (!SDL_SetAudioStreamFrequencyRatio(stream, ratio))
+    if (!SDL_SetAudioStreamFrequencyRatio(stream, ratio)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline float GetAudioStreamGain(SDL_AudioStream *stream)
@@ -2639,56 +3261,60 @@ inline float GetAudioStreamGain(SDL_AudioStream *stream)
     return SDL_GetAudioStreamGain(stream);
 }
 
-inline void SetAudioStreamGain(SDL_AudioStream *stream, float gain, std::source_location location = std::source_location::current())
+inline Result<void> SetAudioStreamGain(SDL_AudioStream *stream, float gain, Location location = Location::current())
 {
-    if (!SDL_SetAudioStreamGain(stream, gain))
+    if (!SDL_SetAudioStreamGain(stream, gain)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline int *GetAudioStreamInputChannelMap(SDL_AudioStream *stream, int *count, std::source_location location = std::source_location::current())
+inline Result<int *> GetAudioStreamInputChannelMap(SDL_AudioStream *stream, int *count, Location location = Location::current())
 {
     int *result = SDL_GetAudioStreamInputChannelMap(stream, count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<int *>(location);
     }
     return result;
 }
 
-inline int *GetAudioStreamOutputChannelMap(SDL_AudioStream *stream, int *count, std::source_location location = std::source_location::current())
+inline Result<int *> GetAudioStreamOutputChannelMap(SDL_AudioStream *stream, int *count, Location location = Location::current())
 {
     int *result = SDL_GetAudioStreamOutputChannelMap(stream, count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<int *>(location);
     }
     return result;
 }
 
-inline void SetAudioStreamInputChannelMap(SDL_AudioStream *stream, const int *chmap, int count, std::source_location location = std::source_location::current())
+inline Result<void> SetAudioStreamInputChannelMap(SDL_AudioStream *stream, const int *chmap, int count, Location location = Location::current())
 {
-    if (!SDL_SetAudioStreamInputChannelMap(stream, chmap, count))
+    if (!SDL_SetAudioStreamInputChannelMap(stream, chmap, count)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetAudioStreamOutputChannelMap(SDL_AudioStream *stream, const int *chmap, int count, std::source_location location = std::source_location::current())
+inline Result<void> SetAudioStreamOutputChannelMap(SDL_AudioStream *stream, const int *chmap, int count, Location location = Location::current())
 {
-    if (!SDL_SetAudioStreamOutputChannelMap(stream, chmap, count))
+    if (!SDL_SetAudioStreamOutputChannelMap(stream, chmap, count)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len, std::source_location location = std::source_location::current())
+inline Result<void> PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len, Location location = Location::current())
 {
-    if (!SDL_PutAudioStreamData(stream, buf, len))
+    if (!SDL_PutAudioStreamData(stream, buf, len)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline int GetAudioStreamData(SDL_AudioStream *stream, void *buf, int len)
@@ -2706,76 +3332,81 @@ inline int GetAudioStreamQueued(SDL_AudioStream *stream)
     return SDL_GetAudioStreamQueued(stream);
 }
 
-inline void FlushAudioStream(SDL_AudioStream *stream, std::source_location location = std::source_location::current())
+inline Result<void> FlushAudioStream(SDL_AudioStream *stream, Location location = Location::current())
 {
-    if (!SDL_FlushAudioStream(stream))
+    if (!SDL_FlushAudioStream(stream)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ClearAudioStream(SDL_AudioStream *stream, std::source_location location = std::source_location::current())
+inline Result<void> ClearAudioStream(SDL_AudioStream *stream, Location location = Location::current())
 {
-    if (!SDL_ClearAudioStream(stream))
+    if (!SDL_ClearAudioStream(stream)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void PauseAudioStreamDevice(SDL_AudioStream *stream, std::source_location location = std::source_location::current())
+inline Result<void> PauseAudioStreamDevice(SDL_AudioStream *stream, Location location = Location::current())
 {
-    if (!SDL_PauseAudioStreamDevice(stream))
+    if (!SDL_PauseAudioStreamDevice(stream)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ResumeAudioStreamDevice(SDL_AudioStream *stream, std::source_location location = std::source_location::current())
+inline Result<void> ResumeAudioStreamDevice(SDL_AudioStream *stream, Location location = Location::current())
 {
-    if (!SDL_ResumeAudioStreamDevice(stream))
+    if (!SDL_ResumeAudioStreamDevice(stream)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void AudioStreamDevicePaused(SDL_AudioStream *stream, std::source_location location = std::source_location::current())
+inline bool AudioStreamDevicePaused(SDL_AudioStream *stream)
 {
-    if (!SDL_AudioStreamDevicePaused(stream))
-    {
-        SDLThrow(location);
-    }
+    return SDL_AudioStreamDevicePaused(stream);
 }
 
-inline void LockAudioStream(SDL_AudioStream *stream, std::source_location location = std::source_location::current())
+inline Result<void> LockAudioStream(SDL_AudioStream *stream, Location location = Location::current())
 {
-    if (!SDL_LockAudioStream(stream))
+    if (!SDL_LockAudioStream(stream)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void UnlockAudioStream(SDL_AudioStream *stream, std::source_location location = std::source_location::current())
+inline Result<void> UnlockAudioStream(SDL_AudioStream *stream, Location location = Location::current())
 {
-    if (!SDL_UnlockAudioStream(stream))
+    if (!SDL_UnlockAudioStream(stream)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetAudioStreamGetCallback(SDL_AudioStream *stream, SDL_AudioStreamCallback callback, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> SetAudioStreamGetCallback(SDL_AudioStream *stream, SDL_AudioStreamCallback callback, void *userdata, Location location = Location::current())
 {
-    if (!SDL_SetAudioStreamGetCallback(stream, callback, userdata))
+    if (!SDL_SetAudioStreamGetCallback(stream, callback, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetAudioStreamPutCallback(SDL_AudioStream *stream, SDL_AudioStreamCallback callback, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> SetAudioStreamPutCallback(SDL_AudioStream *stream, SDL_AudioStreamCallback callback, void *userdata, Location location = Location::current())
 {
-    if (!SDL_SetAudioStreamPutCallback(stream, callback, userdata))
+    if (!SDL_SetAudioStreamPutCallback(stream, callback, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void DestroyAudioStream(SDL_AudioStream *stream)
@@ -2783,62 +3414,67 @@ inline void DestroyAudioStream(SDL_AudioStream *stream)
     SDL_DestroyAudioStream(stream);
 }
 
-inline SDL_AudioStream *OpenAudioDeviceStream(SDL_AudioDeviceID devid, const SDL_AudioSpec *spec, SDL_AudioStreamCallback callback, void *userdata, std::source_location location = std::source_location::current())
+inline Result<SDL_AudioStream *> OpenAudioDeviceStream(SDL_AudioDeviceID devid, const SDL_AudioSpec *spec, SDL_AudioStreamCallback callback, void *userdata, Location location = Location::current())
 {
     SDL_AudioStream *result = SDL_OpenAudioDeviceStream(devid, spec, callback, userdata);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_AudioStream *>(location);
     }
     return result;
 }
 
-inline void SetAudioPostmixCallback(SDL_AudioDeviceID devid, SDL_AudioPostmixCallback callback, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> SetAudioPostmixCallback(SDL_AudioDeviceID devid, SDL_AudioPostmixCallback callback, void *userdata, Location location = Location::current())
 {
-    if (!SDL_SetAudioPostmixCallback(devid, callback, userdata))
+    if (!SDL_SetAudioPostmixCallback(devid, callback, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void LoadWAV_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len, std::source_location location = std::source_location::current())
+inline Result<void> LoadWAV_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len, Location location = Location::current())
 {
-    if (!SDL_LoadWAV_IO(src, closeio, spec, audio_buf, audio_len))
+    if (!SDL_LoadWAV_IO(src, closeio, spec, audio_buf, audio_len)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len, std::source_location location = std::source_location::current())
+inline Result<void> LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len, Location location = Location::current())
 {
-    if (!SDL_LoadWAV(path, spec, audio_buf, audio_len))
+    if (!SDL_LoadWAV(path, spec, audio_buf, audio_len)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 len, float volume, std::source_location location = std::source_location::current())
+inline Result<void> MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format, Uint32 len, float volume, Location location = Location::current())
 {
-    if (!SDL_MixAudio(dst, src, format, len, volume))
+    if (!SDL_MixAudio(dst, src, format, len, volume)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ConvertAudioSamples(const SDL_AudioSpec *src_spec, const Uint8 *src_data, int src_len, const SDL_AudioSpec *dst_spec, Uint8 **dst_data, int *dst_len, std::source_location location = std::source_location::current())
+inline Result<void> ConvertAudioSamples(const SDL_AudioSpec *src_spec, const Uint8 *src_data, int src_len, const SDL_AudioSpec *dst_spec, Uint8 **dst_data, int *dst_len, Location location = Location::current())
 {
-    if (!SDL_ConvertAudioSamples(src_spec, src_data, src_len, dst_spec, dst_data, dst_len))
+    if (!SDL_ConvertAudioSamples(src_spec, src_data, src_len, dst_spec, dst_data, dst_len)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline const char *GetAudioFormatName(SDL_AudioFormat format, std::source_location location = std::source_location::current())
+inline Result<const char *> GetAudioFormatName(SDL_AudioFormat format, Location location = Location::current())
 {
     const char *result = SDL_GetAudioFormatName(format);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -2853,12 +3489,9 @@ inline int MostSignificantBitIndex32(Uint32 x)
     return SDL_MostSignificantBitIndex32(x);
 }
 
-inline void HasExactlyOneBitSet32(Uint32 x, std::source_location location = std::source_location::current())
+inline bool HasExactlyOneBitSet32(Uint32 x)
 {
-    if (!SDL_HasExactlyOneBitSet32(x))
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasExactlyOneBitSet32(x);
 }
 
 inline SDL_BlendMode ComposeCustomBlendMode(SDL_BlendFactor srcColorFactor, SDL_BlendFactor dstColorFactor, SDL_BlendOperation colorOperation, SDL_BlendFactor srcAlphaFactor, SDL_BlendFactor dstAlphaFactor, SDL_BlendOperation alphaOperation)
@@ -2866,22 +3499,23 @@ inline SDL_BlendMode ComposeCustomBlendMode(SDL_BlendFactor srcColorFactor, SDL_
     return SDL_ComposeCustomBlendMode(srcColorFactor, dstColorFactor, colorOperation, srcAlphaFactor, dstAlphaFactor, alphaOperation);
 }
 
-inline const char *GetPixelFormatName(SDL_PixelFormat format, std::source_location location = std::source_location::current())
+inline Result<const char *> GetPixelFormatName(SDL_PixelFormat format, Location location = Location::current())
 {
     const char *result = SDL_GetPixelFormatName(format);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline void GetMasksForPixelFormat(SDL_PixelFormat format, int *bpp, Uint32 *Rmask, Uint32 *Gmask, Uint32 *Bmask, Uint32 *Amask, std::source_location location = std::source_location::current())
+inline Result<void> GetMasksForPixelFormat(SDL_PixelFormat format, int *bpp, Uint32 *Rmask, Uint32 *Gmask, Uint32 *Bmask, Uint32 *Amask, Location location = Location::current())
 {
-    if (!SDL_GetMasksForPixelFormat(format, bpp, Rmask, Gmask, Bmask, Amask))
+    if (!SDL_GetMasksForPixelFormat(format, bpp, Rmask, Gmask, Bmask, Amask)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline SDL_PixelFormat GetPixelFormatForMasks(int bpp, Uint32 Rmask, Uint32 Gmask, Uint32 Bmask, Uint32 Amask)
@@ -2889,32 +3523,33 @@ inline SDL_PixelFormat GetPixelFormatForMasks(int bpp, Uint32 Rmask, Uint32 Gmas
     return SDL_GetPixelFormatForMasks(bpp, Rmask, Gmask, Bmask, Amask);
 }
 
-inline const SDL_PixelFormatDetails *GetPixelFormatDetails(SDL_PixelFormat format, std::source_location location = std::source_location::current())
+inline Result<const SDL_PixelFormatDetails *> GetPixelFormatDetails(SDL_PixelFormat format, Location location = Location::current())
 {
     const SDL_PixelFormatDetails *result = SDL_GetPixelFormatDetails(format);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const SDL_PixelFormatDetails *>(location);
     }
     return result;
 }
 
-inline SDL_Palette *CreatePalette(int ncolors, std::source_location location = std::source_location::current())
+inline Result<SDL_Palette *> CreatePalette(int ncolors, Location location = Location::current())
 {
     SDL_Palette *result = SDL_CreatePalette(ncolors);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Palette *>(location);
     }
     return result;
 }
 
-inline void SetPaletteColors(SDL_Palette *palette, const SDL_Color *colors, int firstcolor, int ncolors, std::source_location location = std::source_location::current())
+inline Result<void> SetPaletteColors(SDL_Palette *palette, const SDL_Color *colors, int firstcolor, int ncolors, Location location = Location::current())
 {
-    if (!SDL_SetPaletteColors(palette, colors, firstcolor, ncolors))
+    if (!SDL_SetPaletteColors(palette, colors, firstcolor, ncolors)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void DestroyPalette(SDL_Palette *palette)
@@ -2947,158 +3582,115 @@ inline void RectToFRect(const SDL_Rect *rect, SDL_FRect *frect)
     SDL_RectToFRect(rect, frect);
 }
 
-inline void PointInRect(const SDL_Point *p, const SDL_Rect *r, std::source_location location = std::source_location::current())
+inline bool PointInRect(const SDL_Point *p, const SDL_Rect *r)
 {
-    if (!SDL_PointInRect(p, r))
-    {
-        SDLThrow(location);
-    }
+    return SDL_PointInRect(p, r);
 }
 
-inline void RectEmpty(const SDL_Rect *r, std::source_location location = std::source_location::current())
+inline bool RectEmpty(const SDL_Rect *r)
 {
-    if (!SDL_RectEmpty(r))
-    {
-        SDLThrow(location);
-    }
+    return SDL_RectEmpty(r);
 }
 
-inline void RectsEqual(const SDL_Rect *a, const SDL_Rect *b, std::source_location location = std::source_location::current())
+inline bool RectsEqual(const SDL_Rect *a, const SDL_Rect *b)
 {
-    if (!SDL_RectsEqual(a, b))
-    {
-        SDLThrow(location);
-    }
+    return SDL_RectsEqual(a, b);
 }
 
-inline void HasRectIntersection(const SDL_Rect *A, const SDL_Rect *B, std::source_location location = std::source_location::current())
+inline bool HasRectIntersection(const SDL_Rect *A, const SDL_Rect *B)
 {
-    if (!SDL_HasRectIntersection(A, B))
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasRectIntersection(A, B);
 }
 
-inline void GetRectIntersection(const SDL_Rect *A, const SDL_Rect *B, SDL_Rect *result, std::source_location location = std::source_location::current())
+inline bool GetRectIntersection(const SDL_Rect *A, const SDL_Rect *B, SDL_Rect *result)
 {
-    if (!SDL_GetRectIntersection(A, B, result))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetRectIntersection(A, B, result);
 }
 
-inline void GetRectUnion(const SDL_Rect *A, const SDL_Rect *B, SDL_Rect *result, std::source_location location = std::source_location::current())
+inline Result<void> GetRectUnion(const SDL_Rect *A, const SDL_Rect *B, SDL_Rect *result, Location location = Location::current())
 {
-    if (!SDL_GetRectUnion(A, B, result))
+    if (!SDL_GetRectUnion(A, B, result)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetRectEnclosingPoints(const SDL_Point *points, int count, const SDL_Rect *clip, SDL_Rect *result, std::source_location location = std::source_location::current())
+inline bool GetRectEnclosingPoints(const SDL_Point *points, int count, const SDL_Rect *clip, SDL_Rect *result)
 {
-    if (!SDL_GetRectEnclosingPoints(points, count, clip, result))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetRectEnclosingPoints(points, count, clip, result);
 }
 
-inline void GetRectAndLineIntersection(const SDL_Rect *rect, int *X1, int *Y1, int *X2, int *Y2, std::source_location location = std::source_location::current())
+inline bool GetRectAndLineIntersection(const SDL_Rect *rect, int *X1, int *Y1, int *X2, int *Y2)
 {
-    if (!SDL_GetRectAndLineIntersection(rect, X1, Y1, X2, Y2))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetRectAndLineIntersection(rect, X1, Y1, X2, Y2);
 }
 
-inline void PointInRectFloat(const SDL_FPoint *p, const SDL_FRect *r, std::source_location location = std::source_location::current())
+inline bool PointInRectFloat(const SDL_FPoint *p, const SDL_FRect *r)
 {
-    if (!SDL_PointInRectFloat(p, r))
-    {
-        SDLThrow(location);
-    }
+    return SDL_PointInRectFloat(p, r);
 }
 
-inline void RectEmptyFloat(const SDL_FRect *r, std::source_location location = std::source_location::current())
+inline bool RectEmptyFloat(const SDL_FRect *r)
 {
-    if (!SDL_RectEmptyFloat(r))
-    {
-        SDLThrow(location);
-    }
+    return SDL_RectEmptyFloat(r);
 }
 
-inline void RectsEqualEpsilon(const SDL_FRect *a, const SDL_FRect *b, float epsilon, std::source_location location = std::source_location::current())
+inline bool RectsEqualEpsilon(const SDL_FRect *a, const SDL_FRect *b, float epsilon)
 {
-    if (!SDL_RectsEqualEpsilon(a, b, epsilon))
-    {
-        SDLThrow(location);
-    }
+    return SDL_RectsEqualEpsilon(a, b, epsilon);
 }
 
-inline void RectsEqualFloat(const SDL_FRect *a, const SDL_FRect *b, std::source_location location = std::source_location::current())
+inline bool RectsEqualFloat(const SDL_FRect *a, const SDL_FRect *b)
 {
-    if (!SDL_RectsEqualFloat(a, b))
-    {
-        SDLThrow(location);
-    }
+    return SDL_RectsEqualFloat(a, b);
 }
 
-inline void HasRectIntersectionFloat(const SDL_FRect *A, const SDL_FRect *B, std::source_location location = std::source_location::current())
+inline bool HasRectIntersectionFloat(const SDL_FRect *A, const SDL_FRect *B)
 {
-    if (!SDL_HasRectIntersectionFloat(A, B))
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasRectIntersectionFloat(A, B);
 }
 
-inline void GetRectIntersectionFloat(const SDL_FRect *A, const SDL_FRect *B, SDL_FRect *result, std::source_location location = std::source_location::current())
+inline bool GetRectIntersectionFloat(const SDL_FRect *A, const SDL_FRect *B, SDL_FRect *result)
 {
-    if (!SDL_GetRectIntersectionFloat(A, B, result))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetRectIntersectionFloat(A, B, result);
 }
 
-inline void GetRectUnionFloat(const SDL_FRect *A, const SDL_FRect *B, SDL_FRect *result, std::source_location location = std::source_location::current())
+inline Result<void> GetRectUnionFloat(const SDL_FRect *A, const SDL_FRect *B, SDL_FRect *result, Location location = Location::current())
 {
-    if (!SDL_GetRectUnionFloat(A, B, result))
+    if (!SDL_GetRectUnionFloat(A, B, result)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetRectEnclosingPointsFloat(const SDL_FPoint *points, int count, const SDL_FRect *clip, SDL_FRect *result, std::source_location location = std::source_location::current())
+inline bool GetRectEnclosingPointsFloat(const SDL_FPoint *points, int count, const SDL_FRect *clip, SDL_FRect *result)
 {
-    if (!SDL_GetRectEnclosingPointsFloat(points, count, clip, result))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetRectEnclosingPointsFloat(points, count, clip, result);
 }
 
-inline void GetRectAndLineIntersectionFloat(const SDL_FRect *rect, float *X1, float *Y1, float *X2, float *Y2, std::source_location location = std::source_location::current())
+inline bool GetRectAndLineIntersectionFloat(const SDL_FRect *rect, float *X1, float *Y1, float *X2, float *Y2)
 {
-    if (!SDL_GetRectAndLineIntersectionFloat(rect, X1, Y1, X2, Y2))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetRectAndLineIntersectionFloat(rect, X1, Y1, X2, Y2);
 }
 
-inline SDL_Surface *CreateSurface(int width, int height, SDL_PixelFormat format, std::source_location location = std::source_location::current())
+inline Result<SDL_Surface *> CreateSurface(int width, int height, SDL_PixelFormat format, Location location = Location::current())
 {
     SDL_Surface *result = SDL_CreateSurface(width, height, format);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Surface *>(location);
     }
     return result;
 }
 
-inline SDL_Surface *CreateSurfaceFrom(int width, int height, SDL_PixelFormat format, void *pixels, int pitch, std::source_location location = std::source_location::current())
+inline Result<SDL_Surface *> CreateSurfaceFrom(int width, int height, SDL_PixelFormat format, void *pixels, int pitch, Location location = Location::current())
 {
     SDL_Surface *result = SDL_CreateSurfaceFrom(width, height, format, pixels, pitch);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Surface *>(location);
     }
     return result;
 }
@@ -3113,12 +3705,13 @@ inline SDL_PropertiesID GetSurfaceProperties(SDL_Surface *surface)
     return SDL_GetSurfaceProperties(surface);
 }
 
-inline void SetSurfaceColorspace(SDL_Surface *surface, SDL_Colorspace colorspace, std::source_location location = std::source_location::current())
+inline Result<void> SetSurfaceColorspace(SDL_Surface *surface, SDL_Colorspace colorspace, Location location = Location::current())
 {
-    if (!SDL_SetSurfaceColorspace(surface, colorspace))
+    if (!SDL_SetSurfaceColorspace(surface, colorspace)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline SDL_Colorspace GetSurfaceColorspace(SDL_Surface *surface)
@@ -3126,56 +3719,55 @@ inline SDL_Colorspace GetSurfaceColorspace(SDL_Surface *surface)
     return SDL_GetSurfaceColorspace(surface);
 }
 
-inline SDL_Palette *CreateSurfacePalette(SDL_Surface *surface, std::source_location location = std::source_location::current())
+inline Result<SDL_Palette *> CreateSurfacePalette(SDL_Surface *surface, Location location = Location::current())
 {
     SDL_Palette *result = SDL_CreateSurfacePalette(surface);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Palette *>(location);
     }
     return result;
 }
 
-inline void SetSurfacePalette(SDL_Surface *surface, SDL_Palette *palette, std::source_location location = std::source_location::current())
+inline Result<void> SetSurfacePalette(SDL_Surface *surface, SDL_Palette *palette, Location location = Location::current())
 {
-    if (!SDL_SetSurfacePalette(surface, palette))
+    if (!SDL_SetSurfacePalette(surface, palette)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_Palette *GetSurfacePalette(SDL_Surface *surface, std::source_location location = std::source_location::current())
+inline Result<SDL_Palette *> GetSurfacePalette(SDL_Surface *surface, Location location = Location::current())
 {
     SDL_Palette *result = SDL_GetSurfacePalette(surface);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Palette *>(location);
     }
     return result;
 }
 
-inline void AddSurfaceAlternateImage(SDL_Surface *surface, SDL_Surface *image, std::source_location location = std::source_location::current())
+inline Result<void> AddSurfaceAlternateImage(SDL_Surface *surface, SDL_Surface *image, Location location = Location::current())
 {
-    if (!SDL_AddSurfaceAlternateImage(surface, image))
+    if (!SDL_AddSurfaceAlternateImage(surface, image)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SurfaceHasAlternateImages(SDL_Surface *surface, std::source_location location = std::source_location::current())
+inline bool SurfaceHasAlternateImages(SDL_Surface *surface)
 {
-    if (!SDL_SurfaceHasAlternateImages(surface))
-    {
-        SDLThrow(location);
-    }
+    return SDL_SurfaceHasAlternateImages(surface);
 }
 
-inline SDL_Surface **GetSurfaceImages(SDL_Surface *surface, int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_Surface **> GetSurfaceImages(SDL_Surface *surface, int *count, Location location = Location::current())
 {
     SDL_Surface **result = SDL_GetSurfaceImages(surface, count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Surface **>(location);
     }
     return result;
 }
@@ -3185,12 +3777,13 @@ inline void RemoveSurfaceAlternateImages(SDL_Surface *surface)
     SDL_RemoveSurfaceAlternateImages(surface);
 }
 
-inline void LockSurface(SDL_Surface *surface, std::source_location location = std::source_location::current())
+inline Result<void> LockSurface(SDL_Surface *surface, Location location = Location::current())
 {
-    if (!SDL_LockSurface(surface))
+    if (!SDL_LockSurface(surface)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void UnlockSurface(SDL_Surface *surface)
@@ -3198,312 +3791,335 @@ inline void UnlockSurface(SDL_Surface *surface)
     SDL_UnlockSurface(surface);
 }
 
-inline SDL_Surface *LoadBMP_IO(SDL_IOStream *src, bool closeio, std::source_location location = std::source_location::current())
+inline Result<SDL_Surface *> LoadBMP_IO(SDL_IOStream *src, bool closeio, Location location = Location::current())
 {
     SDL_Surface *result = SDL_LoadBMP_IO(src, closeio);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Surface *>(location);
     }
     return result;
 }
 
-inline SDL_Surface *LoadBMP(const char *file, std::source_location location = std::source_location::current())
+inline Result<SDL_Surface *> LoadBMP(const char *file, Location location = Location::current())
 {
     SDL_Surface *result = SDL_LoadBMP(file);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Surface *>(location);
     }
     return result;
 }
 
-inline void SaveBMP_IO(SDL_Surface *surface, SDL_IOStream *dst, bool closeio, std::source_location location = std::source_location::current())
+inline Result<void> SaveBMP_IO(SDL_Surface *surface, SDL_IOStream *dst, bool closeio, Location location = Location::current())
 {
-    if (!SDL_SaveBMP_IO(surface, dst, closeio))
+    if (!SDL_SaveBMP_IO(surface, dst, closeio)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SaveBMP(SDL_Surface *surface, const char *file, std::source_location location = std::source_location::current())
+inline Result<void> SaveBMP(SDL_Surface *surface, const char *file, Location location = Location::current())
 {
-    if (!SDL_SaveBMP(surface, file))
+    if (!SDL_SaveBMP(surface, file)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetSurfaceRLE(SDL_Surface *surface, bool enabled, std::source_location location = std::source_location::current())
+inline Result<void> SetSurfaceRLE(SDL_Surface *surface, bool enabled, Location location = Location::current())
 {
-    if (!SDL_SetSurfaceRLE(surface, enabled))
+    if (!SDL_SetSurfaceRLE(surface, enabled)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SurfaceHasRLE(SDL_Surface *surface, std::source_location location = std::source_location::current())
+inline bool SurfaceHasRLE(SDL_Surface *surface)
 {
-    if (!SDL_SurfaceHasRLE(surface))
-    {
-        SDLThrow(location);
-    }
+    return SDL_SurfaceHasRLE(surface);
 }
 
-inline void SetSurfaceColorKey(SDL_Surface *surface, bool enabled, Uint32 key, std::source_location location = std::source_location::current())
+inline Result<void> SetSurfaceColorKey(SDL_Surface *surface, bool enabled, Uint32 key, Location location = Location::current())
 {
-    if (!SDL_SetSurfaceColorKey(surface, enabled, key))
+    if (!SDL_SetSurfaceColorKey(surface, enabled, key)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SurfaceHasColorKey(SDL_Surface *surface, std::source_location location = std::source_location::current())
+inline bool SurfaceHasColorKey(SDL_Surface *surface)
 {
-    if (!SDL_SurfaceHasColorKey(surface))
-    {
-        SDLThrow(location);
-    }
+    return SDL_SurfaceHasColorKey(surface);
 }
 
-inline void GetSurfaceColorKey(SDL_Surface *surface, Uint32 *key, std::source_location location = std::source_location::current())
+inline Result<void> GetSurfaceColorKey(SDL_Surface *surface, Uint32 *key, Location location = Location::current())
 {
-    if (!SDL_GetSurfaceColorKey(surface, key))
+    if (!SDL_GetSurfaceColorKey(surface, key)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetSurfaceColorMod(SDL_Surface *surface, Uint8 r, Uint8 g, Uint8 b, std::source_location location = std::source_location::current())
+inline Result<void> SetSurfaceColorMod(SDL_Surface *surface, Uint8 r, Uint8 g, Uint8 b, Location location = Location::current())
 {
-    if (!SDL_SetSurfaceColorMod(surface, r, g, b))
+    if (!SDL_SetSurfaceColorMod(surface, r, g, b)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetSurfaceColorMod(SDL_Surface *surface, Uint8 *r, Uint8 *g, Uint8 *b, std::source_location location = std::source_location::current())
+inline Result<void> GetSurfaceColorMod(SDL_Surface *surface, Uint8 *r, Uint8 *g, Uint8 *b, Location location = Location::current())
 {
-    if (!SDL_GetSurfaceColorMod(surface, r, g, b))
+    if (!SDL_GetSurfaceColorMod(surface, r, g, b)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetSurfaceAlphaMod(SDL_Surface *surface, Uint8 alpha, std::source_location location = std::source_location::current())
+inline Result<void> SetSurfaceAlphaMod(SDL_Surface *surface, Uint8 alpha, Location location = Location::current())
 {
-    if (!SDL_SetSurfaceAlphaMod(surface, alpha))
+    if (!SDL_SetSurfaceAlphaMod(surface, alpha)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetSurfaceAlphaMod(SDL_Surface *surface, Uint8 *alpha, std::source_location location = std::source_location::current())
+inline Result<void> GetSurfaceAlphaMod(SDL_Surface *surface, Uint8 *alpha, Location location = Location::current())
 {
-    if (!SDL_GetSurfaceAlphaMod(surface, alpha))
+    if (!SDL_GetSurfaceAlphaMod(surface, alpha)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode blendMode, std::source_location location = std::source_location::current())
+inline Result<void> SetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode blendMode, Location location = Location::current())
 {
-    if (!SDL_SetSurfaceBlendMode(surface, blendMode))
+    if (!SDL_SetSurfaceBlendMode(surface, blendMode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode *blendMode, std::source_location location = std::source_location::current())
+inline Result<void> GetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode *blendMode, Location location = Location::current())
 {
-    if (!SDL_GetSurfaceBlendMode(surface, blendMode))
+    if (!SDL_GetSurfaceBlendMode(surface, blendMode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetSurfaceClipRect(SDL_Surface *surface, const SDL_Rect *rect, std::source_location location = std::source_location::current())
+inline Result<void> SetSurfaceClipRect(SDL_Surface *surface, const SDL_Rect *rect, Location location = Location::current())
 {
-    if (!SDL_SetSurfaceClipRect(surface, rect))
+    if (!SDL_SetSurfaceClipRect(surface, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetSurfaceClipRect(SDL_Surface *surface, SDL_Rect *rect, std::source_location location = std::source_location::current())
+inline Result<void> GetSurfaceClipRect(SDL_Surface *surface, SDL_Rect *rect, Location location = Location::current())
 {
-    if (!SDL_GetSurfaceClipRect(surface, rect))
+    if (!SDL_GetSurfaceClipRect(surface, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void FlipSurface(SDL_Surface *surface, SDL_FlipMode flip, std::source_location location = std::source_location::current())
+inline Result<void> FlipSurface(SDL_Surface *surface, SDL_FlipMode flip, Location location = Location::current())
 {
-    if (!SDL_FlipSurface(surface, flip))
+    if (!SDL_FlipSurface(surface, flip)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_Surface *DuplicateSurface(SDL_Surface *surface, std::source_location location = std::source_location::current())
+inline Result<SDL_Surface *> DuplicateSurface(SDL_Surface *surface, Location location = Location::current())
 {
     SDL_Surface *result = SDL_DuplicateSurface(surface);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Surface *>(location);
     }
     return result;
 }
 
-inline SDL_Surface *ScaleSurface(SDL_Surface *surface, int width, int height, SDL_ScaleMode scaleMode, std::source_location location = std::source_location::current())
+inline Result<SDL_Surface *> ScaleSurface(SDL_Surface *surface, int width, int height, SDL_ScaleMode scaleMode, Location location = Location::current())
 {
     SDL_Surface *result = SDL_ScaleSurface(surface, width, height, scaleMode);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Surface *>(location);
     }
     return result;
 }
 
-inline SDL_Surface *ConvertSurface(SDL_Surface *surface, SDL_PixelFormat format, std::source_location location = std::source_location::current())
+inline Result<SDL_Surface *> ConvertSurface(SDL_Surface *surface, SDL_PixelFormat format, Location location = Location::current())
 {
     SDL_Surface *result = SDL_ConvertSurface(surface, format);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Surface *>(location);
     }
     return result;
 }
 
-inline SDL_Surface *ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelFormat format, SDL_Palette *palette, SDL_Colorspace colorspace, SDL_PropertiesID props, std::source_location location = std::source_location::current())
+inline Result<SDL_Surface *> ConvertSurfaceAndColorspace(SDL_Surface *surface, SDL_PixelFormat format, SDL_Palette *palette, SDL_Colorspace colorspace, SDL_PropertiesID props, Location location = Location::current())
 {
     SDL_Surface *result = SDL_ConvertSurfaceAndColorspace(surface, format, palette, colorspace, props);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Surface *>(location);
     }
     return result;
 }
 
-inline void ConvertPixels(int width, int height, SDL_PixelFormat src_format, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, std::source_location location = std::source_location::current())
+inline Result<void> ConvertPixels(int width, int height, SDL_PixelFormat src_format, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, Location location = Location::current())
 {
-    if (!SDL_ConvertPixels(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch))
+    if (!SDL_ConvertPixels(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ConvertPixelsAndColorspace(int width, int height, SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PropertiesID src_properties, const void *src, int src_pitch, SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, SDL_PropertiesID dst_properties, void *dst, int dst_pitch, std::source_location location = std::source_location::current())
+inline Result<void> ConvertPixelsAndColorspace(int width, int height, SDL_PixelFormat src_format, SDL_Colorspace src_colorspace, SDL_PropertiesID src_properties, const void *src, int src_pitch, SDL_PixelFormat dst_format, SDL_Colorspace dst_colorspace, SDL_PropertiesID dst_properties, void *dst, int dst_pitch, Location location = Location::current())
 {
-    if (!SDL_ConvertPixelsAndColorspace(width, height, src_format, src_colorspace, src_properties, src, src_pitch, dst_format, dst_colorspace, dst_properties, dst, dst_pitch))
+    if (!SDL_ConvertPixelsAndColorspace(width, height, src_format, src_colorspace, src_properties, src, src_pitch, dst_format, dst_colorspace, dst_properties, dst, dst_pitch)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void PremultiplyAlpha(int width, int height, SDL_PixelFormat src_format, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, bool linear, std::source_location location = std::source_location::current())
+inline Result<void> PremultiplyAlpha(int width, int height, SDL_PixelFormat src_format, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, bool linear, Location location = Location::current())
 {
-    if (!SDL_PremultiplyAlpha(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch, linear))
+    if (!SDL_PremultiplyAlpha(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch, linear)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void PremultiplySurfaceAlpha(SDL_Surface *surface, bool linear, std::source_location location = std::source_location::current())
+inline Result<void> PremultiplySurfaceAlpha(SDL_Surface *surface, bool linear, Location location = Location::current())
 {
-    if (!SDL_PremultiplySurfaceAlpha(surface, linear))
+    if (!SDL_PremultiplySurfaceAlpha(surface, linear)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ClearSurface(SDL_Surface *surface, float r, float g, float b, float a, std::source_location location = std::source_location::current())
+inline Result<void> ClearSurface(SDL_Surface *surface, float r, float g, float b, float a, Location location = Location::current())
 {
-    if (!SDL_ClearSurface(surface, r, g, b, a))
+    if (!SDL_ClearSurface(surface, r, g, b, a)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void FillSurfaceRect(SDL_Surface *dst, const SDL_Rect *rect, Uint32 color, std::source_location location = std::source_location::current())
+inline Result<void> FillSurfaceRect(SDL_Surface *dst, const SDL_Rect *rect, Uint32 color, Location location = Location::current())
 {
-    if (!SDL_FillSurfaceRect(dst, rect, color))
+    if (!SDL_FillSurfaceRect(dst, rect, color)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void FillSurfaceRects(SDL_Surface *dst, const SDL_Rect *rects, int count, Uint32 color, std::source_location location = std::source_location::current())
+inline Result<void> FillSurfaceRects(SDL_Surface *dst, const SDL_Rect *rects, int count, Uint32 color, Location location = Location::current())
 {
-    if (!SDL_FillSurfaceRects(dst, rects, count, color))
+    if (!SDL_FillSurfaceRects(dst, rects, count, color)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void BlitSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, std::source_location location = std::source_location::current())
+inline Result<void> BlitSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, Location location = Location::current())
 {
-    if (!SDL_BlitSurface(src, srcrect, dst, dstrect))
+    if (!SDL_BlitSurface(src, srcrect, dst, dstrect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void BlitSurfaceUnchecked(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, std::source_location location = std::source_location::current())
+inline Result<void> BlitSurfaceUnchecked(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, Location location = Location::current())
 {
-    if (!SDL_BlitSurfaceUnchecked(src, srcrect, dst, dstrect))
+    if (!SDL_BlitSurfaceUnchecked(src, srcrect, dst, dstrect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void BlitSurfaceScaled(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode, std::source_location location = std::source_location::current())
+inline Result<void> BlitSurfaceScaled(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode, Location location = Location::current())
 {
-    if (!SDL_BlitSurfaceScaled(src, srcrect, dst, dstrect, scaleMode))
+    if (!SDL_BlitSurfaceScaled(src, srcrect, dst, dstrect, scaleMode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void BlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode, std::source_location location = std::source_location::current())
+inline Result<void> BlitSurfaceUncheckedScaled(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode, Location location = Location::current())
 {
-    if (!SDL_BlitSurfaceUncheckedScaled(src, srcrect, dst, dstrect, scaleMode))
+    if (!SDL_BlitSurfaceUncheckedScaled(src, srcrect, dst, dstrect, scaleMode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode, std::source_location location = std::source_location::current())
+inline Result<void> StretchSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode, Location location = Location::current())
 {
-    if (!SDL_StretchSurface(src, srcrect, dst, dstrect, scaleMode))
+    if (!SDL_StretchSurface(src, srcrect, dst, dstrect, scaleMode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void BlitSurfaceTiled(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, std::source_location location = std::source_location::current())
+inline Result<void> BlitSurfaceTiled(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, Location location = Location::current())
 {
-    if (!SDL_BlitSurfaceTiled(src, srcrect, dst, dstrect))
+    if (!SDL_BlitSurfaceTiled(src, srcrect, dst, dstrect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void BlitSurfaceTiledWithScale(SDL_Surface *src, const SDL_Rect *srcrect, float scale, SDL_ScaleMode scaleMode, SDL_Surface *dst, const SDL_Rect *dstrect, std::source_location location = std::source_location::current())
+inline Result<void> BlitSurfaceTiledWithScale(SDL_Surface *src, const SDL_Rect *srcrect, float scale, SDL_ScaleMode scaleMode, SDL_Surface *dst, const SDL_Rect *dstrect, Location location = Location::current())
 {
-    if (!SDL_BlitSurfaceTiledWithScale(src, srcrect, scale, scaleMode, dst, dstrect))
+    if (!SDL_BlitSurfaceTiledWithScale(src, srcrect, scale, scaleMode, dst, dstrect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void BlitSurface9Grid(SDL_Surface *src, const SDL_Rect *srcrect, int left_width, int right_width, int top_height, int bottom_height, float scale, SDL_ScaleMode scaleMode, SDL_Surface *dst, const SDL_Rect *dstrect, std::source_location location = std::source_location::current())
+inline Result<void> BlitSurface9Grid(SDL_Surface *src, const SDL_Rect *srcrect, int left_width, int right_width, int top_height, int bottom_height, float scale, SDL_ScaleMode scaleMode, SDL_Surface *dst, const SDL_Rect *dstrect, Location location = Location::current())
 {
-    if (!SDL_BlitSurface9Grid(src, srcrect, left_width, right_width, top_height, bottom_height, scale, scaleMode, dst, dstrect))
+    if (!SDL_BlitSurface9Grid(src, srcrect, left_width, right_width, top_height, bottom_height, scale, scaleMode, dst, dstrect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline Uint32 MapSurfaceRGB(SDL_Surface *surface, Uint8 r, Uint8 g, Uint8 b)
@@ -3516,36 +4132,40 @@ inline Uint32 MapSurfaceRGBA(SDL_Surface *surface, Uint8 r, Uint8 g, Uint8 b, Ui
     return SDL_MapSurfaceRGBA(surface, r, g, b, a);
 }
 
-inline void ReadSurfacePixel(SDL_Surface *surface, int x, int y, Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a, std::source_location location = std::source_location::current())
+inline Result<void> ReadSurfacePixel(SDL_Surface *surface, int x, int y, Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a, Location location = Location::current())
 {
-    if (!SDL_ReadSurfacePixel(surface, x, y, r, g, b, a))
+    if (!SDL_ReadSurfacePixel(surface, x, y, r, g, b, a)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadSurfacePixelFloat(SDL_Surface *surface, int x, int y, float *r, float *g, float *b, float *a, std::source_location location = std::source_location::current())
+inline Result<void> ReadSurfacePixelFloat(SDL_Surface *surface, int x, int y, float *r, float *g, float *b, float *a, Location location = Location::current())
 {
-    if (!SDL_ReadSurfacePixelFloat(surface, x, y, r, g, b, a))
+    if (!SDL_ReadSurfacePixelFloat(surface, x, y, r, g, b, a)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteSurfacePixel(SDL_Surface *surface, int x, int y, Uint8 r, Uint8 g, Uint8 b, Uint8 a, std::source_location location = std::source_location::current())
+inline Result<void> WriteSurfacePixel(SDL_Surface *surface, int x, int y, Uint8 r, Uint8 g, Uint8 b, Uint8 a, Location location = Location::current())
 {
-    if (!SDL_WriteSurfacePixel(surface, x, y, r, g, b, a))
+    if (!SDL_WriteSurfacePixel(surface, x, y, r, g, b, a)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteSurfacePixelFloat(SDL_Surface *surface, int x, int y, float r, float g, float b, float a, std::source_location location = std::source_location::current())
+inline Result<void> WriteSurfacePixelFloat(SDL_Surface *surface, int x, int y, float r, float g, float b, float a, Location location = Location::current())
 {
-    if (!SDL_WriteSurfacePixelFloat(surface, x, y, r, g, b, a))
+    if (!SDL_WriteSurfacePixelFloat(surface, x, y, r, g, b, a)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline int GetNumCameraDrivers()
@@ -3553,52 +4173,52 @@ inline int GetNumCameraDrivers()
     return SDL_GetNumCameraDrivers();
 }
 
-inline const char *GetCameraDriver(int index, std::source_location location = std::source_location::current())
+inline Result<const char *> GetCameraDriver(int index, Location location = Location::current())
 {
     const char *result = SDL_GetCameraDriver(index);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline const char *GetCurrentCameraDriver(std::source_location location = std::source_location::current())
+inline Result<const char *> GetCurrentCameraDriver(Location location = Location::current())
 {
     const char *result = SDL_GetCurrentCameraDriver();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline SDL_CameraID *GetCameras(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_CameraID *> GetCameras(int *count, Location location = Location::current())
 {
     SDL_CameraID *result = SDL_GetCameras(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_CameraID *>(location);
     }
     return result;
 }
 
-inline SDL_CameraSpec **GetCameraSupportedFormats(SDL_CameraID instance_id, int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_CameraSpec **> GetCameraSupportedFormats(SDL_CameraID instance_id, int *count, Location location = Location::current())
 {
     SDL_CameraSpec **result = SDL_GetCameraSupportedFormats(instance_id, count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_CameraSpec **>(location);
     }
     return result;
 }
 
-inline const char *GetCameraName(SDL_CameraID instance_id, std::source_location location = std::source_location::current())
+inline Result<const char *> GetCameraName(SDL_CameraID instance_id, Location location = Location::current())
 {
     const char *result = SDL_GetCameraName(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -3608,12 +4228,12 @@ inline SDL_CameraPosition GetCameraPosition(SDL_CameraID instance_id)
     return SDL_GetCameraPosition(instance_id);
 }
 
-inline SDL_Camera *OpenCamera(SDL_CameraID instance_id, const SDL_CameraSpec *spec, std::source_location location = std::source_location::current())
+inline Result<SDL_Camera *> OpenCamera(SDL_CameraID instance_id, const SDL_CameraSpec *spec, Location location = Location::current())
 {
     SDL_Camera *result = SDL_OpenCamera(instance_id, spec);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Camera *>(location);
     }
     return result;
 }
@@ -3633,20 +4253,21 @@ inline SDL_PropertiesID GetCameraProperties(SDL_Camera *camera)
     return SDL_GetCameraProperties(camera);
 }
 
-inline void GetCameraFormat(SDL_Camera *camera, SDL_CameraSpec *spec, std::source_location location = std::source_location::current())
+inline Result<void> GetCameraFormat(SDL_Camera *camera, SDL_CameraSpec *spec, Location location = Location::current())
 {
-    if (!SDL_GetCameraFormat(camera, spec))
+    if (!SDL_GetCameraFormat(camera, spec)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_Surface *AcquireCameraFrame(SDL_Camera *camera, Uint64 *timestampNS, std::source_location location = std::source_location::current())
+inline Result<SDL_Surface *> AcquireCameraFrame(SDL_Camera *camera, Uint64 *timestampNS, Location location = Location::current())
 {
     SDL_Surface *result = SDL_AcquireCameraFrame(camera, timestampNS);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Surface *>(location);
     }
     return result;
 }
@@ -3661,98 +4282,93 @@ inline void CloseCamera(SDL_Camera *camera)
     SDL_CloseCamera(camera);
 }
 
-inline void SetClipboardText(const char *text, std::source_location location = std::source_location::current())
+inline Result<void> SetClipboardText(const char *text, Location location = Location::current())
 {
-    if (!SDL_SetClipboardText(text))
+    if (!SDL_SetClipboardText(text)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline char *GetClipboardText(std::source_location location = std::source_location::current())
+inline Result<char *> GetClipboardText(Location location = Location::current())
 {
     char *result = SDL_GetClipboardText();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline void HasClipboardText(std::source_location location = std::source_location::current())
+inline bool HasClipboardText()
 {
-    if (!SDL_HasClipboardText())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasClipboardText();
 }
 
-inline void SetPrimarySelectionText(const char *text, std::source_location location = std::source_location::current())
+inline Result<void> SetPrimarySelectionText(const char *text, Location location = Location::current())
 {
-    if (!SDL_SetPrimarySelectionText(text))
+    if (!SDL_SetPrimarySelectionText(text)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline char *GetPrimarySelectionText(std::source_location location = std::source_location::current())
+inline Result<char *> GetPrimarySelectionText(Location location = Location::current())
 {
     char *result = SDL_GetPrimarySelectionText();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline void HasPrimarySelectionText(std::source_location location = std::source_location::current())
+inline bool HasPrimarySelectionText()
 {
-    if (!SDL_HasPrimarySelectionText())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasPrimarySelectionText();
 }
 
-inline void SetClipboardData(SDL_ClipboardDataCallback callback, SDL_ClipboardCleanupCallback cleanup, void *userdata, const char **mime_types, size_t num_mime_types, std::source_location location = std::source_location::current())
+inline Result<void> SetClipboardData(SDL_ClipboardDataCallback callback, SDL_ClipboardCleanupCallback cleanup, void *userdata, const char **mime_types, size_t num_mime_types, Location location = Location::current())
 {
-    if (!SDL_SetClipboardData(callback, cleanup, userdata, mime_types, num_mime_types))
+    if (!SDL_SetClipboardData(callback, cleanup, userdata, mime_types, num_mime_types)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ClearClipboardData(std::source_location location = std::source_location::current())
+inline Result<void> ClearClipboardData(Location location = Location::current())
 {
-    if (!SDL_ClearClipboardData())
+    if (!SDL_ClearClipboardData()) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void *GetClipboardData(const char *mime_type, size_t *size, std::source_location location = std::source_location::current())
+inline Result<void *> GetClipboardData(const char *mime_type, size_t *size, Location location = Location::current())
 {
     void *result = SDL_GetClipboardData(mime_type, size);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline void HasClipboardData(const char *mime_type, std::source_location location = std::source_location::current())
+inline bool HasClipboardData(const char *mime_type)
 {
-    if (!SDL_HasClipboardData(mime_type))
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasClipboardData(mime_type);
 }
 
-inline char **GetClipboardMimeTypes(size_t *num_mime_types, std::source_location location = std::source_location::current())
+inline Result<char **> GetClipboardMimeTypes(size_t *num_mime_types, Location location = Location::current())
 {
     char **result = SDL_GetClipboardMimeTypes(num_mime_types);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char **>(location);
     }
     return result;
 }
@@ -3767,116 +4383,74 @@ inline int GetCPUCacheLineSize()
     return SDL_GetCPUCacheLineSize();
 }
 
-inline void HasAltiVec(std::source_location location = std::source_location::current())
+inline bool HasAltiVec()
 {
-    if (!SDL_HasAltiVec())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasAltiVec();
 }
 
-inline void HasMMX(std::source_location location = std::source_location::current())
+inline bool HasMMX()
 {
-    if (!SDL_HasMMX())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasMMX();
 }
 
-inline void HasSSE(std::source_location location = std::source_location::current())
+inline bool HasSSE()
 {
-    if (!SDL_HasSSE())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasSSE();
 }
 
-inline void HasSSE2(std::source_location location = std::source_location::current())
+inline bool HasSSE2()
 {
-    if (!SDL_HasSSE2())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasSSE2();
 }
 
-inline void HasSSE3(std::source_location location = std::source_location::current())
+inline bool HasSSE3()
 {
-    if (!SDL_HasSSE3())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasSSE3();
 }
 
-inline void HasSSE41(std::source_location location = std::source_location::current())
+inline bool HasSSE41()
 {
-    if (!SDL_HasSSE41())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasSSE41();
 }
 
-inline void HasSSE42(std::source_location location = std::source_location::current())
+inline bool HasSSE42()
 {
-    if (!SDL_HasSSE42())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasSSE42();
 }
 
-inline void HasAVX(std::source_location location = std::source_location::current())
+inline bool HasAVX()
 {
-    if (!SDL_HasAVX())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasAVX();
 }
 
-inline void HasAVX2(std::source_location location = std::source_location::current())
+inline bool HasAVX2()
 {
-    if (!SDL_HasAVX2())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasAVX2();
 }
 
-inline void HasAVX512F(std::source_location location = std::source_location::current())
+inline bool HasAVX512F()
 {
-    if (!SDL_HasAVX512F())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasAVX512F();
 }
 
-inline void HasARMSIMD(std::source_location location = std::source_location::current())
+inline bool HasARMSIMD()
 {
-    if (!SDL_HasARMSIMD())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasARMSIMD();
 }
 
-inline void HasNEON(std::source_location location = std::source_location::current())
+inline bool HasNEON()
 {
-    if (!SDL_HasNEON())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasNEON();
 }
 
-inline void HasLSX(std::source_location location = std::source_location::current())
+inline bool HasLSX()
 {
-    if (!SDL_HasLSX())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasLSX();
 }
 
-inline void HasLASX(std::source_location location = std::source_location::current())
+inline bool HasLASX()
 {
-    if (!SDL_HasLASX())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasLASX();
 }
 
 inline int GetSystemRAM()
@@ -3894,22 +4468,22 @@ inline int GetNumVideoDrivers()
     return SDL_GetNumVideoDrivers();
 }
 
-inline const char *GetVideoDriver(int index, std::source_location location = std::source_location::current())
+inline Result<const char *> GetVideoDriver(int index, Location location = Location::current())
 {
     const char *result = SDL_GetVideoDriver(index);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline const char *GetCurrentVideoDriver(std::source_location location = std::source_location::current())
+inline Result<const char *> GetCurrentVideoDriver(Location location = Location::current())
 {
     const char *result = SDL_GetCurrentVideoDriver();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -3919,12 +4493,12 @@ inline SDL_SystemTheme GetSystemTheme()
     return SDL_GetSystemTheme();
 }
 
-inline SDL_DisplayID *GetDisplays(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_DisplayID *> GetDisplays(int *count, Location location = Location::current())
 {
     SDL_DisplayID *result = SDL_GetDisplays(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_DisplayID *>(location);
     }
     return result;
 }
@@ -3939,30 +4513,32 @@ inline SDL_PropertiesID GetDisplayProperties(SDL_DisplayID displayID)
     return SDL_GetDisplayProperties(displayID);
 }
 
-inline const char *GetDisplayName(SDL_DisplayID displayID, std::source_location location = std::source_location::current())
+inline Result<const char *> GetDisplayName(SDL_DisplayID displayID, Location location = Location::current())
 {
     const char *result = SDL_GetDisplayName(displayID);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline void GetDisplayBounds(SDL_DisplayID displayID, SDL_Rect *rect, std::source_location location = std::source_location::current())
+inline Result<void> GetDisplayBounds(SDL_DisplayID displayID, SDL_Rect *rect, Location location = Location::current())
 {
-    if (!SDL_GetDisplayBounds(displayID, rect))
+    if (!SDL_GetDisplayBounds(displayID, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetDisplayUsableBounds(SDL_DisplayID displayID, SDL_Rect *rect, std::source_location location = std::source_location::current())
+inline Result<void> GetDisplayUsableBounds(SDL_DisplayID displayID, SDL_Rect *rect, Location location = Location::current())
 {
-    if (!SDL_GetDisplayUsableBounds(displayID, rect))
+    if (!SDL_GetDisplayUsableBounds(displayID, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline SDL_DisplayOrientation GetNaturalDisplayOrientation(SDL_DisplayID displayID)
@@ -3980,40 +4556,41 @@ inline float GetDisplayContentScale(SDL_DisplayID displayID)
     return SDL_GetDisplayContentScale(displayID);
 }
 
-inline SDL_DisplayMode **GetFullscreenDisplayModes(SDL_DisplayID displayID, int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_DisplayMode **> GetFullscreenDisplayModes(SDL_DisplayID displayID, int *count, Location location = Location::current())
 {
     SDL_DisplayMode **result = SDL_GetFullscreenDisplayModes(displayID, count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_DisplayMode **>(location);
     }
     return result;
 }
 
-inline void GetClosestFullscreenDisplayMode(SDL_DisplayID displayID, int w, int h, float refresh_rate, bool include_high_density_modes, SDL_DisplayMode *closest, std::source_location location = std::source_location::current())
+inline Result<void> GetClosestFullscreenDisplayMode(SDL_DisplayID displayID, int w, int h, float refresh_rate, bool include_high_density_modes, SDL_DisplayMode *closest, Location location = Location::current())
 {
-    if (!SDL_GetClosestFullscreenDisplayMode(displayID, w, h, refresh_rate, include_high_density_modes, closest))
+    if (!SDL_GetClosestFullscreenDisplayMode(displayID, w, h, refresh_rate, include_high_density_modes, closest)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline const SDL_DisplayMode *GetDesktopDisplayMode(SDL_DisplayID displayID, std::source_location location = std::source_location::current())
+inline Result<const SDL_DisplayMode *> GetDesktopDisplayMode(SDL_DisplayID displayID, Location location = Location::current())
 {
     const SDL_DisplayMode *result = SDL_GetDesktopDisplayMode(displayID);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const SDL_DisplayMode *>(location);
     }
     return result;
 }
 
-inline const SDL_DisplayMode *GetCurrentDisplayMode(SDL_DisplayID displayID, std::source_location location = std::source_location::current())
+inline Result<const SDL_DisplayMode *> GetCurrentDisplayMode(SDL_DisplayID displayID, Location location = Location::current())
 {
     const SDL_DisplayMode *result = SDL_GetCurrentDisplayMode(displayID);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const SDL_DisplayMode *>(location);
     }
     return result;
 }
@@ -4043,30 +4620,31 @@ inline float GetWindowDisplayScale(SDL_Window *window)
     return SDL_GetWindowDisplayScale(window);
 }
 
-inline void SetWindowFullscreenMode(SDL_Window *window, const SDL_DisplayMode *mode, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowFullscreenMode(SDL_Window *window, const SDL_DisplayMode *mode, Location location = Location::current())
 {
-    if (!SDL_SetWindowFullscreenMode(window, mode))
+    if (!SDL_SetWindowFullscreenMode(window, mode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline const SDL_DisplayMode *GetWindowFullscreenMode(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<const SDL_DisplayMode *> GetWindowFullscreenMode(SDL_Window *window, Location location = Location::current())
 {
     const SDL_DisplayMode *result = SDL_GetWindowFullscreenMode(window);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const SDL_DisplayMode *>(location);
     }
     return result;
 }
 
-inline void *GetWindowICCProfile(SDL_Window *window, size_t *size, std::source_location location = std::source_location::current())
+inline Result<void *> GetWindowICCProfile(SDL_Window *window, size_t *size, Location location = Location::current())
 {
     void *result = SDL_GetWindowICCProfile(window, size);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
@@ -4076,42 +4654,42 @@ inline SDL_PixelFormat GetWindowPixelFormat(SDL_Window *window)
     return SDL_GetWindowPixelFormat(window);
 }
 
-inline SDL_Window **GetWindows(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_Window **> GetWindows(int *count, Location location = Location::current())
 {
     SDL_Window **result = SDL_GetWindows(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Window **>(location);
     }
     return result;
 }
 
-inline SDL_Window *CreateWindow(const char *title, int w, int h, SDL_WindowFlags flags, std::source_location location = std::source_location::current())
+inline Result<SDL_Window *> CreateWindow(const char *title, int w, int h, SDL_WindowFlags flags, Location location = Location::current())
 {
     SDL_Window *result = SDL_CreateWindow(title, w, h, flags);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Window *>(location);
     }
     return result;
 }
 
-inline SDL_Window *CreatePopupWindow(SDL_Window *parent, int offset_x, int offset_y, int w, int h, SDL_WindowFlags flags, std::source_location location = std::source_location::current())
+inline Result<SDL_Window *> CreatePopupWindow(SDL_Window *parent, int offset_x, int offset_y, int w, int h, SDL_WindowFlags flags, Location location = Location::current())
 {
     SDL_Window *result = SDL_CreatePopupWindow(parent, offset_x, offset_y, w, h, flags);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Window *>(location);
     }
     return result;
 }
 
-inline SDL_Window *CreateWindowWithProperties(SDL_PropertiesID props, std::source_location location = std::source_location::current())
+inline Result<SDL_Window *> CreateWindowWithProperties(SDL_PropertiesID props, Location location = Location::current())
 {
     SDL_Window *result = SDL_CreateWindowWithProperties(props);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Window *>(location);
     }
     return result;
 }
@@ -4121,22 +4699,22 @@ inline SDL_WindowID GetWindowID(SDL_Window *window)
     return SDL_GetWindowID(window);
 }
 
-inline SDL_Window *GetWindowFromID(SDL_WindowID id, std::source_location location = std::source_location::current())
+inline Result<SDL_Window *> GetWindowFromID(SDL_WindowID id, Location location = Location::current())
 {
     SDL_Window *result = SDL_GetWindowFromID(id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Window *>(location);
     }
     return result;
 }
 
-inline SDL_Window *GetWindowParent(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<SDL_Window *> GetWindowParent(SDL_Window *window, Location location = Location::current())
 {
     SDL_Window *result = SDL_GetWindowParent(window);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Window *>(location);
     }
     return result;
 }
@@ -4151,348 +4729,374 @@ inline SDL_WindowFlags GetWindowFlags(SDL_Window *window)
     return SDL_GetWindowFlags(window);
 }
 
-inline void SetWindowTitle(SDL_Window *window, const char *title, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowTitle(SDL_Window *window, const char *title, Location location = Location::current())
 {
-    if (!SDL_SetWindowTitle(window, title))
+    if (!SDL_SetWindowTitle(window, title)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline const char *GetWindowTitle(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<const char *> GetWindowTitle(SDL_Window *window, Location location = Location::current())
 {
     const char *result = SDL_GetWindowTitle(window);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline void SetWindowIcon(SDL_Window *window, SDL_Surface *icon, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowIcon(SDL_Window *window, SDL_Surface *icon, Location location = Location::current())
 {
-    if (!SDL_SetWindowIcon(window, icon))
+    if (!SDL_SetWindowIcon(window, icon)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowPosition(SDL_Window *window, int x, int y, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowPosition(SDL_Window *window, int x, int y, Location location = Location::current())
 {
-    if (!SDL_SetWindowPosition(window, x, y))
+    if (!SDL_SetWindowPosition(window, x, y)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetWindowPosition(SDL_Window *window, int *x, int *y, std::source_location location = std::source_location::current())
+inline Result<void> GetWindowPosition(SDL_Window *window, int *x, int *y, Location location = Location::current())
 {
-    if (!SDL_GetWindowPosition(window, x, y))
+    if (!SDL_GetWindowPosition(window, x, y)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowSize(SDL_Window *window, int w, int h, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowSize(SDL_Window *window, int w, int h, Location location = Location::current())
 {
-    if (!SDL_SetWindowSize(window, w, h))
+    if (!SDL_SetWindowSize(window, w, h)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetWindowSize(SDL_Window *window, int *w, int *h, std::source_location location = std::source_location::current())
+inline Result<void> GetWindowSize(SDL_Window *window, int *w, int *h, Location location = Location::current())
 {
-    if (!SDL_GetWindowSize(window, w, h))
+    if (!SDL_GetWindowSize(window, w, h)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetWindowSafeArea(SDL_Window *window, SDL_Rect *rect, std::source_location location = std::source_location::current())
+inline Result<void> GetWindowSafeArea(SDL_Window *window, SDL_Rect *rect, Location location = Location::current())
 {
-    if (!SDL_GetWindowSafeArea(window, rect))
+    if (!SDL_GetWindowSafeArea(window, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowAspectRatio(SDL_Window *window, float min_aspect, float max_aspect, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowAspectRatio(SDL_Window *window, float min_aspect, float max_aspect, Location location = Location::current())
 {
-    if (!SDL_SetWindowAspectRatio(window, min_aspect, max_aspect))
+    if (!SDL_SetWindowAspectRatio(window, min_aspect, max_aspect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetWindowAspectRatio(SDL_Window *window, float *min_aspect, float *max_aspect, std::source_location location = std::source_location::current())
+inline Result<void> GetWindowAspectRatio(SDL_Window *window, float *min_aspect, float *max_aspect, Location location = Location::current())
 {
-    if (!SDL_GetWindowAspectRatio(window, min_aspect, max_aspect))
+    if (!SDL_GetWindowAspectRatio(window, min_aspect, max_aspect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetWindowBordersSize(SDL_Window *window, int *top, int *left, int *bottom, int *right, std::source_location location = std::source_location::current())
+inline Result<void> GetWindowBordersSize(SDL_Window *window, int *top, int *left, int *bottom, int *right, Location location = Location::current())
 {
-    if (!SDL_GetWindowBordersSize(window, top, left, bottom, right))
+    if (!SDL_GetWindowBordersSize(window, top, left, bottom, right)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetWindowSizeInPixels(SDL_Window *window, int *w, int *h, std::source_location location = std::source_location::current())
+inline Result<void> GetWindowSizeInPixels(SDL_Window *window, int *w, int *h, Location location = Location::current())
 {
-    if (!SDL_GetWindowSizeInPixels(window, w, h))
+    if (!SDL_GetWindowSizeInPixels(window, w, h)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowMinimumSize(SDL_Window *window, int min_w, int min_h, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowMinimumSize(SDL_Window *window, int min_w, int min_h, Location location = Location::current())
 {
-    if (!SDL_SetWindowMinimumSize(window, min_w, min_h))
+    if (!SDL_SetWindowMinimumSize(window, min_w, min_h)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetWindowMinimumSize(SDL_Window *window, int *w, int *h, std::source_location location = std::source_location::current())
+inline Result<void> GetWindowMinimumSize(SDL_Window *window, int *w, int *h, Location location = Location::current())
 {
-    if (!SDL_GetWindowMinimumSize(window, w, h))
+    if (!SDL_GetWindowMinimumSize(window, w, h)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowMaximumSize(SDL_Window *window, int max_w, int max_h, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowMaximumSize(SDL_Window *window, int max_w, int max_h, Location location = Location::current())
 {
-    if (!SDL_SetWindowMaximumSize(window, max_w, max_h))
+    if (!SDL_SetWindowMaximumSize(window, max_w, max_h)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetWindowMaximumSize(SDL_Window *window, int *w, int *h, std::source_location location = std::source_location::current())
+inline Result<void> GetWindowMaximumSize(SDL_Window *window, int *w, int *h, Location location = Location::current())
 {
-    if (!SDL_GetWindowMaximumSize(window, w, h))
+    if (!SDL_GetWindowMaximumSize(window, w, h)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowBordered(SDL_Window *window, bool bordered, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowBordered(SDL_Window *window, bool bordered, Location location = Location::current())
 {
-    if (!SDL_SetWindowBordered(window, bordered))
+    if (!SDL_SetWindowBordered(window, bordered)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowResizable(SDL_Window *window, bool resizable, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowResizable(SDL_Window *window, bool resizable, Location location = Location::current())
 {
-    if (!SDL_SetWindowResizable(window, resizable))
+    if (!SDL_SetWindowResizable(window, resizable)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowAlwaysOnTop(SDL_Window *window, bool on_top, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowAlwaysOnTop(SDL_Window *window, bool on_top, Location location = Location::current())
 {
-    if (!SDL_SetWindowAlwaysOnTop(window, on_top))
+    if (!SDL_SetWindowAlwaysOnTop(window, on_top)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ShowWindow(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> ShowWindow(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_ShowWindow(window))
+    if (!SDL_ShowWindow(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void HideWindow(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> HideWindow(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_HideWindow(window))
+    if (!SDL_HideWindow(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RaiseWindow(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> RaiseWindow(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_RaiseWindow(window))
+    if (!SDL_RaiseWindow(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void MaximizeWindow(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> MaximizeWindow(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_MaximizeWindow(window))
+    if (!SDL_MaximizeWindow(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void MinimizeWindow(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> MinimizeWindow(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_MinimizeWindow(window))
+    if (!SDL_MinimizeWindow(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RestoreWindow(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> RestoreWindow(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_RestoreWindow(window))
+    if (!SDL_RestoreWindow(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowFullscreen(SDL_Window *window, bool fullscreen, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowFullscreen(SDL_Window *window, bool fullscreen, Location location = Location::current())
 {
-    if (!SDL_SetWindowFullscreen(window, fullscreen))
+    if (!SDL_SetWindowFullscreen(window, fullscreen)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SyncWindow(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> SyncWindow(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_SyncWindow(window))
+    if (!SDL_SyncWindow(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WindowHasSurface(SDL_Window *window, std::source_location location = std::source_location::current())
+inline bool WindowHasSurface(SDL_Window *window)
 {
-    if (!SDL_WindowHasSurface(window))
-    {
-        SDLThrow(location);
-    }
+    return SDL_WindowHasSurface(window);
 }
 
-inline SDL_Surface *GetWindowSurface(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<SDL_Surface *> GetWindowSurface(SDL_Window *window, Location location = Location::current())
 {
     SDL_Surface *result = SDL_GetWindowSurface(window);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Surface *>(location);
     }
     return result;
 }
 
-inline void SetWindowSurfaceVSync(SDL_Window *window, int vsync, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowSurfaceVSync(SDL_Window *window, int vsync, Location location = Location::current())
 {
-    if (!SDL_SetWindowSurfaceVSync(window, vsync))
+    if (!SDL_SetWindowSurfaceVSync(window, vsync)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetWindowSurfaceVSync(SDL_Window *window, int *vsync, std::source_location location = std::source_location::current())
+inline Result<void> GetWindowSurfaceVSync(SDL_Window *window, int *vsync, Location location = Location::current())
 {
-    if (!SDL_GetWindowSurfaceVSync(window, vsync))
+    if (!SDL_GetWindowSurfaceVSync(window, vsync)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void UpdateWindowSurface(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> UpdateWindowSurface(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_UpdateWindowSurface(window))
+    if (!SDL_UpdateWindowSurface(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void UpdateWindowSurfaceRects(SDL_Window *window, const SDL_Rect *rects, int numrects, std::source_location location = std::source_location::current())
+inline Result<void> UpdateWindowSurfaceRects(SDL_Window *window, const SDL_Rect *rects, int numrects, Location location = Location::current())
 {
-    if (!SDL_UpdateWindowSurfaceRects(window, rects, numrects))
+    if (!SDL_UpdateWindowSurfaceRects(window, rects, numrects)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void DestroyWindowSurface(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> DestroyWindowSurface(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_DestroyWindowSurface(window))
+    if (!SDL_DestroyWindowSurface(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowKeyboardGrab(SDL_Window *window, bool grabbed, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowKeyboardGrab(SDL_Window *window, bool grabbed, Location location = Location::current())
 {
-    if (!SDL_SetWindowKeyboardGrab(window, grabbed))
+    if (!SDL_SetWindowKeyboardGrab(window, grabbed)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowMouseGrab(SDL_Window *window, bool grabbed, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowMouseGrab(SDL_Window *window, bool grabbed, Location location = Location::current())
 {
-    if (!SDL_SetWindowMouseGrab(window, grabbed))
+    if (!SDL_SetWindowMouseGrab(window, grabbed)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetWindowKeyboardGrab(SDL_Window *window, std::source_location location = std::source_location::current())
+inline bool GetWindowKeyboardGrab(SDL_Window *window)
 {
-    if (!SDL_GetWindowKeyboardGrab(window))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetWindowKeyboardGrab(window);
 }
 
-inline void GetWindowMouseGrab(SDL_Window *window, std::source_location location = std::source_location::current())
+inline bool GetWindowMouseGrab(SDL_Window *window)
 {
-    if (!SDL_GetWindowMouseGrab(window))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetWindowMouseGrab(window);
 }
 
-inline SDL_Window *GetGrabbedWindow(std::source_location location = std::source_location::current())
+inline Result<SDL_Window *> GetGrabbedWindow(Location location = Location::current())
 {
     SDL_Window *result = SDL_GetGrabbedWindow();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Window *>(location);
     }
     return result;
 }
 
-inline void SetWindowMouseRect(SDL_Window *window, const SDL_Rect *rect, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowMouseRect(SDL_Window *window, const SDL_Rect *rect, Location location = Location::current())
 {
-    if (!SDL_SetWindowMouseRect(window, rect))
+    if (!SDL_SetWindowMouseRect(window, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline const SDL_Rect *GetWindowMouseRect(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<const SDL_Rect *> GetWindowMouseRect(SDL_Window *window, Location location = Location::current())
 {
     const SDL_Rect *result = SDL_GetWindowMouseRect(window);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const SDL_Rect *>(location);
     }
     return result;
 }
 
-inline void SetWindowOpacity(SDL_Window *window, float opacity, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowOpacity(SDL_Window *window, float opacity, Location location = Location::current())
 {
-    if (!SDL_SetWindowOpacity(window, opacity))
+    if (!SDL_SetWindowOpacity(window, opacity)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline float GetWindowOpacity(SDL_Window *window)
@@ -4500,60 +5104,67 @@ inline float GetWindowOpacity(SDL_Window *window)
     return SDL_GetWindowOpacity(window);
 }
 
-inline void SetWindowParent(SDL_Window *window, SDL_Window *parent, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowParent(SDL_Window *window, SDL_Window *parent, Location location = Location::current())
 {
-    if (!SDL_SetWindowParent(window, parent))
+    if (!SDL_SetWindowParent(window, parent)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowModal(SDL_Window *window, bool modal, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowModal(SDL_Window *window, bool modal, Location location = Location::current())
 {
-    if (!SDL_SetWindowModal(window, modal))
+    if (!SDL_SetWindowModal(window, modal)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowFocusable(SDL_Window *window, bool focusable, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowFocusable(SDL_Window *window, bool focusable, Location location = Location::current())
 {
-    if (!SDL_SetWindowFocusable(window, focusable))
+    if (!SDL_SetWindowFocusable(window, focusable)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ShowWindowSystemMenu(SDL_Window *window, int x, int y, std::source_location location = std::source_location::current())
+inline Result<void> ShowWindowSystemMenu(SDL_Window *window, int x, int y, Location location = Location::current())
 {
-    if (!SDL_ShowWindowSystemMenu(window, x, y))
+    if (!SDL_ShowWindowSystemMenu(window, x, y)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowHitTest(SDL_Window *window, SDL_HitTest callback, void *callback_data, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowHitTest(SDL_Window *window, SDL_HitTest callback, void *callback_data, Location location = Location::current())
 {
-    if (!SDL_SetWindowHitTest(window, callback, callback_data))
+    if (!SDL_SetWindowHitTest(window, callback, callback_data)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowShape(SDL_Window *window, SDL_Surface *shape, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowShape(SDL_Window *window, SDL_Surface *shape, Location location = Location::current())
 {
-    if (!SDL_SetWindowShape(window, shape))
+    if (!SDL_SetWindowShape(window, shape)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void FlashWindow(SDL_Window *window, SDL_FlashOperation operation, std::source_location location = std::source_location::current())
+inline Result<void> FlashWindow(SDL_Window *window, SDL_FlashOperation operation, Location location = Location::current())
 {
-    if (!SDL_FlashWindow(window, operation))
+    if (!SDL_FlashWindow(window, operation)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void DestroyWindow(SDL_Window *window)
@@ -4561,36 +5172,36 @@ inline void DestroyWindow(SDL_Window *window)
     SDL_DestroyWindow(window);
 }
 
-inline void ScreenSaverEnabled(std::source_location location = std::source_location::current())
+inline bool ScreenSaverEnabled()
 {
-    if (!SDL_ScreenSaverEnabled())
-    {
-        SDLThrow(location);
-    }
+    return SDL_ScreenSaverEnabled();
 }
 
-inline void EnableScreenSaver(std::source_location location = std::source_location::current())
+inline Result<void> EnableScreenSaver(Location location = Location::current())
 {
-    if (!SDL_EnableScreenSaver())
+    if (!SDL_EnableScreenSaver()) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void DisableScreenSaver(std::source_location location = std::source_location::current())
+inline Result<void> DisableScreenSaver(Location location = Location::current())
 {
-    if (!SDL_DisableScreenSaver())
+    if (!SDL_DisableScreenSaver()) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GL_LoadLibrary(const char *path, std::source_location location = std::source_location::current())
+inline Result<void> GL_LoadLibrary(const char *path, Location location = Location::current())
 {
-    if (!SDL_GL_LoadLibrary(path))
+    if (!SDL_GL_LoadLibrary(path)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline SDL_FunctionPointer GL_GetProcAddress(const char *proc)
@@ -4608,12 +5219,9 @@ inline void GL_UnloadLibrary()
     SDL_GL_UnloadLibrary();
 }
 
-inline void GL_ExtensionSupported(const char *extension, std::source_location location = std::source_location::current())
+inline bool GL_ExtensionSupported(const char *extension)
 {
-    if (!SDL_GL_ExtensionSupported(extension))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GL_ExtensionSupported(extension);
 }
 
 inline void GL_ResetAttributes()
@@ -4621,20 +5229,22 @@ inline void GL_ResetAttributes()
     SDL_GL_ResetAttributes();
 }
 
-inline void GL_SetAttribute(SDL_GLAttr attr, int value, std::source_location location = std::source_location::current())
+inline Result<void> GL_SetAttribute(SDL_GLAttr attr, int value, Location location = Location::current())
 {
-    if (!SDL_GL_SetAttribute(attr, value))
+    if (!SDL_GL_SetAttribute(attr, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GL_GetAttribute(SDL_GLAttr attr, int *value, std::source_location location = std::source_location::current())
+inline Result<void> GL_GetAttribute(SDL_GLAttr attr, int *value, Location location = Location::current())
 {
-    if (!SDL_GL_GetAttribute(attr, value))
+    if (!SDL_GL_GetAttribute(attr, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline SDL_GLContext GL_CreateContext(SDL_Window *window)
@@ -4642,20 +5252,21 @@ inline SDL_GLContext GL_CreateContext(SDL_Window *window)
     return SDL_GL_CreateContext(window);
 }
 
-inline void GL_MakeCurrent(SDL_Window *window, SDL_GLContext context, std::source_location location = std::source_location::current())
+inline Result<void> GL_MakeCurrent(SDL_Window *window, SDL_GLContext context, Location location = Location::current())
 {
-    if (!SDL_GL_MakeCurrent(window, context))
+    if (!SDL_GL_MakeCurrent(window, context)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_Window *GL_GetCurrentWindow(std::source_location location = std::source_location::current())
+inline Result<SDL_Window *> GL_GetCurrentWindow(Location location = Location::current())
 {
     SDL_Window *result = SDL_GL_GetCurrentWindow();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Window *>(location);
     }
     return result;
 }
@@ -4685,36 +5296,40 @@ inline void EGL_SetAttributeCallbacks(SDL_EGLAttribArrayCallback platformAttribC
     SDL_EGL_SetAttributeCallbacks(platformAttribCallback, surfaceAttribCallback, contextAttribCallback, userdata);
 }
 
-inline void GL_SetSwapInterval(int interval, std::source_location location = std::source_location::current())
+inline Result<void> GL_SetSwapInterval(int interval, Location location = Location::current())
 {
-    if (!SDL_GL_SetSwapInterval(interval))
+    if (!SDL_GL_SetSwapInterval(interval)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GL_GetSwapInterval(int *interval, std::source_location location = std::source_location::current())
+inline Result<void> GL_GetSwapInterval(int *interval, Location location = Location::current())
 {
-    if (!SDL_GL_GetSwapInterval(interval))
+    if (!SDL_GL_GetSwapInterval(interval)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GL_SwapWindow(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> GL_SwapWindow(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_GL_SwapWindow(window))
+    if (!SDL_GL_SwapWindow(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GL_DestroyContext(SDL_GLContext context, std::source_location location = std::source_location::current())
+inline Result<void> GL_DestroyContext(SDL_GLContext context, Location location = Location::current())
 {
-    if (!SDL_GL_DestroyContext(context))
+    if (!SDL_GL_DestroyContext(context)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void ShowOpenFileDialog(SDL_DialogFileCallback callback, void *userdata, SDL_Window *window, const SDL_DialogFileFilter *filters, int nfilters, const char *default_location, bool allow_many)
@@ -4752,22 +5367,22 @@ inline SDL_PowerState GetPowerInfo(int *seconds, int *percent)
     return SDL_GetPowerInfo(seconds, percent);
 }
 
-inline SDL_SensorID *GetSensors(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_SensorID *> GetSensors(int *count, Location location = Location::current())
 {
     SDL_SensorID *result = SDL_GetSensors(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_SensorID *>(location);
     }
     return result;
 }
 
-inline const char *GetSensorNameForID(SDL_SensorID instance_id, std::source_location location = std::source_location::current())
+inline Result<const char *> GetSensorNameForID(SDL_SensorID instance_id, Location location = Location::current())
 {
     const char *result = SDL_GetSensorNameForID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -4782,22 +5397,22 @@ inline int GetSensorNonPortableTypeForID(SDL_SensorID instance_id)
     return SDL_GetSensorNonPortableTypeForID(instance_id);
 }
 
-inline SDL_Sensor *OpenSensor(SDL_SensorID instance_id, std::source_location location = std::source_location::current())
+inline Result<SDL_Sensor *> OpenSensor(SDL_SensorID instance_id, Location location = Location::current())
 {
     SDL_Sensor *result = SDL_OpenSensor(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Sensor *>(location);
     }
     return result;
 }
 
-inline SDL_Sensor *GetSensorFromID(SDL_SensorID instance_id, std::source_location location = std::source_location::current())
+inline Result<SDL_Sensor *> GetSensorFromID(SDL_SensorID instance_id, Location location = Location::current())
 {
     SDL_Sensor *result = SDL_GetSensorFromID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Sensor *>(location);
     }
     return result;
 }
@@ -4807,12 +5422,12 @@ inline SDL_PropertiesID GetSensorProperties(SDL_Sensor *sensor)
     return SDL_GetSensorProperties(sensor);
 }
 
-inline const char *GetSensorName(SDL_Sensor *sensor, std::source_location location = std::source_location::current())
+inline Result<const char *> GetSensorName(SDL_Sensor *sensor, Location location = Location::current())
 {
     const char *result = SDL_GetSensorName(sensor);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -4832,12 +5447,13 @@ inline SDL_SensorID GetSensorID(SDL_Sensor *sensor)
     return SDL_GetSensorID(sensor);
 }
 
-inline void GetSensorData(SDL_Sensor *sensor, float *data, int num_values, std::source_location location = std::source_location::current())
+inline Result<void> GetSensorData(SDL_Sensor *sensor, float *data, int num_values, Location location = Location::current())
 {
-    if (!SDL_GetSensorData(sensor, data, num_values))
+    if (!SDL_GetSensorData(sensor, data, num_values)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void CloseSensor(SDL_Sensor *sensor)
@@ -4860,40 +5476,37 @@ inline void UnlockJoysticks()
     SDL_UnlockJoysticks();
 }
 
-inline void HasJoystick(std::source_location location = std::source_location::current())
+inline bool HasJoystick()
 {
-    if (!SDL_HasJoystick())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasJoystick();
 }
 
-inline SDL_JoystickID *GetJoysticks(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_JoystickID *> GetJoysticks(int *count, Location location = Location::current())
 {
     SDL_JoystickID *result = SDL_GetJoysticks(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_JoystickID *>(location);
     }
     return result;
 }
 
-inline const char *GetJoystickNameForID(SDL_JoystickID instance_id, std::source_location location = std::source_location::current())
+inline Result<const char *> GetJoystickNameForID(SDL_JoystickID instance_id, Location location = Location::current())
 {
     const char *result = SDL_GetJoystickNameForID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline const char *GetJoystickPathForID(SDL_JoystickID instance_id, std::source_location location = std::source_location::current())
+inline Result<const char *> GetJoystickPathForID(SDL_JoystickID instance_id, Location location = Location::current())
 {
     const char *result = SDL_GetJoystickPathForID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -4928,32 +5541,32 @@ inline SDL_JoystickType GetJoystickTypeForID(SDL_JoystickID instance_id)
     return SDL_GetJoystickTypeForID(instance_id);
 }
 
-inline SDL_Joystick *OpenJoystick(SDL_JoystickID instance_id, std::source_location location = std::source_location::current())
+inline Result<SDL_Joystick *> OpenJoystick(SDL_JoystickID instance_id, Location location = Location::current())
 {
     SDL_Joystick *result = SDL_OpenJoystick(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Joystick *>(location);
     }
     return result;
 }
 
-inline SDL_Joystick *GetJoystickFromID(SDL_JoystickID instance_id, std::source_location location = std::source_location::current())
+inline Result<SDL_Joystick *> GetJoystickFromID(SDL_JoystickID instance_id, Location location = Location::current())
 {
     SDL_Joystick *result = SDL_GetJoystickFromID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Joystick *>(location);
     }
     return result;
 }
 
-inline SDL_Joystick *GetJoystickFromPlayerIndex(int player_index, std::source_location location = std::source_location::current())
+inline Result<SDL_Joystick *> GetJoystickFromPlayerIndex(int player_index, Location location = Location::current())
 {
     SDL_Joystick *result = SDL_GetJoystickFromPlayerIndex(player_index);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Joystick *>(location);
     }
     return result;
 }
@@ -4963,68 +5576,72 @@ inline SDL_JoystickID AttachVirtualJoystick(const SDL_VirtualJoystickDesc *desc)
     return SDL_AttachVirtualJoystick(desc);
 }
 
-inline void DetachVirtualJoystick(SDL_JoystickID instance_id, std::source_location location = std::source_location::current())
+inline Result<void> DetachVirtualJoystick(SDL_JoystickID instance_id, Location location = Location::current())
 {
-    if (!SDL_DetachVirtualJoystick(instance_id))
+    if (!SDL_DetachVirtualJoystick(instance_id)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void IsJoystickVirtual(SDL_JoystickID instance_id, std::source_location location = std::source_location::current())
+inline bool IsJoystickVirtual(SDL_JoystickID instance_id)
 {
-    if (!SDL_IsJoystickVirtual(instance_id))
-    {
-        SDLThrow(location);
-    }
+    return SDL_IsJoystickVirtual(instance_id);
 }
 
-inline void SetJoystickVirtualAxis(SDL_Joystick *joystick, int axis, Sint16 value, std::source_location location = std::source_location::current())
+inline Result<void> SetJoystickVirtualAxis(SDL_Joystick *joystick, int axis, Sint16 value, Location location = Location::current())
 {
-    if (!SDL_SetJoystickVirtualAxis(joystick, axis, value))
+    if (!SDL_SetJoystickVirtualAxis(joystick, axis, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetJoystickVirtualBall(SDL_Joystick *joystick, int ball, Sint16 xrel, Sint16 yrel, std::source_location location = std::source_location::current())
+inline Result<void> SetJoystickVirtualBall(SDL_Joystick *joystick, int ball, Sint16 xrel, Sint16 yrel, Location location = Location::current())
 {
-    if (!SDL_SetJoystickVirtualBall(joystick, ball, xrel, yrel))
+    if (!SDL_SetJoystickVirtualBall(joystick, ball, xrel, yrel)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetJoystickVirtualButton(SDL_Joystick *joystick, int button, bool down, std::source_location location = std::source_location::current())
+inline Result<void> SetJoystickVirtualButton(SDL_Joystick *joystick, int button, bool down, Location location = Location::current())
 {
-    if (!SDL_SetJoystickVirtualButton(joystick, button, down))
+    if (!SDL_SetJoystickVirtualButton(joystick, button, down)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetJoystickVirtualHat(SDL_Joystick *joystick, int hat, Uint8 value, std::source_location location = std::source_location::current())
+inline Result<void> SetJoystickVirtualHat(SDL_Joystick *joystick, int hat, Uint8 value, Location location = Location::current())
 {
-    if (!SDL_SetJoystickVirtualHat(joystick, hat, value))
+    if (!SDL_SetJoystickVirtualHat(joystick, hat, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetJoystickVirtualTouchpad(SDL_Joystick *joystick, int touchpad, int finger, bool down, float x, float y, float pressure, std::source_location location = std::source_location::current())
+inline Result<void> SetJoystickVirtualTouchpad(SDL_Joystick *joystick, int touchpad, int finger, bool down, float x, float y, float pressure, Location location = Location::current())
 {
-    if (!SDL_SetJoystickVirtualTouchpad(joystick, touchpad, finger, down, x, y, pressure))
+    if (!SDL_SetJoystickVirtualTouchpad(joystick, touchpad, finger, down, x, y, pressure)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SendJoystickVirtualSensorData(SDL_Joystick *joystick, SDL_SensorType type, Uint64 sensor_timestamp, const float *data, int num_values, std::source_location location = std::source_location::current())
+inline Result<void> SendJoystickVirtualSensorData(SDL_Joystick *joystick, SDL_SensorType type, Uint64 sensor_timestamp, const float *data, int num_values, Location location = Location::current())
 {
-    if (!SDL_SendJoystickVirtualSensorData(joystick, type, sensor_timestamp, data, num_values))
+    if (!SDL_SendJoystickVirtualSensorData(joystick, type, sensor_timestamp, data, num_values)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline SDL_PropertiesID GetJoystickProperties(SDL_Joystick *joystick)
@@ -5032,22 +5649,22 @@ inline SDL_PropertiesID GetJoystickProperties(SDL_Joystick *joystick)
     return SDL_GetJoystickProperties(joystick);
 }
 
-inline const char *GetJoystickName(SDL_Joystick *joystick, std::source_location location = std::source_location::current())
+inline Result<const char *> GetJoystickName(SDL_Joystick *joystick, Location location = Location::current())
 {
     const char *result = SDL_GetJoystickName(joystick);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline const char *GetJoystickPath(SDL_Joystick *joystick, std::source_location location = std::source_location::current())
+inline Result<const char *> GetJoystickPath(SDL_Joystick *joystick, Location location = Location::current())
 {
     const char *result = SDL_GetJoystickPath(joystick);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -5057,12 +5674,13 @@ inline int GetJoystickPlayerIndex(SDL_Joystick *joystick)
     return SDL_GetJoystickPlayerIndex(joystick);
 }
 
-inline void SetJoystickPlayerIndex(SDL_Joystick *joystick, int player_index, std::source_location location = std::source_location::current())
+inline Result<void> SetJoystickPlayerIndex(SDL_Joystick *joystick, int player_index, Location location = Location::current())
 {
-    if (!SDL_SetJoystickPlayerIndex(joystick, player_index))
+    if (!SDL_SetJoystickPlayerIndex(joystick, player_index)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline SDL_GUID GetJoystickGUID(SDL_Joystick *joystick)
@@ -5090,12 +5708,12 @@ inline Uint16 GetJoystickFirmwareVersion(SDL_Joystick *joystick)
     return SDL_GetJoystickFirmwareVersion(joystick);
 }
 
-inline const char *GetJoystickSerial(SDL_Joystick *joystick, std::source_location location = std::source_location::current())
+inline Result<const char *> GetJoystickSerial(SDL_Joystick *joystick, Location location = Location::current())
 {
     const char *result = SDL_GetJoystickSerial(joystick);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -5110,12 +5728,9 @@ inline void GetJoystickGUIDInfo(SDL_GUID guid, Uint16 *vendor, Uint16 *product,
     SDL_GetJoystickGUIDInfo(guid, vendor, product, version, crc16);
 }
 
-inline void JoystickConnected(SDL_Joystick *joystick, std::source_location location = std::source_location::current())
+inline bool JoystickConnected(SDL_Joystick *joystick)
 {
-    if (!SDL_JoystickConnected(joystick))
-    {
-        SDLThrow(location);
-    }
+    return SDL_JoystickConnected(joystick);
 }
 
 inline SDL_JoystickID GetJoystickID(SDL_Joystick *joystick)
@@ -5148,12 +5763,9 @@ inline void SetJoystickEventsEnabled(bool enabled)
     SDL_SetJoystickEventsEnabled(enabled);
 }
 
-inline void JoystickEventsEnabled(std::source_location location = std::source_location::current())
+inline bool JoystickEventsEnabled()
 {
-    if (!SDL_JoystickEventsEnabled())
-    {
-        SDLThrow(location);
-    }
+    return SDL_JoystickEventsEnabled();
 }
 
 inline void UpdateJoysticks()
@@ -5166,20 +5778,18 @@ inline Sint16 GetJoystickAxis(SDL_Joystick *joystick, int axis)
     return SDL_GetJoystickAxis(joystick, axis);
 }
 
-inline void GetJoystickAxisInitialState(SDL_Joystick *joystick, int axis, Sint16 *state, std::source_location location = std::source_location::current())
+inline bool GetJoystickAxisInitialState(SDL_Joystick *joystick, int axis, Sint16 *state)
 {
-    if (!SDL_GetJoystickAxisInitialState(joystick, axis, state))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetJoystickAxisInitialState(joystick, axis, state);
 }
 
-inline void GetJoystickBall(SDL_Joystick *joystick, int ball, int *dx, int *dy, std::source_location location = std::source_location::current())
+inline Result<void> GetJoystickBall(SDL_Joystick *joystick, int ball, int *dx, int *dy, Location location = Location::current())
 {
-    if (!SDL_GetJoystickBall(joystick, ball, dx, dy))
+    if (!SDL_GetJoystickBall(joystick, ball, dx, dy)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline Uint8 GetJoystickHat(SDL_Joystick *joystick, int hat)
@@ -5187,44 +5797,45 @@ inline Uint8 GetJoystickHat(SDL_Joystick *joystick, int hat)
     return SDL_GetJoystickHat(joystick, hat);
 }
 
-inline void GetJoystickButton(SDL_Joystick *joystick, int button, std::source_location location = std::source_location::current())
+inline bool GetJoystickButton(SDL_Joystick *joystick, int button)
 {
-    if (!SDL_GetJoystickButton(joystick, button))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetJoystickButton(joystick, button);
 }
 
-inline void RumbleJoystick(SDL_Joystick *joystick, Uint16 low_frequency_rumble, Uint16 high_frequency_rumble, Uint32 duration_ms, std::source_location location = std::source_location::current())
+inline Result<void> RumbleJoystick(SDL_Joystick *joystick, Uint16 low_frequency_rumble, Uint16 high_frequency_rumble, Uint32 duration_ms, Location location = Location::current())
 {
-    if (!SDL_RumbleJoystick(joystick, low_frequency_rumble, high_frequency_rumble, duration_ms))
+    if (!SDL_RumbleJoystick(joystick, low_frequency_rumble, high_frequency_rumble, duration_ms)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RumbleJoystickTriggers(SDL_Joystick *joystick, Uint16 left_rumble, Uint16 right_rumble, Uint32 duration_ms, std::source_location location = std::source_location::current())
+inline Result<void> RumbleJoystickTriggers(SDL_Joystick *joystick, Uint16 left_rumble, Uint16 right_rumble, Uint32 duration_ms, Location location = Location::current())
 {
-    if (!SDL_RumbleJoystickTriggers(joystick, left_rumble, right_rumble, duration_ms))
+    if (!SDL_RumbleJoystickTriggers(joystick, left_rumble, right_rumble, duration_ms)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetJoystickLED(SDL_Joystick *joystick, Uint8 red, Uint8 green, Uint8 blue, std::source_location location = std::source_location::current())
+inline Result<void> SetJoystickLED(SDL_Joystick *joystick, Uint8 red, Uint8 green, Uint8 blue, Location location = Location::current())
 {
-    if (!SDL_SetJoystickLED(joystick, red, green, blue))
+    if (!SDL_SetJoystickLED(joystick, red, green, blue)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SendJoystickEffect(SDL_Joystick *joystick, const void *data, int size, std::source_location location = std::source_location::current())
+inline Result<void> SendJoystickEffect(SDL_Joystick *joystick, const void *data, int size, Location location = Location::current())
 {
-    if (!SDL_SendJoystickEffect(joystick, data, size))
+    if (!SDL_SendJoystickEffect(joystick, data, size)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void CloseJoystick(SDL_Joystick *joystick)
@@ -5257,94 +5868,90 @@ inline int AddGamepadMappingsFromFile(const char *file)
     return SDL_AddGamepadMappingsFromFile(file);
 }
 
-inline void ReloadGamepadMappings(std::source_location location = std::source_location::current())
+inline Result<void> ReloadGamepadMappings(Location location = Location::current())
 {
-    if (!SDL_ReloadGamepadMappings())
+    if (!SDL_ReloadGamepadMappings()) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline char **GetGamepadMappings(int *count, std::source_location location = std::source_location::current())
+inline Result<char **> GetGamepadMappings(int *count, Location location = Location::current())
 {
     char **result = SDL_GetGamepadMappings(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char **>(location);
     }
     return result;
 }
 
-inline char *GetGamepadMappingForGUID(SDL_GUID guid, std::source_location location = std::source_location::current())
+inline Result<char *> GetGamepadMappingForGUID(SDL_GUID guid, Location location = Location::current())
 {
     char *result = SDL_GetGamepadMappingForGUID(guid);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline char *GetGamepadMapping(SDL_Gamepad *gamepad, std::source_location location = std::source_location::current())
+inline Result<char *> GetGamepadMapping(SDL_Gamepad *gamepad, Location location = Location::current())
 {
     char *result = SDL_GetGamepadMapping(gamepad);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline void SetGamepadMapping(SDL_JoystickID instance_id, const char *mapping, std::source_location location = std::source_location::current())
+inline Result<void> SetGamepadMapping(SDL_JoystickID instance_id, const char *mapping, Location location = Location::current())
 {
-    if (!SDL_SetGamepadMapping(instance_id, mapping))
+    if (!SDL_SetGamepadMapping(instance_id, mapping)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void HasGamepad(std::source_location location = std::source_location::current())
+inline bool HasGamepad()
 {
-    if (!SDL_HasGamepad())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasGamepad();
 }
 
-inline SDL_JoystickID *GetGamepads(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_JoystickID *> GetGamepads(int *count, Location location = Location::current())
 {
     SDL_JoystickID *result = SDL_GetGamepads(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_JoystickID *>(location);
     }
     return result;
 }
 
-inline void IsGamepad(SDL_JoystickID instance_id, std::source_location location = std::source_location::current())
+inline bool IsGamepad(SDL_JoystickID instance_id)
 {
-    if (!SDL_IsGamepad(instance_id))
-    {
-        SDLThrow(location);
-    }
+    return SDL_IsGamepad(instance_id);
 }
 
-inline const char *GetGamepadNameForID(SDL_JoystickID instance_id, std::source_location location = std::source_location::current())
+inline Result<const char *> GetGamepadNameForID(SDL_JoystickID instance_id, Location location = Location::current())
 {
     const char *result = SDL_GetGamepadNameForID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline const char *GetGamepadPathForID(SDL_JoystickID instance_id, std::source_location location = std::source_location::current())
+inline Result<const char *> GetGamepadPathForID(SDL_JoystickID instance_id, Location location = Location::current())
 {
     const char *result = SDL_GetGamepadPathForID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -5384,42 +5991,42 @@ inline SDL_GamepadType GetRealGamepadTypeForID(SDL_JoystickID instance_id)
     return SDL_GetRealGamepadTypeForID(instance_id);
 }
 
-inline char *GetGamepadMappingForID(SDL_JoystickID instance_id, std::source_location location = std::source_location::current())
+inline Result<char *> GetGamepadMappingForID(SDL_JoystickID instance_id, Location location = Location::current())
 {
     char *result = SDL_GetGamepadMappingForID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline SDL_Gamepad *OpenGamepad(SDL_JoystickID instance_id, std::source_location location = std::source_location::current())
+inline Result<SDL_Gamepad *> OpenGamepad(SDL_JoystickID instance_id, Location location = Location::current())
 {
     SDL_Gamepad *result = SDL_OpenGamepad(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Gamepad *>(location);
     }
     return result;
 }
 
-inline SDL_Gamepad *GetGamepadFromID(SDL_JoystickID instance_id, std::source_location location = std::source_location::current())
+inline Result<SDL_Gamepad *> GetGamepadFromID(SDL_JoystickID instance_id, Location location = Location::current())
 {
     SDL_Gamepad *result = SDL_GetGamepadFromID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Gamepad *>(location);
     }
     return result;
 }
 
-inline SDL_Gamepad *GetGamepadFromPlayerIndex(int player_index, std::source_location location = std::source_location::current())
+inline Result<SDL_Gamepad *> GetGamepadFromPlayerIndex(int player_index, Location location = Location::current())
 {
     SDL_Gamepad *result = SDL_GetGamepadFromPlayerIndex(player_index);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Gamepad *>(location);
     }
     return result;
 }
@@ -5434,22 +6041,22 @@ inline SDL_JoystickID GetGamepadID(SDL_Gamepad *gamepad)
     return SDL_GetGamepadID(gamepad);
 }
 
-inline const char *GetGamepadName(SDL_Gamepad *gamepad, std::source_location location = std::source_location::current())
+inline Result<const char *> GetGamepadName(SDL_Gamepad *gamepad, Location location = Location::current())
 {
     const char *result = SDL_GetGamepadName(gamepad);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline const char *GetGamepadPath(SDL_Gamepad *gamepad, std::source_location location = std::source_location::current())
+inline Result<const char *> GetGamepadPath(SDL_Gamepad *gamepad, Location location = Location::current())
 {
     const char *result = SDL_GetGamepadPath(gamepad);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -5469,12 +6076,13 @@ inline int GetGamepadPlayerIndex(SDL_Gamepad *gamepad)
     return SDL_GetGamepadPlayerIndex(gamepad);
 }
 
-inline void SetGamepadPlayerIndex(SDL_Gamepad *gamepad, int player_index, std::source_location location = std::source_location::current())
+inline Result<void> SetGamepadPlayerIndex(SDL_Gamepad *gamepad, int player_index, Location location = Location::current())
 {
-    if (!SDL_SetGamepadPlayerIndex(gamepad, player_index))
+    if (!SDL_SetGamepadPlayerIndex(gamepad, player_index)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline Uint16 GetGamepadVendor(SDL_Gamepad *gamepad)
@@ -5497,12 +6105,12 @@ inline Uint16 GetGamepadFirmwareVersion(SDL_Gamepad *gamepad)
     return SDL_GetGamepadFirmwareVersion(gamepad);
 }
 
-inline const char *GetGamepadSerial(SDL_Gamepad *gamepad, std::source_location location = std::source_location::current())
+inline Result<const char *> GetGamepadSerial(SDL_Gamepad *gamepad, Location location = Location::current())
 {
     const char *result = SDL_GetGamepadSerial(gamepad);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -5522,20 +6130,17 @@ inline SDL_PowerState GetGamepadPowerInfo(SDL_Gamepad *gamepad, int *percent)
     return SDL_GetGamepadPowerInfo(gamepad, percent);
 }
 
-inline void GamepadConnected(SDL_Gamepad *gamepad, std::source_location location = std::source_location::current())
+inline bool GamepadConnected(SDL_Gamepad *gamepad)
 {
-    if (!SDL_GamepadConnected(gamepad))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GamepadConnected(gamepad);
 }
 
-inline SDL_Joystick *GetGamepadJoystick(SDL_Gamepad *gamepad, std::source_location location = std::source_location::current())
+inline Result<SDL_Joystick *> GetGamepadJoystick(SDL_Gamepad *gamepad, Location location = Location::current())
 {
     SDL_Joystick *result = SDL_GetGamepadJoystick(gamepad);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Joystick *>(location);
     }
     return result;
 }
@@ -5545,20 +6150,17 @@ inline void SetGamepadEventsEnabled(bool enabled)
     SDL_SetGamepadEventsEnabled(enabled);
 }
 
-inline void GamepadEventsEnabled(std::source_location location = std::source_location::current())
+inline bool GamepadEventsEnabled()
 {
-    if (!SDL_GamepadEventsEnabled())
-    {
-        SDLThrow(location);
-    }
+    return SDL_GamepadEventsEnabled();
 }
 
-inline SDL_GamepadBinding **GetGamepadBindings(SDL_Gamepad *gamepad, int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_GamepadBinding **> GetGamepadBindings(SDL_Gamepad *gamepad, int *count, Location location = Location::current())
 {
     SDL_GamepadBinding **result = SDL_GetGamepadBindings(gamepad, count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GamepadBinding **>(location);
     }
     return result;
 }
@@ -5573,12 +6175,12 @@ inline SDL_GamepadType GetGamepadTypeFromString(const char *str)
     return SDL_GetGamepadTypeFromString(str);
 }
 
-inline const char *GetGamepadStringForType(SDL_GamepadType type, std::source_location location = std::source_location::current())
+inline Result<const char *> GetGamepadStringForType(SDL_GamepadType type, Location location = Location::current())
 {
     const char *result = SDL_GetGamepadStringForType(type);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -5588,22 +6190,19 @@ inline SDL_GamepadAxis GetGamepadAxisFromString(const char *str)
     return SDL_GetGamepadAxisFromString(str);
 }
 
-inline const char *GetGamepadStringForAxis(SDL_GamepadAxis axis, std::source_location location = std::source_location::current())
+inline Result<const char *> GetGamepadStringForAxis(SDL_GamepadAxis axis, Location location = Location::current())
 {
     const char *result = SDL_GetGamepadStringForAxis(axis);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline void GamepadHasAxis(SDL_Gamepad *gamepad, SDL_GamepadAxis axis, std::source_location location = std::source_location::current())
+inline bool GamepadHasAxis(SDL_Gamepad *gamepad, SDL_GamepadAxis axis)
 {
-    if (!SDL_GamepadHasAxis(gamepad, axis))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GamepadHasAxis(gamepad, axis);
 }
 
 inline Sint16 GetGamepadAxis(SDL_Gamepad *gamepad, SDL_GamepadAxis axis)
@@ -5616,30 +6215,24 @@ inline SDL_GamepadButton GetGamepadButtonFromString(const char *str)
     return SDL_GetGamepadButtonFromString(str);
 }
 
-inline const char *GetGamepadStringForButton(SDL_GamepadButton button, std::source_location location = std::source_location::current())
+inline Result<const char *> GetGamepadStringForButton(SDL_GamepadButton button, Location location = Location::current())
 {
     const char *result = SDL_GetGamepadStringForButton(button);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline void GamepadHasButton(SDL_Gamepad *gamepad, SDL_GamepadButton button, std::source_location location = std::source_location::current())
+inline bool GamepadHasButton(SDL_Gamepad *gamepad, SDL_GamepadButton button)
 {
-    if (!SDL_GamepadHasButton(gamepad, button))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GamepadHasButton(gamepad, button);
 }
 
-inline void GetGamepadButton(SDL_Gamepad *gamepad, SDL_GamepadButton button, std::source_location location = std::source_location::current())
+inline bool GetGamepadButton(SDL_Gamepad *gamepad, SDL_GamepadButton button)
 {
-    if (!SDL_GetGamepadButton(gamepad, button))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetGamepadButton(gamepad, button);
 }
 
 inline SDL_GamepadButtonLabel GetGamepadButtonLabelForType(SDL_GamepadType type, SDL_GamepadButton button)
@@ -5662,36 +6255,32 @@ inline int GetNumGamepadTouchpadFingers(SDL_Gamepad *gamepad, int touchpad)
     return SDL_GetNumGamepadTouchpadFingers(gamepad, touchpad);
 }
 
-inline void GetGamepadTouchpadFinger(SDL_Gamepad *gamepad, int touchpad, int finger, bool *down, float *x, float *y, float *pressure, std::source_location location = std::source_location::current())
+inline Result<void> GetGamepadTouchpadFinger(SDL_Gamepad *gamepad, int touchpad, int finger, bool *down, float *x, float *y, float *pressure, Location location = Location::current())
 {
-    if (!SDL_GetGamepadTouchpadFinger(gamepad, touchpad, finger, down, x, y, pressure))
+    if (!SDL_GetGamepadTouchpadFinger(gamepad, touchpad, finger, down, x, y, pressure)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GamepadHasSensor(SDL_Gamepad *gamepad, SDL_SensorType type, std::source_location location = std::source_location::current())
+inline bool GamepadHasSensor(SDL_Gamepad *gamepad, SDL_SensorType type)
 {
-    if (!SDL_GamepadHasSensor(gamepad, type))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GamepadHasSensor(gamepad, type);
 }
 
-inline void SetGamepadSensorEnabled(SDL_Gamepad *gamepad, SDL_SensorType type, bool enabled, std::source_location location = std::source_location::current())
+inline Result<void> SetGamepadSensorEnabled(SDL_Gamepad *gamepad, SDL_SensorType type, bool enabled, Location location = Location::current())
 {
-    if (!SDL_SetGamepadSensorEnabled(gamepad, type, enabled))
+    if (!SDL_SetGamepadSensorEnabled(gamepad, type, enabled)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GamepadSensorEnabled(SDL_Gamepad *gamepad, SDL_SensorType type, std::source_location location = std::source_location::current())
+inline bool GamepadSensorEnabled(SDL_Gamepad *gamepad, SDL_SensorType type)
 {
-    if (!SDL_GamepadSensorEnabled(gamepad, type))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GamepadSensorEnabled(gamepad, type);
 }
 
 inline float GetGamepadSensorDataRate(SDL_Gamepad *gamepad, SDL_SensorType type)
@@ -5699,44 +6288,49 @@ inline float GetGamepadSensorDataRate(SDL_Gamepad *gamepad, SDL_SensorType type)
     return SDL_GetGamepadSensorDataRate(gamepad, type);
 }
 
-inline void GetGamepadSensorData(SDL_Gamepad *gamepad, SDL_SensorType type, float *data, int num_values, std::source_location location = std::source_location::current())
+inline Result<void> GetGamepadSensorData(SDL_Gamepad *gamepad, SDL_SensorType type, float *data, int num_values, Location location = Location::current())
 {
-    if (!SDL_GetGamepadSensorData(gamepad, type, data, num_values))
+    if (!SDL_GetGamepadSensorData(gamepad, type, data, num_values)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RumbleGamepad(SDL_Gamepad *gamepad, Uint16 low_frequency_rumble, Uint16 high_frequency_rumble, Uint32 duration_ms, std::source_location location = std::source_location::current())
+inline Result<void> RumbleGamepad(SDL_Gamepad *gamepad, Uint16 low_frequency_rumble, Uint16 high_frequency_rumble, Uint32 duration_ms, Location location = Location::current())
 {
-    if (!SDL_RumbleGamepad(gamepad, low_frequency_rumble, high_frequency_rumble, duration_ms))
+    if (!SDL_RumbleGamepad(gamepad, low_frequency_rumble, high_frequency_rumble, duration_ms)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RumbleGamepadTriggers(SDL_Gamepad *gamepad, Uint16 left_rumble, Uint16 right_rumble, Uint32 duration_ms, std::source_location location = std::source_location::current())
+inline Result<void> RumbleGamepadTriggers(SDL_Gamepad *gamepad, Uint16 left_rumble, Uint16 right_rumble, Uint32 duration_ms, Location location = Location::current())
 {
-    if (!SDL_RumbleGamepadTriggers(gamepad, left_rumble, right_rumble, duration_ms))
+    if (!SDL_RumbleGamepadTriggers(gamepad, left_rumble, right_rumble, duration_ms)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetGamepadLED(SDL_Gamepad *gamepad, Uint8 red, Uint8 green, Uint8 blue, std::source_location location = std::source_location::current())
+inline Result<void> SetGamepadLED(SDL_Gamepad *gamepad, Uint8 red, Uint8 green, Uint8 blue, Location location = Location::current())
 {
-    if (!SDL_SetGamepadLED(gamepad, red, green, blue))
+    if (!SDL_SetGamepadLED(gamepad, red, green, blue)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SendGamepadEffect(SDL_Gamepad *gamepad, const void *data, int size, std::source_location location = std::source_location::current())
+inline Result<void> SendGamepadEffect(SDL_Gamepad *gamepad, const void *data, int size, Location location = Location::current())
 {
-    if (!SDL_SendGamepadEffect(gamepad, data, size))
+    if (!SDL_SendGamepadEffect(gamepad, data, size)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void CloseGamepad(SDL_Gamepad *gamepad)
@@ -5744,70 +6338,67 @@ inline void CloseGamepad(SDL_Gamepad *gamepad)
     SDL_CloseGamepad(gamepad);
 }
 
-inline const char *GetGamepadAppleSFSymbolsNameForButton(SDL_Gamepad *gamepad, SDL_GamepadButton button, std::source_location location = std::source_location::current())
+inline Result<const char *> GetGamepadAppleSFSymbolsNameForButton(SDL_Gamepad *gamepad, SDL_GamepadButton button, Location location = Location::current())
 {
     const char *result = SDL_GetGamepadAppleSFSymbolsNameForButton(gamepad, button);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline const char *GetGamepadAppleSFSymbolsNameForAxis(SDL_Gamepad *gamepad, SDL_GamepadAxis axis, std::source_location location = std::source_location::current())
+inline Result<const char *> GetGamepadAppleSFSymbolsNameForAxis(SDL_Gamepad *gamepad, SDL_GamepadAxis axis, Location location = Location::current())
 {
     const char *result = SDL_GetGamepadAppleSFSymbolsNameForAxis(gamepad, axis);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline void HasKeyboard(std::source_location location = std::source_location::current())
+inline bool HasKeyboard()
 {
-    if (!SDL_HasKeyboard())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasKeyboard();
 }
 
-inline SDL_KeyboardID *GetKeyboards(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_KeyboardID *> GetKeyboards(int *count, Location location = Location::current())
 {
     SDL_KeyboardID *result = SDL_GetKeyboards(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_KeyboardID *>(location);
     }
     return result;
 }
 
-inline const char *GetKeyboardNameForID(SDL_KeyboardID instance_id, std::source_location location = std::source_location::current())
+inline Result<const char *> GetKeyboardNameForID(SDL_KeyboardID instance_id, Location location = Location::current())
 {
     const char *result = SDL_GetKeyboardNameForID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline SDL_Window *GetKeyboardFocus(std::source_location location = std::source_location::current())
+inline Result<SDL_Window *> GetKeyboardFocus(Location location = Location::current())
 {
     SDL_Window *result = SDL_GetKeyboardFocus();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Window *>(location);
     }
     return result;
 }
 
-inline const bool *GetKeyboardState(int *numkeys, std::source_location location = std::source_location::current())
+inline Result<const bool *> GetKeyboardState(int *numkeys, Location location = Location::current())
 {
     const bool *result = SDL_GetKeyboardState(numkeys);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const bool *>(location);
     }
     return result;
 }
@@ -5837,20 +6428,21 @@ inline SDL_Scancode GetScancodeFromKey(SDL_Keycode key, SDL_Keymod *modstate)
     return SDL_GetScancodeFromKey(key, modstate);
 }
 
-inline void SetScancodeName(SDL_Scancode scancode, const char *name, std::source_location location = std::source_location::current())
+inline Result<void> SetScancodeName(SDL_Scancode scancode, const char *name, Location location = Location::current())
 {
-    if (!SDL_SetScancodeName(scancode, name))
+    if (!SDL_SetScancodeName(scancode, name)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline const char *GetScancodeName(SDL_Scancode scancode, std::source_location location = std::source_location::current())
+inline Result<const char *> GetScancodeName(SDL_Scancode scancode, Location location = Location::current())
 {
     const char *result = SDL_GetScancodeName(scancode);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -5860,12 +6452,12 @@ inline SDL_Scancode GetScancodeFromName(const char *name)
     return SDL_GetScancodeFromName(name);
 }
 
-inline const char *GetKeyName(SDL_Keycode key, std::source_location location = std::source_location::current())
+inline Result<const char *> GetKeyName(SDL_Keycode key, Location location = Location::current())
 {
     const char *result = SDL_GetKeyName(key);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -5875,112 +6467,106 @@ inline SDL_Keycode GetKeyFromName(const char *name)
     return SDL_GetKeyFromName(name);
 }
 
-inline void StartTextInput(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> StartTextInput(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_StartTextInput(window))
+    if (!SDL_StartTextInput(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void StartTextInputWithProperties(SDL_Window *window, SDL_PropertiesID props, std::source_location location = std::source_location::current())
+inline Result<void> StartTextInputWithProperties(SDL_Window *window, SDL_PropertiesID props, Location location = Location::current())
 {
-    if (!SDL_StartTextInputWithProperties(window, props))
+    if (!SDL_StartTextInputWithProperties(window, props)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void TextInputActive(SDL_Window *window, std::source_location location = std::source_location::current())
+inline bool TextInputActive(SDL_Window *window)
 {
-    if (!SDL_TextInputActive(window))
-    {
-        SDLThrow(location);
-    }
+    return SDL_TextInputActive(window);
 }
 
-inline void StopTextInput(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> StopTextInput(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_StopTextInput(window))
+    if (!SDL_StopTextInput(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ClearComposition(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> ClearComposition(SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_ClearComposition(window))
+    if (!SDL_ClearComposition(window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetTextInputArea(SDL_Window *window, const SDL_Rect *rect, int cursor, std::source_location location = std::source_location::current())
+inline Result<void> SetTextInputArea(SDL_Window *window, const SDL_Rect *rect, int cursor, Location location = Location::current())
 {
-    if (!SDL_SetTextInputArea(window, rect, cursor))
+    if (!SDL_SetTextInputArea(window, rect, cursor)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetTextInputArea(SDL_Window *window, SDL_Rect *rect, int *cursor, std::source_location location = std::source_location::current())
+inline Result<void> GetTextInputArea(SDL_Window *window, SDL_Rect *rect, int *cursor, Location location = Location::current())
 {
-    if (!SDL_GetTextInputArea(window, rect, cursor))
+    if (!SDL_GetTextInputArea(window, rect, cursor)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void HasScreenKeyboardSupport(std::source_location location = std::source_location::current())
+inline bool HasScreenKeyboardSupport()
 {
-    if (!SDL_HasScreenKeyboardSupport())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasScreenKeyboardSupport();
 }
 
-inline void ScreenKeyboardShown(SDL_Window *window, std::source_location location = std::source_location::current())
+inline bool ScreenKeyboardShown(SDL_Window *window)
 {
-    if (!SDL_ScreenKeyboardShown(window))
-    {
-        SDLThrow(location);
-    }
+    return SDL_ScreenKeyboardShown(window);
 }
 
-inline void HasMouse(std::source_location location = std::source_location::current())
+inline bool HasMouse()
 {
-    if (!SDL_HasMouse())
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasMouse();
 }
 
-inline SDL_MouseID *GetMice(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_MouseID *> GetMice(int *count, Location location = Location::current())
 {
     SDL_MouseID *result = SDL_GetMice(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_MouseID *>(location);
     }
     return result;
 }
 
-inline const char *GetMouseNameForID(SDL_MouseID instance_id, std::source_location location = std::source_location::current())
+inline Result<const char *> GetMouseNameForID(SDL_MouseID instance_id, Location location = Location::current())
 {
     const char *result = SDL_GetMouseNameForID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline SDL_Window *GetMouseFocus(std::source_location location = std::source_location::current())
+inline Result<SDL_Window *> GetMouseFocus(Location location = Location::current())
 {
     SDL_Window *result = SDL_GetMouseFocus();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Window *>(location);
     }
     return result;
 }
@@ -6005,92 +6591,93 @@ inline void WarpMouseInWindow(SDL_Window *window, float x, float y)
     SDL_WarpMouseInWindow(window, x, y);
 }
 
-inline void WarpMouseGlobal(float x, float y, std::source_location location = std::source_location::current())
+inline Result<void> WarpMouseGlobal(float x, float y, Location location = Location::current())
 {
-    if (!SDL_WarpMouseGlobal(x, y))
+    if (!SDL_WarpMouseGlobal(x, y)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetWindowRelativeMouseMode(SDL_Window *window, bool enabled, std::source_location location = std::source_location::current())
+inline Result<void> SetWindowRelativeMouseMode(SDL_Window *window, bool enabled, Location location = Location::current())
 {
-    if (!SDL_SetWindowRelativeMouseMode(window, enabled))
+    if (!SDL_SetWindowRelativeMouseMode(window, enabled)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetWindowRelativeMouseMode(SDL_Window *window, std::source_location location = std::source_location::current())
+inline bool GetWindowRelativeMouseMode(SDL_Window *window)
 {
-    if (!SDL_GetWindowRelativeMouseMode(window))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetWindowRelativeMouseMode(window);
 }
 
-inline void CaptureMouse(bool enabled, std::source_location location = std::source_location::current())
+inline Result<void> CaptureMouse(bool enabled, Location location = Location::current())
 {
-    if (!SDL_CaptureMouse(enabled))
+    if (!SDL_CaptureMouse(enabled)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_Cursor *CreateCursor(const Uint8 *data, const Uint8 *mask, int w, int h, int hot_x, int hot_y, std::source_location location = std::source_location::current())
+inline Result<SDL_Cursor *> CreateCursor(const Uint8 *data, const Uint8 *mask, int w, int h, int hot_x, int hot_y, Location location = Location::current())
 {
     SDL_Cursor *result = SDL_CreateCursor(data, mask, w, h, hot_x, hot_y);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Cursor *>(location);
     }
     return result;
 }
 
-inline SDL_Cursor *CreateColorCursor(SDL_Surface *surface, int hot_x, int hot_y, std::source_location location = std::source_location::current())
+inline Result<SDL_Cursor *> CreateColorCursor(SDL_Surface *surface, int hot_x, int hot_y, Location location = Location::current())
 {
     SDL_Cursor *result = SDL_CreateColorCursor(surface, hot_x, hot_y);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Cursor *>(location);
     }
     return result;
 }
 
-inline SDL_Cursor *CreateSystemCursor(SDL_SystemCursor id, std::source_location location = std::source_location::current())
+inline Result<SDL_Cursor *> CreateSystemCursor(SDL_SystemCursor id, Location location = Location::current())
 {
     SDL_Cursor *result = SDL_CreateSystemCursor(id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Cursor *>(location);
     }
     return result;
 }
 
-inline void SetCursor(SDL_Cursor *cursor, std::source_location location = std::source_location::current())
+inline Result<void> SetCursor(SDL_Cursor *cursor, Location location = Location::current())
 {
-    if (!SDL_SetCursor(cursor))
+    if (!SDL_SetCursor(cursor)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_Cursor *GetCursor(std::source_location location = std::source_location::current())
+inline Result<SDL_Cursor *> GetCursor(Location location = Location::current())
 {
     SDL_Cursor *result = SDL_GetCursor();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Cursor *>(location);
     }
     return result;
 }
 
-inline SDL_Cursor *GetDefaultCursor(std::source_location location = std::source_location::current())
+inline Result<SDL_Cursor *> GetDefaultCursor(Location location = Location::current())
 {
     SDL_Cursor *result = SDL_GetDefaultCursor();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Cursor *>(location);
     }
     return result;
 }
@@ -6100,46 +6687,45 @@ inline void DestroyCursor(SDL_Cursor *cursor)
     SDL_DestroyCursor(cursor);
 }
 
-inline void ShowCursor(std::source_location location = std::source_location::current())
+inline Result<void> ShowCursor(Location location = Location::current())
 {
-    if (!SDL_ShowCursor())
+    if (!SDL_ShowCursor()) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void HideCursor(std::source_location location = std::source_location::current())
+inline Result<void> HideCursor(Location location = Location::current())
 {
-    if (!SDL_HideCursor())
+    if (!SDL_HideCursor()) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void CursorVisible(std::source_location location = std::source_location::current())
+inline bool CursorVisible()
 {
-    if (!SDL_CursorVisible())
-    {
-        SDLThrow(location);
-    }
+    return SDL_CursorVisible();
 }
 
-inline SDL_TouchID *GetTouchDevices(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_TouchID *> GetTouchDevices(int *count, Location location = Location::current())
 {
     SDL_TouchID *result = SDL_GetTouchDevices(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_TouchID *>(location);
     }
     return result;
 }
 
-inline const char *GetTouchDeviceName(SDL_TouchID touchID, std::source_location location = std::source_location::current())
+inline Result<const char *> GetTouchDeviceName(SDL_TouchID touchID, Location location = Location::current())
 {
     const char *result = SDL_GetTouchDeviceName(touchID);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -6149,12 +6735,12 @@ inline SDL_TouchDeviceType GetTouchDeviceType(SDL_TouchID touchID)
     return SDL_GetTouchDeviceType(touchID);
 }
 
-inline SDL_Finger **GetTouchFingers(SDL_TouchID touchID, int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_Finger **> GetTouchFingers(SDL_TouchID touchID, int *count, Location location = Location::current())
 {
     SDL_Finger **result = SDL_GetTouchFingers(touchID, count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Finger **>(location);
     }
     return result;
 }
@@ -6169,20 +6755,14 @@ inline int PeepEvents(SDL_Event *events, int numevents, SDL_EventAction action,
     return SDL_PeepEvents(events, numevents, action, minType, maxType);
 }
 
-inline void HasEvent(Uint32 type, std::source_location location = std::source_location::current())
+inline bool HasEvent(Uint32 type)
 {
-    if (!SDL_HasEvent(type))
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasEvent(type);
 }
 
-inline void HasEvents(Uint32 minType, Uint32 maxType, std::source_location location = std::source_location::current())
+inline bool HasEvents(Uint32 minType, Uint32 maxType)
 {
-    if (!SDL_HasEvents(minType, maxType))
-    {
-        SDLThrow(location);
-    }
+    return SDL_HasEvents(minType, maxType);
 }
 
 inline void FlushEvent(Uint32 type)
@@ -6195,36 +6775,32 @@ inline void FlushEvents(Uint32 minType, Uint32 maxType)
     SDL_FlushEvents(minType, maxType);
 }
 
-inline void PollEvent(SDL_Event *event, std::source_location location = std::source_location::current())
+inline bool PollEvent(SDL_Event *event)
 {
-    if (!SDL_PollEvent(event))
-    {
-        SDLThrow(location);
-    }
+    return SDL_PollEvent(event);
 }
 
-inline void WaitEvent(SDL_Event *event, std::source_location location = std::source_location::current())
+inline Result<void> WaitEvent(SDL_Event *event, Location location = Location::current())
 {
-    if (!SDL_WaitEvent(event))
+    if (!SDL_WaitEvent(event)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WaitEventTimeout(SDL_Event *event, Sint32 timeoutMS, std::source_location location = std::source_location::current())
+inline bool WaitEventTimeout(SDL_Event *event, Sint32 timeoutMS)
 {
-    if (!SDL_WaitEventTimeout(event, timeoutMS))
-    {
-        SDLThrow(location);
-    }
+    return SDL_WaitEventTimeout(event, timeoutMS);
 }
 
-inline void PushEvent(SDL_Event *event, std::source_location location = std::source_location::current())
+inline Result<void> PushEvent(SDL_Event *event, Location location = Location::current())
 {
-    if (!SDL_PushEvent(event))
+    if (!SDL_PushEvent(event)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void SetEventFilter(SDL_EventFilter filter, void *userdata)
@@ -6232,20 +6808,18 @@ inline void SetEventFilter(SDL_EventFilter filter, void *userdata)
     SDL_SetEventFilter(filter, userdata);
 }
 
-inline void GetEventFilter(SDL_EventFilter *filter, void **userdata, std::source_location location = std::source_location::current())
+inline bool GetEventFilter(SDL_EventFilter *filter, void **userdata)
 {
-    if (!SDL_GetEventFilter(filter, userdata))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetEventFilter(filter, userdata);
 }
 
-inline void AddEventWatch(SDL_EventFilter filter, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> AddEventWatch(SDL_EventFilter filter, void *userdata, Location location = Location::current())
 {
-    if (!SDL_AddEventWatch(filter, userdata))
+    if (!SDL_AddEventWatch(filter, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void RemoveEventWatch(SDL_EventFilter filter, void *userdata)
@@ -6263,12 +6837,9 @@ inline void SetEventEnabled(Uint32 type, bool enabled)
     SDL_SetEventEnabled(type, enabled);
 }
 
-inline void EventEnabled(Uint32 type, std::source_location location = std::source_location::current())
+inline bool EventEnabled(Uint32 type)
 {
-    if (!SDL_EventEnabled(type))
-    {
-        SDLThrow(location);
-    }
+    return SDL_EventEnabled(type);
 }
 
 inline Uint32 RegisterEvents(int numevents)
@@ -6276,146 +6847,146 @@ inline Uint32 RegisterEvents(int numevents)
     return SDL_RegisterEvents(numevents);
 }
 
-inline SDL_Window *GetWindowFromEvent(const SDL_Event *event, std::source_location location = std::source_location::current())
+inline Result<SDL_Window *> GetWindowFromEvent(const SDL_Event *event, Location location = Location::current())
 {
     SDL_Window *result = SDL_GetWindowFromEvent(event);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Window *>(location);
     }
     return result;
 }
 
-inline const char *GetBasePath(std::source_location location = std::source_location::current())
+inline Result<const char *> GetBasePath(Location location = Location::current())
 {
     const char *result = SDL_GetBasePath();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline char *GetPrefPath(const char *org, const char *app, std::source_location location = std::source_location::current())
+inline Result<char *> GetPrefPath(const char *org, const char *app, Location location = Location::current())
 {
     char *result = SDL_GetPrefPath(org, app);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline const char *GetUserFolder(SDL_Folder folder, std::source_location location = std::source_location::current())
+inline Result<const char *> GetUserFolder(SDL_Folder folder, Location location = Location::current())
 {
     const char *result = SDL_GetUserFolder(folder);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline void CreateDirectory(const char *path, std::source_location location = std::source_location::current())
+inline Result<void> CreateDirectory(const char *path, Location location = Location::current())
 {
-    if (!SDL_CreateDirectory(path))
+    if (!SDL_CreateDirectory(path)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback callback, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback callback, void *userdata, Location location = Location::current())
 {
-    if (!SDL_EnumerateDirectory(path, callback, userdata))
+    if (!SDL_EnumerateDirectory(path, callback, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RemovePath(const char *path, std::source_location location = std::source_location::current())
+inline Result<void> RemovePath(const char *path, Location location = Location::current())
 {
-    if (!SDL_RemovePath(path))
+    if (!SDL_RemovePath(path)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenamePath(const char *oldpath, const char *newpath, std::source_location location = std::source_location::current())
+inline Result<void> RenamePath(const char *oldpath, const char *newpath, Location location = Location::current())
 {
-    if (!SDL_RenamePath(oldpath, newpath))
+    if (!SDL_RenamePath(oldpath, newpath)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void CopyFile(const char *oldpath, const char *newpath, std::source_location location = std::source_location::current())
+inline Result<void> CopyFile(const char *oldpath, const char *newpath, Location location = Location::current())
 {
-    if (!SDL_CopyFile(oldpath, newpath))
+    if (!SDL_CopyFile(oldpath, newpath)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetPathInfo(const char *path, SDL_PathInfo *info, std::source_location location = std::source_location::current())
+inline Result<void> GetPathInfo(const char *path, SDL_PathInfo *info, Location location = Location::current())
 {
-    if (!SDL_GetPathInfo(path, info))
+    if (!SDL_GetPathInfo(path, info)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline char **GlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, std::source_location location = std::source_location::current())
+inline Result<char **> GlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, Location location = Location::current())
 {
     char **result = SDL_GlobDirectory(path, pattern, flags, count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char **>(location);
     }
     return result;
 }
 
-inline char *GetCurrentDirectory(std::source_location location = std::source_location::current())
+inline Result<char *> GetCurrentDirectory(Location location = Location::current())
 {
     char *result = SDL_GetCurrentDirectory();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char *>(location);
     }
     return result;
 }
 
-inline void GPUSupportsShaderFormats(SDL_GPUShaderFormat format_flags, const char *name, std::source_location location = std::source_location::current())
+inline bool GPUSupportsShaderFormats(SDL_GPUShaderFormat format_flags, const char *name)
 {
-    if (!SDL_GPUSupportsShaderFormats(format_flags, name))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GPUSupportsShaderFormats(format_flags, name);
 }
 
-inline void GPUSupportsProperties(SDL_PropertiesID props, std::source_location location = std::source_location::current())
+inline bool GPUSupportsProperties(SDL_PropertiesID props)
 {
-    if (!SDL_GPUSupportsProperties(props))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GPUSupportsProperties(props);
 }
 
-inline SDL_GPUDevice *CreateGPUDevice(SDL_GPUShaderFormat format_flags, bool debug_mode, const char *name, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUDevice *> CreateGPUDevice(SDL_GPUShaderFormat format_flags, bool debug_mode, const char *name, Location location = Location::current())
 {
     SDL_GPUDevice *result = SDL_CreateGPUDevice(format_flags, debug_mode, name);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUDevice *>(location);
     }
     return result;
 }
 
-inline SDL_GPUDevice *CreateGPUDeviceWithProperties(SDL_PropertiesID props, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUDevice *> CreateGPUDeviceWithProperties(SDL_PropertiesID props, Location location = Location::current())
 {
     SDL_GPUDevice *result = SDL_CreateGPUDeviceWithProperties(props);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUDevice *>(location);
     }
     return result;
 }
@@ -6430,22 +7001,22 @@ inline int GetNumGPUDrivers()
     return SDL_GetNumGPUDrivers();
 }
 
-inline const char *GetGPUDriver(int index, std::source_location location = std::source_location::current())
+inline Result<const char *> GetGPUDriver(int index, Location location = Location::current())
 {
     const char *result = SDL_GetGPUDriver(index);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline const char *GetGPUDeviceDriver(SDL_GPUDevice *device, std::source_location location = std::source_location::current())
+inline Result<const char *> GetGPUDeviceDriver(SDL_GPUDevice *device, Location location = Location::current())
 {
     const char *result = SDL_GetGPUDeviceDriver(device);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -6455,72 +7026,72 @@ inline SDL_GPUShaderFormat GetGPUShaderFormats(SDL_GPUDevice *device)
     return SDL_GetGPUShaderFormats(device);
 }
 
-inline SDL_GPUComputePipeline *CreateGPUComputePipeline(SDL_GPUDevice *device, const SDL_GPUComputePipelineCreateInfo *createinfo, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUComputePipeline *> CreateGPUComputePipeline(SDL_GPUDevice *device, const SDL_GPUComputePipelineCreateInfo *createinfo, Location location = Location::current())
 {
     SDL_GPUComputePipeline *result = SDL_CreateGPUComputePipeline(device, createinfo);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUComputePipeline *>(location);
     }
     return result;
 }
 
-inline SDL_GPUGraphicsPipeline *CreateGPUGraphicsPipeline(SDL_GPUDevice *device, const SDL_GPUGraphicsPipelineCreateInfo *createinfo, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUGraphicsPipeline *> CreateGPUGraphicsPipeline(SDL_GPUDevice *device, const SDL_GPUGraphicsPipelineCreateInfo *createinfo, Location location = Location::current())
 {
     SDL_GPUGraphicsPipeline *result = SDL_CreateGPUGraphicsPipeline(device, createinfo);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUGraphicsPipeline *>(location);
     }
     return result;
 }
 
-inline SDL_GPUSampler *CreateGPUSampler(SDL_GPUDevice *device, const SDL_GPUSamplerCreateInfo *createinfo, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUSampler *> CreateGPUSampler(SDL_GPUDevice *device, const SDL_GPUSamplerCreateInfo *createinfo, Location location = Location::current())
 {
     SDL_GPUSampler *result = SDL_CreateGPUSampler(device, createinfo);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUSampler *>(location);
     }
     return result;
 }
 
-inline SDL_GPUShader *CreateGPUShader(SDL_GPUDevice *device, const SDL_GPUShaderCreateInfo *createinfo, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUShader *> CreateGPUShader(SDL_GPUDevice *device, const SDL_GPUShaderCreateInfo *createinfo, Location location = Location::current())
 {
     SDL_GPUShader *result = SDL_CreateGPUShader(device, createinfo);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUShader *>(location);
     }
     return result;
 }
 
-inline SDL_GPUTexture *CreateGPUTexture(SDL_GPUDevice *device, const SDL_GPUTextureCreateInfo *createinfo, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUTexture *> CreateGPUTexture(SDL_GPUDevice *device, const SDL_GPUTextureCreateInfo *createinfo, Location location = Location::current())
 {
     SDL_GPUTexture *result = SDL_CreateGPUTexture(device, createinfo);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUTexture *>(location);
     }
     return result;
 }
 
-inline SDL_GPUBuffer *CreateGPUBuffer(SDL_GPUDevice *device, const SDL_GPUBufferCreateInfo *createinfo, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUBuffer *> CreateGPUBuffer(SDL_GPUDevice *device, const SDL_GPUBufferCreateInfo *createinfo, Location location = Location::current())
 {
     SDL_GPUBuffer *result = SDL_CreateGPUBuffer(device, createinfo);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUBuffer *>(location);
     }
     return result;
 }
 
-inline SDL_GPUTransferBuffer *CreateGPUTransferBuffer(SDL_GPUDevice *device, const SDL_GPUTransferBufferCreateInfo *createinfo, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUTransferBuffer *> CreateGPUTransferBuffer(SDL_GPUDevice *device, const SDL_GPUTransferBufferCreateInfo *createinfo, Location location = Location::current())
 {
     SDL_GPUTransferBuffer *result = SDL_CreateGPUTransferBuffer(device, createinfo);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUTransferBuffer *>(location);
     }
     return result;
 }
@@ -6585,12 +7156,12 @@ inline void ReleaseGPUGraphicsPipeline(SDL_GPUDevice *device, SDL_GPUGraphicsPip
     SDL_ReleaseGPUGraphicsPipeline(device, graphics_pipeline);
 }
 
-inline SDL_GPUCommandBuffer *AcquireGPUCommandBuffer(SDL_GPUDevice *device, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUCommandBuffer *> AcquireGPUCommandBuffer(SDL_GPUDevice *device, Location location = Location::current())
 {
     SDL_GPUCommandBuffer *result = SDL_AcquireGPUCommandBuffer(device);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUCommandBuffer *>(location);
     }
     return result;
 }
@@ -6610,12 +7181,12 @@ inline void PushGPUComputeUniformData(SDL_GPUCommandBuffer *command_buffer, Uint
     SDL_PushGPUComputeUniformData(command_buffer, slot_index, data, length);
 }
 
-inline SDL_GPURenderPass *BeginGPURenderPass(SDL_GPUCommandBuffer *command_buffer, const SDL_GPUColorTargetInfo *color_target_infos, Uint32 num_color_targets, const SDL_GPUDepthStencilTargetInfo *depth_stencil_target_info, std::source_location location = std::source_location::current())
+inline Result<SDL_GPURenderPass *> BeginGPURenderPass(SDL_GPUCommandBuffer *command_buffer, const SDL_GPUColorTargetInfo *color_target_infos, Uint32 num_color_targets, const SDL_GPUDepthStencilTargetInfo *depth_stencil_target_info, Location location = Location::current())
 {
     SDL_GPURenderPass *result = SDL_BeginGPURenderPass(command_buffer, color_target_infos, num_color_targets, depth_stencil_target_info);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPURenderPass *>(location);
     }
     return result;
 }
@@ -6710,12 +7281,12 @@ inline void EndGPURenderPass(SDL_GPURenderPass *render_pass)
     SDL_EndGPURenderPass(render_pass);
 }
 
-inline SDL_GPUComputePass *BeginGPUComputePass(SDL_GPUCommandBuffer *command_buffer, const SDL_GPUStorageTextureReadWriteBinding *storage_texture_bindings, Uint32 num_storage_texture_bindings, const SDL_GPUStorageBufferReadWriteBinding *storage_buffer_bindings, Uint32 num_storage_buffer_bindings, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUComputePass *> BeginGPUComputePass(SDL_GPUCommandBuffer *command_buffer, const SDL_GPUStorageTextureReadWriteBinding *storage_texture_bindings, Uint32 num_storage_texture_bindings, const SDL_GPUStorageBufferReadWriteBinding *storage_buffer_bindings, Uint32 num_storage_buffer_bindings, Location location = Location::current())
 {
     SDL_GPUComputePass *result = SDL_BeginGPUComputePass(command_buffer, storage_texture_bindings, num_storage_texture_bindings, storage_buffer_bindings, num_storage_buffer_bindings);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUComputePass *>(location);
     }
     return result;
 }
@@ -6755,12 +7326,12 @@ inline void EndGPUComputePass(SDL_GPUComputePass *compute_pass)
     SDL_EndGPUComputePass(compute_pass);
 }
 
-inline void *MapGPUTransferBuffer(SDL_GPUDevice *device, SDL_GPUTransferBuffer *transfer_buffer, bool cycle, std::source_location location = std::source_location::current())
+inline Result<void *> MapGPUTransferBuffer(SDL_GPUDevice *device, SDL_GPUTransferBuffer *transfer_buffer, bool cycle, Location location = Location::current())
 {
     void *result = SDL_MapGPUTransferBuffer(device, transfer_buffer, cycle);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
@@ -6770,12 +7341,12 @@ inline void UnmapGPUTransferBuffer(SDL_GPUDevice *device, SDL_GPUTransferBuffer
     SDL_UnmapGPUTransferBuffer(device, transfer_buffer);
 }
 
-inline SDL_GPUCopyPass *BeginGPUCopyPass(SDL_GPUCommandBuffer *command_buffer, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUCopyPass *> BeginGPUCopyPass(SDL_GPUCommandBuffer *command_buffer, Location location = Location::current())
 {
     SDL_GPUCopyPass *result = SDL_BeginGPUCopyPass(command_buffer);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUCopyPass *>(location);
     }
     return result;
 }
@@ -6825,28 +7396,23 @@ inline void BlitGPUTexture(SDL_GPUCommandBuffer *command_buffer, const SDL_GPUBl
     SDL_BlitGPUTexture(command_buffer, info);
 }
 
-inline void WindowSupportsGPUSwapchainComposition(SDL_GPUDevice *device, SDL_Window *window, SDL_GPUSwapchainComposition swapchain_composition, std::source_location location = std::source_location::current())
+inline bool WindowSupportsGPUSwapchainComposition(SDL_GPUDevice *device, SDL_Window *window, SDL_GPUSwapchainComposition swapchain_composition)
 {
-    if (!SDL_WindowSupportsGPUSwapchainComposition(device, window, swapchain_composition))
-    {
-        SDLThrow(location);
-    }
+    return SDL_WindowSupportsGPUSwapchainComposition(device, window, swapchain_composition);
 }
 
-inline void WindowSupportsGPUPresentMode(SDL_GPUDevice *device, SDL_Window *window, SDL_GPUPresentMode present_mode, std::source_location location = std::source_location::current())
+inline bool WindowSupportsGPUPresentMode(SDL_GPUDevice *device, SDL_Window *window, SDL_GPUPresentMode present_mode)
 {
-    if (!SDL_WindowSupportsGPUPresentMode(device, window, present_mode))
-    {
-        SDLThrow(location);
-    }
+    return SDL_WindowSupportsGPUPresentMode(device, window, present_mode);
 }
 
-inline void ClaimWindowForGPUDevice(SDL_GPUDevice *device, SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> ClaimWindowForGPUDevice(SDL_GPUDevice *device, SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_ClaimWindowForGPUDevice(device, window))
+    if (!SDL_ClaimWindowForGPUDevice(device, window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void ReleaseWindowFromGPUDevice(SDL_GPUDevice *device, SDL_Window *window)
@@ -6854,20 +7420,22 @@ inline void ReleaseWindowFromGPUDevice(SDL_GPUDevice *device, SDL_Window *window
     SDL_ReleaseWindowFromGPUDevice(device, window);
 }
 
-inline void SetGPUSwapchainParameters(SDL_GPUDevice *device, SDL_Window *window, SDL_GPUSwapchainComposition swapchain_composition, SDL_GPUPresentMode present_mode, std::source_location location = std::source_location::current())
+inline Result<void> SetGPUSwapchainParameters(SDL_GPUDevice *device, SDL_Window *window, SDL_GPUSwapchainComposition swapchain_composition, SDL_GPUPresentMode present_mode, Location location = Location::current())
 {
-    if (!SDL_SetGPUSwapchainParameters(device, window, swapchain_composition, present_mode))
+    if (!SDL_SetGPUSwapchainParameters(device, window, swapchain_composition, present_mode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetGPUAllowedFramesInFlight(SDL_GPUDevice *device, Uint32 allowed_frames_in_flight, std::source_location location = std::source_location::current())
+inline Result<void> SetGPUAllowedFramesInFlight(SDL_GPUDevice *device, Uint32 allowed_frames_in_flight, Location location = Location::current())
 {
-    if (!SDL_SetGPUAllowedFramesInFlight(device, allowed_frames_in_flight))
+    if (!SDL_SetGPUAllowedFramesInFlight(device, allowed_frames_in_flight)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline SDL_GPUTextureFormat GetGPUSwapchainTextureFormat(SDL_GPUDevice *device, SDL_Window *window)
@@ -6875,78 +7443,82 @@ inline SDL_GPUTextureFormat GetGPUSwapchainTextureFormat(SDL_GPUDevice *device,
     return SDL_GetGPUSwapchainTextureFormat(device, window);
 }
 
-inline void AcquireGPUSwapchainTexture(SDL_GPUCommandBuffer *command_buffer, SDL_Window *window, SDL_GPUTexture **swapchain_texture, Uint32 *swapchain_texture_width, Uint32 *swapchain_texture_height, std::source_location location = std::source_location::current())
+inline Result<void> AcquireGPUSwapchainTexture(SDL_GPUCommandBuffer *command_buffer, SDL_Window *window, SDL_GPUTexture **swapchain_texture, Uint32 *swapchain_texture_width, Uint32 *swapchain_texture_height, Location location = Location::current())
 {
-    if (!SDL_AcquireGPUSwapchainTexture(command_buffer, window, swapchain_texture, swapchain_texture_width, swapchain_texture_height))
+    if (!SDL_AcquireGPUSwapchainTexture(command_buffer, window, swapchain_texture, swapchain_texture_width, swapchain_texture_height)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WaitForGPUSwapchain(SDL_GPUDevice *device, SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> WaitForGPUSwapchain(SDL_GPUDevice *device, SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_WaitForGPUSwapchain(device, window))
+    if (!SDL_WaitForGPUSwapchain(device, window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WaitAndAcquireGPUSwapchainTexture(SDL_GPUCommandBuffer *command_buffer, SDL_Window *window, SDL_GPUTexture **swapchain_texture, Uint32 *swapchain_texture_width, Uint32 *swapchain_texture_height, std::source_location location = std::source_location::current())
+inline Result<void> WaitAndAcquireGPUSwapchainTexture(SDL_GPUCommandBuffer *command_buffer, SDL_Window *window, SDL_GPUTexture **swapchain_texture, Uint32 *swapchain_texture_width, Uint32 *swapchain_texture_height, Location location = Location::current())
 {
-    if (!SDL_WaitAndAcquireGPUSwapchainTexture(command_buffer, window, swapchain_texture, swapchain_texture_width, swapchain_texture_height))
+    if (!SDL_WaitAndAcquireGPUSwapchainTexture(command_buffer, window, swapchain_texture, swapchain_texture_width, swapchain_texture_height)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SubmitGPUCommandBuffer(SDL_GPUCommandBuffer *command_buffer, std::source_location location = std::source_location::current())
+inline Result<void> SubmitGPUCommandBuffer(SDL_GPUCommandBuffer *command_buffer, Location location = Location::current())
 {
-    if (!SDL_SubmitGPUCommandBuffer(command_buffer))
+    if (!SDL_SubmitGPUCommandBuffer(command_buffer)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_GPUFence *SubmitGPUCommandBufferAndAcquireFence(SDL_GPUCommandBuffer *command_buffer, std::source_location location = std::source_location::current())
+inline Result<SDL_GPUFence *> SubmitGPUCommandBufferAndAcquireFence(SDL_GPUCommandBuffer *command_buffer, Location location = Location::current())
 {
     SDL_GPUFence *result = SDL_SubmitGPUCommandBufferAndAcquireFence(command_buffer);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_GPUFence *>(location);
     }
     return result;
 }
 
-inline void CancelGPUCommandBuffer(SDL_GPUCommandBuffer *command_buffer, std::source_location location = std::source_location::current())
+inline Result<void> CancelGPUCommandBuffer(SDL_GPUCommandBuffer *command_buffer, Location location = Location::current())
 {
-    if (!SDL_CancelGPUCommandBuffer(command_buffer))
+    if (!SDL_CancelGPUCommandBuffer(command_buffer)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WaitForGPUIdle(SDL_GPUDevice *device, std::source_location location = std::source_location::current())
+inline Result<void> WaitForGPUIdle(SDL_GPUDevice *device, Location location = Location::current())
 {
-    if (!SDL_WaitForGPUIdle(device))
+    if (!SDL_WaitForGPUIdle(device)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WaitForGPUFences(SDL_GPUDevice *device, bool wait_all, SDL_GPUFence *const *fences, Uint32 num_fences, std::source_location location = std::source_location::current())
+inline Result<void> WaitForGPUFences(SDL_GPUDevice *device, bool wait_all, SDL_GPUFence *const *fences, Uint32 num_fences, Location location = Location::current())
 {
-    if (!SDL_WaitForGPUFences(device, wait_all, fences, num_fences))
+    if (!SDL_WaitForGPUFences(device, wait_all, fences, num_fences)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void QueryGPUFence(SDL_GPUDevice *device, SDL_GPUFence *fence, std::source_location location = std::source_location::current())
+inline bool QueryGPUFence(SDL_GPUDevice *device, SDL_GPUFence *fence)
 {
-    if (!SDL_QueryGPUFence(device, fence))
-    {
-        SDLThrow(location);
-    }
+    return SDL_QueryGPUFence(device, fence);
 }
 
 inline void ReleaseGPUFence(SDL_GPUDevice *device, SDL_GPUFence *fence)
@@ -6959,20 +7531,14 @@ inline Uint32 GPUTextureFormatTexelBlockSize(SDL_GPUTextureFormat format)
     return SDL_GPUTextureFormatTexelBlockSize(format);
 }
 
-inline void GPUTextureSupportsFormat(SDL_GPUDevice *device, SDL_GPUTextureFormat format, SDL_GPUTextureType type, SDL_GPUTextureUsageFlags usage, std::source_location location = std::source_location::current())
+inline bool GPUTextureSupportsFormat(SDL_GPUDevice *device, SDL_GPUTextureFormat format, SDL_GPUTextureType type, SDL_GPUTextureUsageFlags usage)
 {
-    if (!SDL_GPUTextureSupportsFormat(device, format, type, usage))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GPUTextureSupportsFormat(device, format, type, usage);
 }
 
-inline void GPUTextureSupportsSampleCount(SDL_GPUDevice *device, SDL_GPUTextureFormat format, SDL_GPUSampleCount sample_count, std::source_location location = std::source_location::current())
+inline bool GPUTextureSupportsSampleCount(SDL_GPUDevice *device, SDL_GPUTextureFormat format, SDL_GPUSampleCount sample_count)
 {
-    if (!SDL_GPUTextureSupportsSampleCount(device, format, sample_count))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GPUTextureSupportsSampleCount(device, format, sample_count);
 }
 
 inline Uint32 CalculateGPUTextureFormatSize(SDL_GPUTextureFormat format, Uint32 width, Uint32 height, Uint32 depth_or_layer_count)
@@ -6980,42 +7546,42 @@ inline Uint32 CalculateGPUTextureFormatSize(SDL_GPUTextureFormat format, Uint32
     return SDL_CalculateGPUTextureFormatSize(format, width, height, depth_or_layer_count);
 }
 
-inline SDL_HapticID *GetHaptics(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_HapticID *> GetHaptics(int *count, Location location = Location::current())
 {
     SDL_HapticID *result = SDL_GetHaptics(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_HapticID *>(location);
     }
     return result;
 }
 
-inline const char *GetHapticNameForID(SDL_HapticID instance_id, std::source_location location = std::source_location::current())
+inline Result<const char *> GetHapticNameForID(SDL_HapticID instance_id, Location location = Location::current())
 {
     const char *result = SDL_GetHapticNameForID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline SDL_Haptic *OpenHaptic(SDL_HapticID instance_id, std::source_location location = std::source_location::current())
+inline Result<SDL_Haptic *> OpenHaptic(SDL_HapticID instance_id, Location location = Location::current())
 {
     SDL_Haptic *result = SDL_OpenHaptic(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Haptic *>(location);
     }
     return result;
 }
 
-inline SDL_Haptic *GetHapticFromID(SDL_HapticID instance_id, std::source_location location = std::source_location::current())
+inline Result<SDL_Haptic *> GetHapticFromID(SDL_HapticID instance_id, Location location = Location::current())
 {
     SDL_Haptic *result = SDL_GetHapticFromID(instance_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Haptic *>(location);
     }
     return result;
 }
@@ -7025,48 +7591,42 @@ inline SDL_HapticID GetHapticID(SDL_Haptic *haptic)
     return SDL_GetHapticID(haptic);
 }
 
-inline const char *GetHapticName(SDL_Haptic *haptic, std::source_location location = std::source_location::current())
+inline Result<const char *> GetHapticName(SDL_Haptic *haptic, Location location = Location::current())
 {
     const char *result = SDL_GetHapticName(haptic);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline void IsMouseHaptic(std::source_location location = std::source_location::current())
+inline bool IsMouseHaptic()
 {
-    if (!SDL_IsMouseHaptic())
-    {
-        SDLThrow(location);
-    }
+    return SDL_IsMouseHaptic();
 }
 
-inline SDL_Haptic *OpenHapticFromMouse(std::source_location location = std::source_location::current())
+inline Result<SDL_Haptic *> OpenHapticFromMouse(Location location = Location::current())
 {
     SDL_Haptic *result = SDL_OpenHapticFromMouse();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Haptic *>(location);
     }
     return result;
 }
 
-inline void IsJoystickHaptic(SDL_Joystick *joystick, std::source_location location = std::source_location::current())
+inline bool IsJoystickHaptic(SDL_Joystick *joystick)
 {
-    if (!SDL_IsJoystickHaptic(joystick))
-    {
-        SDLThrow(location);
-    }
+    return SDL_IsJoystickHaptic(joystick);
 }
 
-inline SDL_Haptic *OpenHapticFromJoystick(SDL_Joystick *joystick, std::source_location location = std::source_location::current())
+inline Result<SDL_Haptic *> OpenHapticFromJoystick(SDL_Joystick *joystick, Location location = Location::current())
 {
     SDL_Haptic *result = SDL_OpenHapticFromJoystick(joystick);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Haptic *>(location);
     }
     return result;
 }
@@ -7096,12 +7656,9 @@ inline int GetNumHapticAxes(SDL_Haptic *haptic)
     return SDL_GetNumHapticAxes(haptic);
 }
 
-inline void HapticEffectSupported(SDL_Haptic *haptic, const SDL_HapticEffect *effect, std::source_location location = std::source_location::current())
+inline bool HapticEffectSupported(SDL_Haptic *haptic, const SDL_HapticEffect *effect)
 {
-    if (!SDL_HapticEffectSupported(haptic, effect))
-    {
-        SDLThrow(location);
-    }
+    return SDL_HapticEffectSupported(haptic, effect);
 }
 
 inline int CreateHapticEffect(SDL_Haptic *haptic, const SDL_HapticEffect *effect)
@@ -7109,28 +7666,31 @@ inline int CreateHapticEffect(SDL_Haptic *haptic, const SDL_HapticEffect *effect
     return SDL_CreateHapticEffect(haptic, effect);
 }
 
-inline void UpdateHapticEffect(SDL_Haptic *haptic, int effect, const SDL_HapticEffect *data, std::source_location location = std::source_location::current())
+inline Result<void> UpdateHapticEffect(SDL_Haptic *haptic, int effect, const SDL_HapticEffect *data, Location location = Location::current())
 {
-    if (!SDL_UpdateHapticEffect(haptic, effect, data))
+    if (!SDL_UpdateHapticEffect(haptic, effect, data)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RunHapticEffect(SDL_Haptic *haptic, int effect, Uint32 iterations, std::source_location location = std::source_location::current())
+inline Result<void> RunHapticEffect(SDL_Haptic *haptic, int effect, Uint32 iterations, Location location = Location::current())
 {
-    if (!SDL_RunHapticEffect(haptic, effect, iterations))
+    if (!SDL_RunHapticEffect(haptic, effect, iterations)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void StopHapticEffect(SDL_Haptic *haptic, int effect, std::source_location location = std::source_location::current())
+inline Result<void> StopHapticEffect(SDL_Haptic *haptic, int effect, Location location = Location::current())
 {
-    if (!SDL_StopHapticEffect(haptic, effect))
+    if (!SDL_StopHapticEffect(haptic, effect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void DestroyHapticEffect(SDL_Haptic *haptic, int effect)
@@ -7138,84 +7698,86 @@ inline void DestroyHapticEffect(SDL_Haptic *haptic, int effect)
     SDL_DestroyHapticEffect(haptic, effect);
 }
 
-inline void GetHapticEffectStatus(SDL_Haptic *haptic, int effect, std::source_location location = std::source_location::current())
+inline bool GetHapticEffectStatus(SDL_Haptic *haptic, int effect)
 {
-    if (!SDL_GetHapticEffectStatus(haptic, effect))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetHapticEffectStatus(haptic, effect);
 }
 
-inline void SetHapticGain(SDL_Haptic *haptic, int gain, std::source_location location = std::source_location::current())
+inline Result<void> SetHapticGain(SDL_Haptic *haptic, int gain, Location location = Location::current())
 {
-    if (!SDL_SetHapticGain(haptic, gain))
+    if (!SDL_SetHapticGain(haptic, gain)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetHapticAutocenter(SDL_Haptic *haptic, int autocenter, std::source_location location = std::source_location::current())
+inline Result<void> SetHapticAutocenter(SDL_Haptic *haptic, int autocenter, Location location = Location::current())
 {
-    if (!SDL_SetHapticAutocenter(haptic, autocenter))
+    if (!SDL_SetHapticAutocenter(haptic, autocenter)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void PauseHaptic(SDL_Haptic *haptic, std::source_location location = std::source_location::current())
+inline Result<void> PauseHaptic(SDL_Haptic *haptic, Location location = Location::current())
 {
-    if (!SDL_PauseHaptic(haptic))
+    if (!SDL_PauseHaptic(haptic)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ResumeHaptic(SDL_Haptic *haptic, std::source_location location = std::source_location::current())
+inline Result<void> ResumeHaptic(SDL_Haptic *haptic, Location location = Location::current())
 {
-    if (!SDL_ResumeHaptic(haptic))
+    if (!SDL_ResumeHaptic(haptic)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void StopHapticEffects(SDL_Haptic *haptic, std::source_location location = std::source_location::current())
+inline Result<void> StopHapticEffects(SDL_Haptic *haptic, Location location = Location::current())
 {
-    if (!SDL_StopHapticEffects(haptic))
+    if (!SDL_StopHapticEffects(haptic)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void HapticRumbleSupported(SDL_Haptic *haptic, std::source_location location = std::source_location::current())
+inline bool HapticRumbleSupported(SDL_Haptic *haptic)
 {
-    if (!SDL_HapticRumbleSupported(haptic))
-    {
-        SDLThrow(location);
-    }
+    return SDL_HapticRumbleSupported(haptic);
 }
 
-inline void InitHapticRumble(SDL_Haptic *haptic, std::source_location location = std::source_location::current())
+inline Result<void> InitHapticRumble(SDL_Haptic *haptic, Location location = Location::current())
 {
-    if (!SDL_InitHapticRumble(haptic))
+    if (!SDL_InitHapticRumble(haptic)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void PlayHapticRumble(SDL_Haptic *haptic, float strength, Uint32 length, std::source_location location = std::source_location::current())
+inline Result<void> PlayHapticRumble(SDL_Haptic *haptic, float strength, Uint32 length, Location location = Location::current())
 {
-    if (!SDL_PlayHapticRumble(haptic, strength, length))
+    if (!SDL_PlayHapticRumble(haptic, strength, length)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void StopHapticRumble(SDL_Haptic *haptic, std::source_location location = std::source_location::current())
+inline Result<void> StopHapticRumble(SDL_Haptic *haptic, Location location = Location::current())
 {
-    if (!SDL_StopHapticRumble(haptic))
+    if (!SDL_StopHapticRumble(haptic)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline int hid_init()
@@ -7233,12 +7795,12 @@ inline Uint32 hid_device_change_count()
     return SDL_hid_device_change_count();
 }
 
-inline SDL_hid_device_info *hid_enumerate(unsigned short vendor_id, unsigned short product_id, std::source_location location = std::source_location::current())
+inline Result<SDL_hid_device_info *> hid_enumerate(unsigned short vendor_id, unsigned short product_id, Location location = Location::current())
 {
     SDL_hid_device_info *result = SDL_hid_enumerate(vendor_id, product_id);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_hid_device_info *>(location);
     }
     return result;
 }
@@ -7248,22 +7810,22 @@ inline void hid_free_enumeration(SDL_hid_device_info *devs)
     SDL_hid_free_enumeration(devs);
 }
 
-inline SDL_hid_device *hid_open(unsigned short vendor_id, unsigned short product_id, const wchar_t *serial_number, std::source_location location = std::source_location::current())
+inline Result<SDL_hid_device *> hid_open(unsigned short vendor_id, unsigned short product_id, const wchar_t *serial_number, Location location = Location::current())
 {
     SDL_hid_device *result = SDL_hid_open(vendor_id, product_id, serial_number);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_hid_device *>(location);
     }
     return result;
 }
 
-inline SDL_hid_device *hid_open_path(const char *path, std::source_location location = std::source_location::current())
+inline Result<SDL_hid_device *> hid_open_path(const char *path, Location location = Location::current())
 {
     SDL_hid_device *result = SDL_hid_open_path(path);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_hid_device *>(location);
     }
     return result;
 }
@@ -7328,12 +7890,12 @@ inline int hid_get_indexed_string(SDL_hid_device *dev, int string_index, wchar_t
     return SDL_hid_get_indexed_string(dev, string_index, string, maxlen);
 }
 
-inline SDL_hid_device_info *hid_get_device_info(SDL_hid_device *dev, std::source_location location = std::source_location::current())
+inline Result<SDL_hid_device_info *> hid_get_device_info(SDL_hid_device *dev, Location location = Location::current())
 {
     SDL_hid_device_info *result = SDL_hid_get_device_info(dev);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_hid_device_info *>(location);
     }
     return result;
 }
@@ -7348,28 +7910,31 @@ inline void hid_ble_scan(bool active)
     SDL_hid_ble_scan(active);
 }
 
-inline void SetHintWithPriority(const char *name, const char *value, SDL_HintPriority priority, std::source_location location = std::source_location::current())
+inline Result<void> SetHintWithPriority(const char *name, const char *value, SDL_HintPriority priority, Location location = Location::current())
 {
-    if (!SDL_SetHintWithPriority(name, value, priority))
+    if (!SDL_SetHintWithPriority(name, value, priority)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetHint(const char *name, const char *value, std::source_location location = std::source_location::current())
+inline Result<void> SetHint(const char *name, const char *value, Location location = Location::current())
 {
-    if (!SDL_SetHint(name, value))
+    if (!SDL_SetHint(name, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ResetHint(const char *name, std::source_location location = std::source_location::current())
+inline Result<void> ResetHint(const char *name, Location location = Location::current())
 {
-    if (!SDL_ResetHint(name))
+    if (!SDL_ResetHint(name)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void ResetHints()
@@ -7377,30 +7942,28 @@ inline void ResetHints()
     SDL_ResetHints();
 }
 
-inline const char *GetHint(const char *name, std::source_location location = std::source_location::current())
+inline Result<const char *> GetHint(const char *name, Location location = Location::current())
 {
     const char *result = SDL_GetHint(name);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline void GetHintBoolean(const char *name, bool default_value, std::source_location location = std::source_location::current())
+inline bool GetHintBoolean(const char *name, bool default_value)
 {
-    if (!SDL_GetHintBoolean(name, default_value))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetHintBoolean(name, default_value);
 }
 
-inline void AddHintCallback(const char *name, SDL_HintCallback callback, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> AddHintCallback(const char *name, SDL_HintCallback callback, void *userdata, Location location = Location::current())
 {
-    if (!SDL_AddHintCallback(name, callback, userdata))
+    if (!SDL_AddHintCallback(name, callback, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void RemoveHintCallback(const char *name, SDL_HintCallback callback, void *userdata)
@@ -7408,20 +7971,22 @@ inline void RemoveHintCallback(const char *name, SDL_HintCallback callback, void
     SDL_RemoveHintCallback(name, callback, userdata);
 }
 
-inline void Init(SDL_InitFlags flags, std::source_location location = std::source_location::current())
+inline Result<void> Init(SDL_InitFlags flags, Location location = Location::current())
 {
-    if (!SDL_Init(flags))
+    if (!SDL_Init(flags)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void InitSubSystem(SDL_InitFlags flags, std::source_location location = std::source_location::current())
+inline Result<void> InitSubSystem(SDL_InitFlags flags, Location location = Location::current())
 {
-    if (!SDL_InitSubSystem(flags))
+    if (!SDL_InitSubSystem(flags)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void QuitSubSystem(SDL_InitFlags flags)
@@ -7439,54 +8004,54 @@ inline void Quit()
     SDL_Quit();
 }
 
-inline void IsMainThread(std::source_location location = std::source_location::current())
+inline bool IsMainThread()
 {
-    if (!SDL_IsMainThread())
-    {
-        SDLThrow(location);
-    }
+    return SDL_IsMainThread();
 }
 
-inline void RunOnMainThread(SDL_MainThreadCallback callback, void *userdata, bool wait_complete, std::source_location location = std::source_location::current())
+inline Result<void> RunOnMainThread(SDL_MainThreadCallback callback, void *userdata, bool wait_complete, Location location = Location::current())
 {
-    if (!SDL_RunOnMainThread(callback, userdata, wait_complete))
+    if (!SDL_RunOnMainThread(callback, userdata, wait_complete)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetAppMetadata(const char *appname, const char *appversion, const char *appidentifier, std::source_location location = std::source_location::current())
+inline Result<void> SetAppMetadata(const char *appname, const char *appversion, const char *appidentifier, Location location = Location::current())
 {
-    if (!SDL_SetAppMetadata(appname, appversion, appidentifier))
+    if (!SDL_SetAppMetadata(appname, appversion, appidentifier)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetAppMetadataProperty(const char *name, const char *value, std::source_location location = std::source_location::current())
+inline Result<void> SetAppMetadataProperty(const char *name, const char *value, Location location = Location::current())
 {
-    if (!SDL_SetAppMetadataProperty(name, value))
+    if (!SDL_SetAppMetadataProperty(name, value)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline const char *GetAppMetadataProperty(const char *name, std::source_location location = std::source_location::current())
+inline Result<const char *> GetAppMetadataProperty(const char *name, Location location = Location::current())
 {
     const char *result = SDL_GetAppMetadataProperty(name);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline SDL_SharedObject *LoadObject(const char *sofile, std::source_location location = std::source_location::current())
+inline Result<SDL_SharedObject *> LoadObject(const char *sofile, Location location = Location::current())
 {
     SDL_SharedObject *result = SDL_LoadObject(sofile);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_SharedObject *>(location);
     }
     return result;
 }
@@ -7501,12 +8066,12 @@ inline void UnloadObject(SDL_SharedObject *handle)
     SDL_UnloadObject(handle);
 }
 
-inline SDL_Locale **GetPreferredLocales(int *count, std::source_location location = std::source_location::current())
+inline Result<SDL_Locale **> GetPreferredLocales(int *count, Location location = Location::current())
 {
     SDL_Locale **result = SDL_GetPreferredLocales(count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Locale **>(location);
     }
     return result;
 }
@@ -7531,12 +8096,13 @@ inline void ResetLogPriorities()
     SDL_ResetLogPriorities();
 }
 
-inline void SetLogPriorityPrefix(SDL_LogPriority priority, const char *prefix, std::source_location location = std::source_location::current())
+inline Result<void> SetLogPriorityPrefix(SDL_LogPriority priority, const char *prefix, Location location = Location::current())
 {
-    if (!SDL_SetLogPriorityPrefix(priority, prefix))
+    if (!SDL_SetLogPriorityPrefix(priority, prefix)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void LogMessageV(int category, SDL_LogPriority priority, const char *fmt, va_list ap)
@@ -7559,20 +8125,22 @@ inline void SetLogOutputFunction(SDL_LogOutputFunction callback, void *userdata)
     SDL_SetLogOutputFunction(callback, userdata);
 }
 
-inline void ShowMessageBox(const SDL_MessageBoxData *messageboxdata, int *buttonid, std::source_location location = std::source_location::current())
+inline Result<void> ShowMessageBox(const SDL_MessageBoxData *messageboxdata, int *buttonid, Location location = Location::current())
 {
-    if (!SDL_ShowMessageBox(messageboxdata, buttonid))
+    if (!SDL_ShowMessageBox(messageboxdata, buttonid)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ShowSimpleMessageBox(SDL_MessageBoxFlags flags, const char *title, const char *message, SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<void> ShowSimpleMessageBox(SDL_MessageBoxFlags flags, const char *title, const char *message, SDL_Window *window, Location location = Location::current())
 {
-    if (!SDL_ShowSimpleMessageBox(flags, title, message, window))
+    if (!SDL_ShowSimpleMessageBox(flags, title, message, window)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline SDL_MetalView Metal_CreateView(SDL_Window *window)
@@ -7585,50 +8153,51 @@ inline void Metal_DestroyView(SDL_MetalView view)
     SDL_Metal_DestroyView(view);
 }
 
-inline void *Metal_GetLayer(SDL_MetalView view, std::source_location location = std::source_location::current())
+inline Result<void *> Metal_GetLayer(SDL_MetalView view, Location location = Location::current())
 {
     void *result = SDL_Metal_GetLayer(view);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline void OpenURL(const char *url, std::source_location location = std::source_location::current())
+inline Result<void> OpenURL(const char *url, Location location = Location::current())
 {
-    if (!SDL_OpenURL(url))
+    if (!SDL_OpenURL(url)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline const char *GetPlatform(std::source_location location = std::source_location::current())
+inline Result<const char *> GetPlatform(Location location = Location::current())
 {
     const char *result = SDL_GetPlatform();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline SDL_Process *CreateProcess(const char *const *args, bool pipe_stdio, std::source_location location = std::source_location::current())
+inline Result<SDL_Process *> CreateProcess(const char *const *args, bool pipe_stdio, Location location = Location::current())
 {
     SDL_Process *result = SDL_CreateProcess(args, pipe_stdio);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Process *>(location);
     }
     return result;
 }
 
-inline SDL_Process *CreateProcessWithProperties(SDL_PropertiesID props, std::source_location location = std::source_location::current())
+inline Result<SDL_Process *> CreateProcessWithProperties(SDL_PropertiesID props, Location location = Location::current())
 {
     SDL_Process *result = SDL_CreateProcessWithProperties(props);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Process *>(location);
     }
     return result;
 }
@@ -7638,50 +8207,48 @@ inline SDL_PropertiesID GetProcessProperties(SDL_Process *process)
     return SDL_GetProcessProperties(process);
 }
 
-inline void *ReadProcess(SDL_Process *process, size_t *datasize, int *exitcode, std::source_location location = std::source_location::current())
+inline Result<void *> ReadProcess(SDL_Process *process, size_t *datasize, int *exitcode, Location location = Location::current())
 {
     void *result = SDL_ReadProcess(process, datasize, exitcode);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline SDL_IOStream *GetProcessInput(SDL_Process *process, std::source_location location = std::source_location::current())
+inline Result<SDL_IOStream *> GetProcessInput(SDL_Process *process, Location location = Location::current())
 {
     SDL_IOStream *result = SDL_GetProcessInput(process);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_IOStream *>(location);
     }
     return result;
 }
 
-inline SDL_IOStream *GetProcessOutput(SDL_Process *process, std::source_location location = std::source_location::current())
+inline Result<SDL_IOStream *> GetProcessOutput(SDL_Process *process, Location location = Location::current())
 {
     SDL_IOStream *result = SDL_GetProcessOutput(process);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_IOStream *>(location);
     }
     return result;
 }
 
-inline void KillProcess(SDL_Process *process, bool force, std::source_location location = std::source_location::current())
+inline Result<void> KillProcess(SDL_Process *process, bool force, Location location = Location::current())
 {
-    if (!SDL_KillProcess(process, force))
+    if (!SDL_KillProcess(process, force)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WaitProcess(SDL_Process *process, bool block, int *exitcode, std::source_location location = std::source_location::current())
+inline bool WaitProcess(SDL_Process *process, bool block, int *exitcode)
 {
-    if (!SDL_WaitProcess(process, block, exitcode))
-    {
-        SDLThrow(location);
-    }
+    return SDL_WaitProcess(process, block, exitcode);
 }
 
 inline void DestroyProcess(SDL_Process *process)
@@ -7694,80 +8261,81 @@ inline int GetNumRenderDrivers()
     return SDL_GetNumRenderDrivers();
 }
 
-inline const char *GetRenderDriver(int index, std::source_location location = std::source_location::current())
+inline Result<const char *> GetRenderDriver(int index, Location location = Location::current())
 {
     const char *result = SDL_GetRenderDriver(index);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
-inline void CreateWindowAndRenderer(const char *title, int width, int height, SDL_WindowFlags window_flags, SDL_Window **window, SDL_Renderer **renderer, std::source_location location = std::source_location::current())
+inline Result<void> CreateWindowAndRenderer(const char *title, int width, int height, SDL_WindowFlags window_flags, SDL_Window **window, SDL_Renderer **renderer, Location location = Location::current())
 {
-    if (!SDL_CreateWindowAndRenderer(title, width, height, window_flags, window, renderer))
+    if (!SDL_CreateWindowAndRenderer(title, width, height, window_flags, window, renderer)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_Renderer *CreateRenderer(SDL_Window *window, const char *name, std::source_location location = std::source_location::current())
+inline Result<SDL_Renderer *> CreateRenderer(SDL_Window *window, const char *name, Location location = Location::current())
 {
     SDL_Renderer *result = SDL_CreateRenderer(window, name);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Renderer *>(location);
     }
     return result;
 }
 
-inline SDL_Renderer *CreateRendererWithProperties(SDL_PropertiesID props, std::source_location location = std::source_location::current())
+inline Result<SDL_Renderer *> CreateRendererWithProperties(SDL_PropertiesID props, Location location = Location::current())
 {
     SDL_Renderer *result = SDL_CreateRendererWithProperties(props);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Renderer *>(location);
     }
     return result;
 }
 
-inline SDL_Renderer *CreateSoftwareRenderer(SDL_Surface *surface, std::source_location location = std::source_location::current())
+inline Result<SDL_Renderer *> CreateSoftwareRenderer(SDL_Surface *surface, Location location = Location::current())
 {
     SDL_Renderer *result = SDL_CreateSoftwareRenderer(surface);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Renderer *>(location);
     }
     return result;
 }
 
-inline SDL_Renderer *GetRenderer(SDL_Window *window, std::source_location location = std::source_location::current())
+inline Result<SDL_Renderer *> GetRenderer(SDL_Window *window, Location location = Location::current())
 {
     SDL_Renderer *result = SDL_GetRenderer(window);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Renderer *>(location);
     }
     return result;
 }
 
-inline SDL_Window *GetRenderWindow(SDL_Renderer *renderer, std::source_location location = std::source_location::current())
+inline Result<SDL_Window *> GetRenderWindow(SDL_Renderer *renderer, Location location = Location::current())
 {
     SDL_Window *result = SDL_GetRenderWindow(renderer);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Window *>(location);
     }
     return result;
 }
 
-inline const char *GetRendererName(SDL_Renderer *renderer, std::source_location location = std::source_location::current())
+inline Result<const char *> GetRendererName(SDL_Renderer *renderer, Location location = Location::current())
 {
     const char *result = SDL_GetRendererName(renderer);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -7777,48 +8345,50 @@ inline SDL_PropertiesID GetRendererProperties(SDL_Renderer *renderer)
     return SDL_GetRendererProperties(renderer);
 }
 
-inline void GetRenderOutputSize(SDL_Renderer *renderer, int *w, int *h, std::source_location location = std::source_location::current())
+inline Result<void> GetRenderOutputSize(SDL_Renderer *renderer, int *w, int *h, Location location = Location::current())
 {
-    if (!SDL_GetRenderOutputSize(renderer, w, h))
+    if (!SDL_GetRenderOutputSize(renderer, w, h)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetCurrentRenderOutputSize(SDL_Renderer *renderer, int *w, int *h, std::source_location location = std::source_location::current())
+inline Result<void> GetCurrentRenderOutputSize(SDL_Renderer *renderer, int *w, int *h, Location location = Location::current())
 {
-    if (!SDL_GetCurrentRenderOutputSize(renderer, w, h))
+    if (!SDL_GetCurrentRenderOutputSize(renderer, w, h)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_Texture *CreateTexture(SDL_Renderer *renderer, SDL_PixelFormat format, SDL_TextureAccess access, int w, int h, std::source_location location = std::source_location::current())
+inline Result<SDL_Texture *> CreateTexture(SDL_Renderer *renderer, SDL_PixelFormat format, SDL_TextureAccess access, int w, int h, Location location = Location::current())
 {
     SDL_Texture *result = SDL_CreateTexture(renderer, format, access, w, h);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Texture *>(location);
     }
     return result;
 }
 
-inline SDL_Texture *CreateTextureFromSurface(SDL_Renderer *renderer, SDL_Surface *surface, std::source_location location = std::source_location::current())
+inline Result<SDL_Texture *> CreateTextureFromSurface(SDL_Renderer *renderer, SDL_Surface *surface, Location location = Location::current())
 {
     SDL_Texture *result = SDL_CreateTextureFromSurface(renderer, surface);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Texture *>(location);
     }
     return result;
 }
 
-inline SDL_Texture *CreateTextureWithProperties(SDL_Renderer *renderer, SDL_PropertiesID props, std::source_location location = std::source_location::current())
+inline Result<SDL_Texture *> CreateTextureWithProperties(SDL_Renderer *renderer, SDL_PropertiesID props, Location location = Location::current())
 {
     SDL_Texture *result = SDL_CreateTextureWithProperties(renderer, props);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Texture *>(location);
     }
     return result;
 }
@@ -7828,158 +8398,176 @@ inline SDL_PropertiesID GetTextureProperties(SDL_Texture *texture)
     return SDL_GetTextureProperties(texture);
 }
 
-inline SDL_Renderer *GetRendererFromTexture(SDL_Texture *texture, std::source_location location = std::source_location::current())
+inline Result<SDL_Renderer *> GetRendererFromTexture(SDL_Texture *texture, Location location = Location::current())
 {
     SDL_Renderer *result = SDL_GetRendererFromTexture(texture);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Renderer *>(location);
     }
     return result;
 }
 
-inline void GetTextureSize(SDL_Texture *texture, float *w, float *h, std::source_location location = std::source_location::current())
+inline Result<void> GetTextureSize(SDL_Texture *texture, float *w, float *h, Location location = Location::current())
 {
-    if (!SDL_GetTextureSize(texture, w, h))
+    if (!SDL_GetTextureSize(texture, w, h)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetTextureColorMod(SDL_Texture *texture, Uint8 r, Uint8 g, Uint8 b, std::source_location location = std::source_location::current())
+inline Result<void> SetTextureColorMod(SDL_Texture *texture, Uint8 r, Uint8 g, Uint8 b, Location location = Location::current())
 {
-    if (!SDL_SetTextureColorMod(texture, r, g, b))
+    if (!SDL_SetTextureColorMod(texture, r, g, b)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetTextureColorModFloat(SDL_Texture *texture, float r, float g, float b, std::source_location location = std::source_location::current())
+inline Result<void> SetTextureColorModFloat(SDL_Texture *texture, float r, float g, float b, Location location = Location::current())
 {
-    if (!SDL_SetTextureColorModFloat(texture, r, g, b))
+    if (!SDL_SetTextureColorModFloat(texture, r, g, b)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetTextureColorMod(SDL_Texture *texture, Uint8 *r, Uint8 *g, Uint8 *b, std::source_location location = std::source_location::current())
+inline Result<void> GetTextureColorMod(SDL_Texture *texture, Uint8 *r, Uint8 *g, Uint8 *b, Location location = Location::current())
 {
-    if (!SDL_GetTextureColorMod(texture, r, g, b))
+    if (!SDL_GetTextureColorMod(texture, r, g, b)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetTextureColorModFloat(SDL_Texture *texture, float *r, float *g, float *b, std::source_location location = std::source_location::current())
+inline Result<void> GetTextureColorModFloat(SDL_Texture *texture, float *r, float *g, float *b, Location location = Location::current())
 {
-    if (!SDL_GetTextureColorModFloat(texture, r, g, b))
+    if (!SDL_GetTextureColorModFloat(texture, r, g, b)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetTextureAlphaMod(SDL_Texture *texture, Uint8 alpha, std::source_location location = std::source_location::current())
+inline Result<void> SetTextureAlphaMod(SDL_Texture *texture, Uint8 alpha, Location location = Location::current())
 {
-    if (!SDL_SetTextureAlphaMod(texture, alpha))
+    if (!SDL_SetTextureAlphaMod(texture, alpha)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetTextureAlphaModFloat(SDL_Texture *texture, float alpha, std::source_location location = std::source_location::current())
+inline Result<void> SetTextureAlphaModFloat(SDL_Texture *texture, float alpha, Location location = Location::current())
 {
-    if (!SDL_SetTextureAlphaModFloat(texture, alpha))
+    if (!SDL_SetTextureAlphaModFloat(texture, alpha)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetTextureAlphaMod(SDL_Texture *texture, Uint8 *alpha, std::source_location location = std::source_location::current())
+inline Result<void> GetTextureAlphaMod(SDL_Texture *texture, Uint8 *alpha, Location location = Location::current())
 {
-    if (!SDL_GetTextureAlphaMod(texture, alpha))
+    if (!SDL_GetTextureAlphaMod(texture, alpha)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetTextureAlphaModFloat(SDL_Texture *texture, float *alpha, std::source_location location = std::source_location::current())
+inline Result<void> GetTextureAlphaModFloat(SDL_Texture *texture, float *alpha, Location location = Location::current())
 {
-    if (!SDL_GetTextureAlphaModFloat(texture, alpha))
+    if (!SDL_GetTextureAlphaModFloat(texture, alpha)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetTextureBlendMode(SDL_Texture *texture, SDL_BlendMode blendMode, std::source_location location = std::source_location::current())
+inline Result<void> SetTextureBlendMode(SDL_Texture *texture, SDL_BlendMode blendMode, Location location = Location::current())
 {
-    if (!SDL_SetTextureBlendMode(texture, blendMode))
+    if (!SDL_SetTextureBlendMode(texture, blendMode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetTextureBlendMode(SDL_Texture *texture, SDL_BlendMode *blendMode, std::source_location location = std::source_location::current())
+inline Result<void> GetTextureBlendMode(SDL_Texture *texture, SDL_BlendMode *blendMode, Location location = Location::current())
 {
-    if (!SDL_GetTextureBlendMode(texture, blendMode))
+    if (!SDL_GetTextureBlendMode(texture, blendMode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetTextureScaleMode(SDL_Texture *texture, SDL_ScaleMode scaleMode, std::source_location location = std::source_location::current())
+inline Result<void> SetTextureScaleMode(SDL_Texture *texture, SDL_ScaleMode scaleMode, Location location = Location::current())
 {
-    if (!SDL_SetTextureScaleMode(texture, scaleMode))
+    if (!SDL_SetTextureScaleMode(texture, scaleMode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetTextureScaleMode(SDL_Texture *texture, SDL_ScaleMode *scaleMode, std::source_location location = std::source_location::current())
+inline Result<void> GetTextureScaleMode(SDL_Texture *texture, SDL_ScaleMode *scaleMode, Location location = Location::current())
 {
-    if (!SDL_GetTextureScaleMode(texture, scaleMode))
+    if (!SDL_GetTextureScaleMode(texture, scaleMode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch, std::source_location location = std::source_location::current())
+inline Result<void> UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect, const void *pixels, int pitch, Location location = Location::current())
 {
-    if (!SDL_UpdateTexture(texture, rect, pixels, pitch))
+    if (!SDL_UpdateTexture(texture, rect, pixels, pitch)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void UpdateYUVTexture(SDL_Texture *texture, const SDL_Rect *rect, const Uint8 *Yplane, int Ypitch, const Uint8 *Uplane, int Upitch, const Uint8 *Vplane, int Vpitch, std::source_location location = std::source_location::current())
+inline Result<void> UpdateYUVTexture(SDL_Texture *texture, const SDL_Rect *rect, const Uint8 *Yplane, int Ypitch, const Uint8 *Uplane, int Upitch, const Uint8 *Vplane, int Vpitch, Location location = Location::current())
 {
-    if (!SDL_UpdateYUVTexture(texture, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch))
+    if (!SDL_UpdateYUVTexture(texture, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void UpdateNVTexture(SDL_Texture *texture, const SDL_Rect *rect, const Uint8 *Yplane, int Ypitch, const Uint8 *UVplane, int UVpitch, std::source_location location = std::source_location::current())
+inline Result<void> UpdateNVTexture(SDL_Texture *texture, const SDL_Rect *rect, const Uint8 *Yplane, int Ypitch, const Uint8 *UVplane, int UVpitch, Location location = Location::current())
 {
-    if (!SDL_UpdateNVTexture(texture, rect, Yplane, Ypitch, UVplane, UVpitch))
+    if (!SDL_UpdateNVTexture(texture, rect, Yplane, Ypitch, UVplane, UVpitch)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void LockTexture(SDL_Texture *texture, const SDL_Rect *rect, void **pixels, int *pitch, std::source_location location = std::source_location::current())
+inline Result<void> LockTexture(SDL_Texture *texture, const SDL_Rect *rect, void **pixels, int *pitch, Location location = Location::current())
 {
-    if (!SDL_LockTexture(texture, rect, pixels, pitch))
+    if (!SDL_LockTexture(texture, rect, pixels, pitch)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void LockTextureToSurface(SDL_Texture *texture, const SDL_Rect *rect, SDL_Surface **surface, std::source_location location = std::source_location::current())
+inline Result<void> LockTextureToSurface(SDL_Texture *texture, const SDL_Rect *rect, SDL_Surface **surface, Location location = Location::current())
 {
-    if (!SDL_LockTextureToSurface(texture, rect, surface))
+    if (!SDL_LockTextureToSurface(texture, rect, surface)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void UnlockTexture(SDL_Texture *texture)
@@ -7987,352 +8575,385 @@ inline void UnlockTexture(SDL_Texture *texture)
     SDL_UnlockTexture(texture);
 }
 
-inline void SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture, std::source_location location = std::source_location::current())
+inline Result<void> SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture, Location location = Location::current())
 {
-    if (!SDL_SetRenderTarget(renderer, texture))
+    if (!SDL_SetRenderTarget(renderer, texture)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_Texture *GetRenderTarget(SDL_Renderer *renderer, std::source_location location = std::source_location::current())
+inline Result<SDL_Texture *> GetRenderTarget(SDL_Renderer *renderer, Location location = Location::current())
 {
     SDL_Texture *result = SDL_GetRenderTarget(renderer);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Texture *>(location);
     }
     return result;
 }
 
-inline void SetRenderLogicalPresentation(SDL_Renderer *renderer, int w, int h, SDL_RendererLogicalPresentation mode, std::source_location location = std::source_location::current())
+inline Result<void> SetRenderLogicalPresentation(SDL_Renderer *renderer, int w, int h, SDL_RendererLogicalPresentation mode, Location location = Location::current())
 {
-    if (!SDL_SetRenderLogicalPresentation(renderer, w, h, mode))
+    if (!SDL_SetRenderLogicalPresentation(renderer, w, h, mode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetRenderLogicalPresentation(SDL_Renderer *renderer, int *w, int *h, SDL_RendererLogicalPresentation *mode, std::source_location location = std::source_location::current())
+inline Result<void> GetRenderLogicalPresentation(SDL_Renderer *renderer, int *w, int *h, SDL_RendererLogicalPresentation *mode, Location location = Location::current())
 {
-    if (!SDL_GetRenderLogicalPresentation(renderer, w, h, mode))
+    if (!SDL_GetRenderLogicalPresentation(renderer, w, h, mode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetRenderLogicalPresentationRect(SDL_Renderer *renderer, SDL_FRect *rect, std::source_location location = std::source_location::current())
+inline Result<void> GetRenderLogicalPresentationRect(SDL_Renderer *renderer, SDL_FRect *rect, Location location = Location::current())
 {
-    if (!SDL_GetRenderLogicalPresentationRect(renderer, rect))
+    if (!SDL_GetRenderLogicalPresentationRect(renderer, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderCoordinatesFromWindow(SDL_Renderer *renderer, float window_x, float window_y, float *x, float *y, std::source_location location = std::source_location::current())
+inline Result<void> RenderCoordinatesFromWindow(SDL_Renderer *renderer, float window_x, float window_y, float *x, float *y, Location location = Location::current())
 {
-    if (!SDL_RenderCoordinatesFromWindow(renderer, window_x, window_y, x, y))
+    if (!SDL_RenderCoordinatesFromWindow(renderer, window_x, window_y, x, y)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderCoordinatesToWindow(SDL_Renderer *renderer, float x, float y, float *window_x, float *window_y, std::source_location location = std::source_location::current())
+inline Result<void> RenderCoordinatesToWindow(SDL_Renderer *renderer, float x, float y, float *window_x, float *window_y, Location location = Location::current())
 {
-    if (!SDL_RenderCoordinatesToWindow(renderer, x, y, window_x, window_y))
+    if (!SDL_RenderCoordinatesToWindow(renderer, x, y, window_x, window_y)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ConvertEventToRenderCoordinates(SDL_Renderer *renderer, SDL_Event *event, std::source_location location = std::source_location::current())
+inline Result<void> ConvertEventToRenderCoordinates(SDL_Renderer *renderer, SDL_Event *event, Location location = Location::current())
 {
-    if (!SDL_ConvertEventToRenderCoordinates(renderer, event))
+    if (!SDL_ConvertEventToRenderCoordinates(renderer, event)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetRenderViewport(SDL_Renderer *renderer, const SDL_Rect *rect, std::source_location location = std::source_location::current())
+inline Result<void> SetRenderViewport(SDL_Renderer *renderer, const SDL_Rect *rect, Location location = Location::current())
 {
-    if (!SDL_SetRenderViewport(renderer, rect))
+    if (!SDL_SetRenderViewport(renderer, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetRenderViewport(SDL_Renderer *renderer, SDL_Rect *rect, std::source_location location = std::source_location::current())
+inline Result<void> GetRenderViewport(SDL_Renderer *renderer, SDL_Rect *rect, Location location = Location::current())
 {
-    if (!SDL_GetRenderViewport(renderer, rect))
+    if (!SDL_GetRenderViewport(renderer, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderViewportSet(SDL_Renderer *renderer, std::source_location location = std::source_location::current())
+inline bool RenderViewportSet(SDL_Renderer *renderer)
 {
-    if (!SDL_RenderViewportSet(renderer))
-    {
-        SDLThrow(location);
-    }
+    return SDL_RenderViewportSet(renderer);
 }
 
-inline void GetRenderSafeArea(SDL_Renderer *renderer, SDL_Rect *rect, std::source_location location = std::source_location::current())
+inline Result<void> GetRenderSafeArea(SDL_Renderer *renderer, SDL_Rect *rect, Location location = Location::current())
 {
-    if (!SDL_GetRenderSafeArea(renderer, rect))
+    if (!SDL_GetRenderSafeArea(renderer, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetRenderClipRect(SDL_Renderer *renderer, const SDL_Rect *rect, std::source_location location = std::source_location::current())
+inline Result<void> SetRenderClipRect(SDL_Renderer *renderer, const SDL_Rect *rect, Location location = Location::current())
 {
-    if (!SDL_SetRenderClipRect(renderer, rect))
+    if (!SDL_SetRenderClipRect(renderer, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetRenderClipRect(SDL_Renderer *renderer, SDL_Rect *rect, std::source_location location = std::source_location::current())
+inline Result<void> GetRenderClipRect(SDL_Renderer *renderer, SDL_Rect *rect, Location location = Location::current())
 {
-    if (!SDL_GetRenderClipRect(renderer, rect))
+    if (!SDL_GetRenderClipRect(renderer, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderClipEnabled(SDL_Renderer *renderer, std::source_location location = std::source_location::current())
+inline bool RenderClipEnabled(SDL_Renderer *renderer)
 {
-    if (!SDL_RenderClipEnabled(renderer))
-    {
-        SDLThrow(location);
-    }
+    return SDL_RenderClipEnabled(renderer);
 }
 
-inline void SetRenderScale(SDL_Renderer *renderer, float scaleX, float scaleY, std::source_location location = std::source_location::current())
+inline Result<void> SetRenderScale(SDL_Renderer *renderer, float scaleX, float scaleY, Location location = Location::current())
 {
-    if (!SDL_SetRenderScale(renderer, scaleX, scaleY))
+    if (!SDL_SetRenderScale(renderer, scaleX, scaleY)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetRenderScale(SDL_Renderer *renderer, float *scaleX, float *scaleY, std::source_location location = std::source_location::current())
+inline Result<void> GetRenderScale(SDL_Renderer *renderer, float *scaleX, float *scaleY, Location location = Location::current())
 {
-    if (!SDL_GetRenderScale(renderer, scaleX, scaleY))
+    if (!SDL_GetRenderScale(renderer, scaleX, scaleY)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetRenderDrawColor(SDL_Renderer *renderer, Uint8 r, Uint8 g, Uint8 b, Uint8 a, std::source_location location = std::source_location::current())
+inline Result<void> SetRenderDrawColor(SDL_Renderer *renderer, Uint8 r, Uint8 g, Uint8 b, Uint8 a, Location location = Location::current())
 {
-    if (!SDL_SetRenderDrawColor(renderer, r, g, b, a))
+    if (!SDL_SetRenderDrawColor(renderer, r, g, b, a)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetRenderDrawColorFloat(SDL_Renderer *renderer, float r, float g, float b, float a, std::source_location location = std::source_location::current())
+inline Result<void> SetRenderDrawColorFloat(SDL_Renderer *renderer, float r, float g, float b, float a, Location location = Location::current())
 {
-    if (!SDL_SetRenderDrawColorFloat(renderer, r, g, b, a))
+    if (!SDL_SetRenderDrawColorFloat(renderer, r, g, b, a)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetRenderDrawColor(SDL_Renderer *renderer, Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a, std::source_location location = std::source_location::current())
+inline Result<void> GetRenderDrawColor(SDL_Renderer *renderer, Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a, Location location = Location::current())
 {
-    if (!SDL_GetRenderDrawColor(renderer, r, g, b, a))
+    if (!SDL_GetRenderDrawColor(renderer, r, g, b, a)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetRenderDrawColorFloat(SDL_Renderer *renderer, float *r, float *g, float *b, float *a, std::source_location location = std::source_location::current())
+inline Result<void> GetRenderDrawColorFloat(SDL_Renderer *renderer, float *r, float *g, float *b, float *a, Location location = Location::current())
 {
-    if (!SDL_GetRenderDrawColorFloat(renderer, r, g, b, a))
+    if (!SDL_GetRenderDrawColorFloat(renderer, r, g, b, a)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetRenderColorScale(SDL_Renderer *renderer, float scale, std::source_location location = std::source_location::current())
+inline Result<void> SetRenderColorScale(SDL_Renderer *renderer, float scale, Location location = Location::current())
 {
-    if (!SDL_SetRenderColorScale(renderer, scale))
+    if (!SDL_SetRenderColorScale(renderer, scale)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetRenderColorScale(SDL_Renderer *renderer, float *scale, std::source_location location = std::source_location::current())
+inline Result<void> GetRenderColorScale(SDL_Renderer *renderer, float *scale, Location location = Location::current())
 {
-    if (!SDL_GetRenderColorScale(renderer, scale))
+    if (!SDL_GetRenderColorScale(renderer, scale)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetRenderDrawBlendMode(SDL_Renderer *renderer, SDL_BlendMode blendMode, std::source_location location = std::source_location::current())
+inline Result<void> SetRenderDrawBlendMode(SDL_Renderer *renderer, SDL_BlendMode blendMode, Location location = Location::current())
 {
-    if (!SDL_SetRenderDrawBlendMode(renderer, blendMode))
+    if (!SDL_SetRenderDrawBlendMode(renderer, blendMode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetRenderDrawBlendMode(SDL_Renderer *renderer, SDL_BlendMode *blendMode, std::source_location location = std::source_location::current())
+inline Result<void> GetRenderDrawBlendMode(SDL_Renderer *renderer, SDL_BlendMode *blendMode, Location location = Location::current())
 {
-    if (!SDL_GetRenderDrawBlendMode(renderer, blendMode))
+    if (!SDL_GetRenderDrawBlendMode(renderer, blendMode)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderClear(SDL_Renderer *renderer, std::source_location location = std::source_location::current())
+inline Result<void> RenderClear(SDL_Renderer *renderer, Location location = Location::current())
 {
-    if (!SDL_RenderClear(renderer))
+    if (!SDL_RenderClear(renderer)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderPoint(SDL_Renderer *renderer, float x, float y, std::source_location location = std::source_location::current())
+inline Result<void> RenderPoint(SDL_Renderer *renderer, float x, float y, Location location = Location::current())
 {
-    if (!SDL_RenderPoint(renderer, x, y))
+    if (!SDL_RenderPoint(renderer, x, y)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderPoints(SDL_Renderer *renderer, const SDL_FPoint *points, int count, std::source_location location = std::source_location::current())
+inline Result<void> RenderPoints(SDL_Renderer *renderer, const SDL_FPoint *points, int count, Location location = Location::current())
 {
-    if (!SDL_RenderPoints(renderer, points, count))
+    if (!SDL_RenderPoints(renderer, points, count)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderLine(SDL_Renderer *renderer, float x1, float y1, float x2, float y2, std::source_location location = std::source_location::current())
+inline Result<void> RenderLine(SDL_Renderer *renderer, float x1, float y1, float x2, float y2, Location location = Location::current())
 {
-    if (!SDL_RenderLine(renderer, x1, y1, x2, y2))
+    if (!SDL_RenderLine(renderer, x1, y1, x2, y2)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderLines(SDL_Renderer *renderer, const SDL_FPoint *points, int count, std::source_location location = std::source_location::current())
+inline Result<void> RenderLines(SDL_Renderer *renderer, const SDL_FPoint *points, int count, Location location = Location::current())
 {
-    if (!SDL_RenderLines(renderer, points, count))
+    if (!SDL_RenderLines(renderer, points, count)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderRect(SDL_Renderer *renderer, const SDL_FRect *rect, std::source_location location = std::source_location::current())
+inline Result<void> RenderRect(SDL_Renderer *renderer, const SDL_FRect *rect, Location location = Location::current())
 {
-    if (!SDL_RenderRect(renderer, rect))
+    if (!SDL_RenderRect(renderer, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderRects(SDL_Renderer *renderer, const SDL_FRect *rects, int count, std::source_location location = std::source_location::current())
+inline Result<void> RenderRects(SDL_Renderer *renderer, const SDL_FRect *rects, int count, Location location = Location::current())
 {
-    if (!SDL_RenderRects(renderer, rects, count))
+    if (!SDL_RenderRects(renderer, rects, count)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderFillRect(SDL_Renderer *renderer, const SDL_FRect *rect, std::source_location location = std::source_location::current())
+inline Result<void> RenderFillRect(SDL_Renderer *renderer, const SDL_FRect *rect, Location location = Location::current())
 {
-    if (!SDL_RenderFillRect(renderer, rect))
+    if (!SDL_RenderFillRect(renderer, rect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, int count, std::source_location location = std::source_location::current())
+inline Result<void> RenderFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, int count, Location location = Location::current())
 {
-    if (!SDL_RenderFillRects(renderer, rects, count))
+    if (!SDL_RenderFillRects(renderer, rects, count)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderTexture(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect *srcrect, const SDL_FRect *dstrect, std::source_location location = std::source_location::current())
+inline Result<void> RenderTexture(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect *srcrect, const SDL_FRect *dstrect, Location location = Location::current())
 {
-    if (!SDL_RenderTexture(renderer, texture, srcrect, dstrect))
+    if (!SDL_RenderTexture(renderer, texture, srcrect, dstrect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderTextureRotated(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect *srcrect, const SDL_FRect *dstrect, double angle, const SDL_FPoint *center, SDL_FlipMode flip, std::source_location location = std::source_location::current())
+inline Result<void> RenderTextureRotated(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect *srcrect, const SDL_FRect *dstrect, double angle, const SDL_FPoint *center, SDL_FlipMode flip, Location location = Location::current())
 {
-    if (!SDL_RenderTextureRotated(renderer, texture, srcrect, dstrect, angle, center, flip))
+    if (!SDL_RenderTextureRotated(renderer, texture, srcrect, dstrect, angle, center, flip)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderTextureAffine(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect *srcrect, const SDL_FPoint *origin, const SDL_FPoint *right, const SDL_FPoint *down, std::source_location location = std::source_location::current())
+inline Result<void> RenderTextureAffine(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect *srcrect, const SDL_FPoint *origin, const SDL_FPoint *right, const SDL_FPoint *down, Location location = Location::current())
 {
-    if (!SDL_RenderTextureAffine(renderer, texture, srcrect, origin, right, down))
+    if (!SDL_RenderTextureAffine(renderer, texture, srcrect, origin, right, down)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderTextureTiled(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect *srcrect, float scale, const SDL_FRect *dstrect, std::source_location location = std::source_location::current())
+inline Result<void> RenderTextureTiled(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect *srcrect, float scale, const SDL_FRect *dstrect, Location location = Location::current())
 {
-    if (!SDL_RenderTextureTiled(renderer, texture, srcrect, scale, dstrect))
+    if (!SDL_RenderTextureTiled(renderer, texture, srcrect, scale, dstrect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderTexture9Grid(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect *srcrect, float left_width, float right_width, float top_height, float bottom_height, float scale, const SDL_FRect *dstrect, std::source_location location = std::source_location::current())
+inline Result<void> RenderTexture9Grid(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect *srcrect, float left_width, float right_width, float top_height, float bottom_height, float scale, const SDL_FRect *dstrect, Location location = Location::current())
 {
-    if (!SDL_RenderTexture9Grid(renderer, texture, srcrect, left_width, right_width, top_height, bottom_height, scale, dstrect))
+    if (!SDL_RenderTexture9Grid(renderer, texture, srcrect, left_width, right_width, top_height, bottom_height, scale, dstrect)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderGeometry(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Vertex *vertices, int num_vertices, const int *indices, int num_indices, std::source_location location = std::source_location::current())
+inline Result<void> RenderGeometry(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_Vertex *vertices, int num_vertices, const int *indices, int num_indices, Location location = Location::current())
 {
-    if (!SDL_RenderGeometry(renderer, texture, vertices, num_vertices, indices, num_indices))
+    if (!SDL_RenderGeometry(renderer, texture, vertices, num_vertices, indices, num_indices)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderGeometryRaw(SDL_Renderer *renderer, SDL_Texture *texture, const float *xy, int xy_stride, const SDL_FColor *color, int color_stride, const float *uv, int uv_stride, int num_vertices, const void *indices, int num_indices, int size_indices, std::source_location location = std::source_location::current())
+inline Result<void> RenderGeometryRaw(SDL_Renderer *renderer, SDL_Texture *texture, const float *xy, int xy_stride, const SDL_FColor *color, int color_stride, const float *uv, int uv_stride, int num_vertices, const void *indices, int num_indices, int size_indices, Location location = Location::current())
 {
-    if (!SDL_RenderGeometryRaw(renderer, texture, xy, xy_stride, color, color_stride, uv, uv_stride, num_vertices, indices, num_indices, size_indices))
+    if (!SDL_RenderGeometryRaw(renderer, texture, xy, xy_stride, color, color_stride, uv, uv_stride, num_vertices, indices, num_indices, size_indices)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_Surface *RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect, std::source_location location = std::source_location::current())
+inline Result<SDL_Surface *> RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect, Location location = Location::current())
 {
     SDL_Surface *result = SDL_RenderReadPixels(renderer, rect);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Surface *>(location);
     }
     return result;
 }
 
-inline void RenderPresent(SDL_Renderer *renderer, std::source_location location = std::source_location::current())
+inline Result<void> RenderPresent(SDL_Renderer *renderer, Location location = Location::current())
 {
-    if (!SDL_RenderPresent(renderer))
+    if (!SDL_RenderPresent(renderer)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void DestroyTexture(SDL_Texture *texture)
@@ -8345,192 +8966,204 @@ inline void DestroyRenderer(SDL_Renderer *renderer)
     SDL_DestroyRenderer(renderer);
 }
 
-inline void FlushRenderer(SDL_Renderer *renderer, std::source_location location = std::source_location::current())
+inline Result<void> FlushRenderer(SDL_Renderer *renderer, Location location = Location::current())
 {
-    if (!SDL_FlushRenderer(renderer))
+    if (!SDL_FlushRenderer(renderer)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void *GetRenderMetalLayer(SDL_Renderer *renderer, std::source_location location = std::source_location::current())
+inline Result<void *> GetRenderMetalLayer(SDL_Renderer *renderer, Location location = Location::current())
 {
     void *result = SDL_GetRenderMetalLayer(renderer);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline void *GetRenderMetalCommandEncoder(SDL_Renderer *renderer, std::source_location location = std::source_location::current())
+inline Result<void *> GetRenderMetalCommandEncoder(SDL_Renderer *renderer, Location location = Location::current())
 {
     void *result = SDL_GetRenderMetalCommandEncoder(renderer);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void *>(location);
     }
     return result;
 }
 
-inline void AddVulkanRenderSemaphores(SDL_Renderer *renderer, Uint32 wait_stage_mask, Sint64 wait_semaphore, Sint64 signal_semaphore, std::source_location location = std::source_location::current())
+inline Result<void> AddVulkanRenderSemaphores(SDL_Renderer *renderer, Uint32 wait_stage_mask, Sint64 wait_semaphore, Sint64 signal_semaphore, Location location = Location::current())
 {
-    if (!SDL_AddVulkanRenderSemaphores(renderer, wait_stage_mask, wait_semaphore, signal_semaphore))
+    if (!SDL_AddVulkanRenderSemaphores(renderer, wait_stage_mask, wait_semaphore, signal_semaphore)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void SetRenderVSync(SDL_Renderer *renderer, int vsync, std::source_location location = std::source_location::current())
+inline Result<void> SetRenderVSync(SDL_Renderer *renderer, int vsync, Location location = Location::current())
 {
-    if (!SDL_SetRenderVSync(renderer, vsync))
+    if (!SDL_SetRenderVSync(renderer, vsync)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetRenderVSync(SDL_Renderer *renderer, int *vsync, std::source_location location = std::source_location::current())
+inline Result<void> GetRenderVSync(SDL_Renderer *renderer, int *vsync, Location location = Location::current())
 {
-    if (!SDL_GetRenderVSync(renderer, vsync))
+    if (!SDL_GetRenderVSync(renderer, vsync)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenderDebugText(SDL_Renderer *renderer, float x, float y, const char *str, std::source_location location = std::source_location::current())
+inline Result<void> RenderDebugText(SDL_Renderer *renderer, float x, float y, const char *str, Location location = Location::current())
 {
-    if (!SDL_RenderDebugText(renderer, x, y, str))
+    if (!SDL_RenderDebugText(renderer, x, y, str)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_Storage *OpenTitleStorage(const char *override, SDL_PropertiesID props, std::source_location location = std::source_location::current())
+inline Result<SDL_Storage *> OpenTitleStorage(const char *override, SDL_PropertiesID props, Location location = Location::current())
 {
     SDL_Storage *result = SDL_OpenTitleStorage(override, props);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Storage *>(location);
     }
     return result;
 }
 
-inline SDL_Storage *OpenUserStorage(const char *org, const char *app, SDL_PropertiesID props, std::source_location location = std::source_location::current())
+inline Result<SDL_Storage *> OpenUserStorage(const char *org, const char *app, SDL_PropertiesID props, Location location = Location::current())
 {
     SDL_Storage *result = SDL_OpenUserStorage(org, app, props);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Storage *>(location);
     }
     return result;
 }
 
-inline SDL_Storage *OpenFileStorage(const char *path, std::source_location location = std::source_location::current())
+inline Result<SDL_Storage *> OpenFileStorage(const char *path, Location location = Location::current())
 {
     SDL_Storage *result = SDL_OpenFileStorage(path);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Storage *>(location);
     }
     return result;
 }
 
-inline SDL_Storage *OpenStorage(const SDL_StorageInterface *iface, void *userdata, std::source_location location = std::source_location::current())
+inline Result<SDL_Storage *> OpenStorage(const SDL_StorageInterface *iface, void *userdata, Location location = Location::current())
 {
     SDL_Storage *result = SDL_OpenStorage(iface, userdata);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Storage *>(location);
     }
     return result;
 }
 
-inline void CloseStorage(SDL_Storage *storage, std::source_location location = std::source_location::current())
+inline Result<void> CloseStorage(SDL_Storage *storage, Location location = Location::current())
 {
-    if (!SDL_CloseStorage(storage))
+    if (!SDL_CloseStorage(storage)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void StorageReady(SDL_Storage *storage, std::source_location location = std::source_location::current())
+inline bool StorageReady(SDL_Storage *storage)
 {
-    if (!SDL_StorageReady(storage))
-    {
-        SDLThrow(location);
-    }
+    return SDL_StorageReady(storage);
 }
 
-inline void GetStorageFileSize(SDL_Storage *storage, const char *path, Uint64 *length, std::source_location location = std::source_location::current())
+inline Result<void> GetStorageFileSize(SDL_Storage *storage, const char *path, Uint64 *length, Location location = Location::current())
 {
-    if (!SDL_GetStorageFileSize(storage, path, length))
+    if (!SDL_GetStorageFileSize(storage, path, length)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void ReadStorageFile(SDL_Storage *storage, const char *path, void *destination, Uint64 length, std::source_location location = std::source_location::current())
+inline Result<void> ReadStorageFile(SDL_Storage *storage, const char *path, void *destination, Uint64 length, Location location = Location::current())
 {
-    if (!SDL_ReadStorageFile(storage, path, destination, length))
+    if (!SDL_ReadStorageFile(storage, path, destination, length)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void WriteStorageFile(SDL_Storage *storage, const char *path, const void *source, Uint64 length, std::source_location location = std::source_location::current())
+inline Result<void> WriteStorageFile(SDL_Storage *storage, const char *path, const void *source, Uint64 length, Location location = Location::current())
 {
-    if (!SDL_WriteStorageFile(storage, path, source, length))
+    if (!SDL_WriteStorageFile(storage, path, source, length)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void CreateStorageDirectory(SDL_Storage *storage, const char *path, std::source_location location = std::source_location::current())
+inline Result<void> CreateStorageDirectory(SDL_Storage *storage, const char *path, Location location = Location::current())
 {
-    if (!SDL_CreateStorageDirectory(storage, path))
+    if (!SDL_CreateStorageDirectory(storage, path)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void EnumerateStorageDirectory(SDL_Storage *storage, const char *path, SDL_EnumerateDirectoryCallback callback, void *userdata, std::source_location location = std::source_location::current())
+inline Result<void> EnumerateStorageDirectory(SDL_Storage *storage, const char *path, SDL_EnumerateDirectoryCallback callback, void *userdata, Location location = Location::current())
 {
-    if (!SDL_EnumerateStorageDirectory(storage, path, callback, userdata))
+    if (!SDL_EnumerateStorageDirectory(storage, path, callback, userdata)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RemoveStoragePath(SDL_Storage *storage, const char *path, std::source_location location = std::source_location::current())
+inline Result<void> RemoveStoragePath(SDL_Storage *storage, const char *path, Location location = Location::current())
 {
-    if (!SDL_RemoveStoragePath(storage, path))
+    if (!SDL_RemoveStoragePath(storage, path)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void RenameStoragePath(SDL_Storage *storage, const char *oldpath, const char *newpath, std::source_location location = std::source_location::current())
+inline Result<void> RenameStoragePath(SDL_Storage *storage, const char *oldpath, const char *newpath, Location location = Location::current())
 {
-    if (!SDL_RenameStoragePath(storage, oldpath, newpath))
+    if (!SDL_RenameStoragePath(storage, oldpath, newpath)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void CopyStorageFile(SDL_Storage *storage, const char *oldpath, const char *newpath, std::source_location location = std::source_location::current())
+inline Result<void> CopyStorageFile(SDL_Storage *storage, const char *oldpath, const char *newpath, Location location = Location::current())
 {
-    if (!SDL_CopyStorageFile(storage, oldpath, newpath))
+    if (!SDL_CopyStorageFile(storage, oldpath, newpath)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetStoragePathInfo(SDL_Storage *storage, const char *path, SDL_PathInfo *info, std::source_location location = std::source_location::current())
+inline Result<void> GetStoragePathInfo(SDL_Storage *storage, const char *path, SDL_PathInfo *info, Location location = Location::current())
 {
-    if (!SDL_GetStoragePathInfo(storage, path, info))
+    if (!SDL_GetStoragePathInfo(storage, path, info)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline Uint64 GetStorageSpaceRemaining(SDL_Storage *storage)
@@ -8538,12 +9171,12 @@ inline Uint64 GetStorageSpaceRemaining(SDL_Storage *storage)
     return SDL_GetStorageSpaceRemaining(storage);
 }
 
-inline char **GlobStorageDirectory(SDL_Storage *storage, const char *path, const char *pattern, SDL_GlobFlags flags, int *count, std::source_location location = std::source_location::current())
+inline Result<char **> GlobStorageDirectory(SDL_Storage *storage, const char *path, const char *pattern, SDL_GlobFlags flags, int *count, Location location = Location::current())
 {
     char **result = SDL_GlobStorageDirectory(storage, path, pattern, flags, count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<char **>(location);
     }
     return result;
 }
@@ -8558,12 +9191,13 @@ inline int GetDirect3D9AdapterIndex(SDL_DisplayID displayID)
     return SDL_GetDirect3D9AdapterIndex(displayID);
 }
 
-inline void GetDXGIOutputInfo(SDL_DisplayID displayID, int *adapterIndex, int *outputIndex, std::source_location location = std::source_location::current())
+inline Result<void> GetDXGIOutputInfo(SDL_DisplayID displayID, int *adapterIndex, int *outputIndex, Location location = Location::current())
 {
-    if (!SDL_GetDXGIOutputInfo(displayID, adapterIndex, outputIndex))
+    if (!SDL_GetDXGIOutputInfo(displayID, adapterIndex, outputIndex)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void SetX11EventHook(SDL_X11EventHook callback, void *userdata)
@@ -8571,20 +9205,14 @@ inline void SetX11EventHook(SDL_X11EventHook callback, void *userdata)
     SDL_SetX11EventHook(callback, userdata);
 }
 
-inline void IsTablet(std::source_location location = std::source_location::current())
+inline bool IsTablet()
 {
-    if (!SDL_IsTablet())
-    {
-        SDLThrow(location);
-    }
+    return SDL_IsTablet();
 }
 
-inline void IsTV(std::source_location location = std::source_location::current())
+inline bool IsTV()
 {
-    if (!SDL_IsTV())
-    {
-        SDLThrow(location);
-    }
+    return SDL_IsTV();
 }
 
 inline SDL_Sandbox GetSandbox()
@@ -8622,36 +9250,40 @@ inline void OnApplicationDidEnterForeground()
     SDL_OnApplicationDidEnterForeground();
 }
 
-inline void GetDateTimeLocalePreferences(SDL_DateFormat *dateFormat, SDL_TimeFormat *timeFormat, std::source_location location = std::source_location::current())
+inline Result<void> GetDateTimeLocalePreferences(SDL_DateFormat *dateFormat, SDL_TimeFormat *timeFormat, Location location = Location::current())
 {
-    if (!SDL_GetDateTimeLocalePreferences(dateFormat, timeFormat))
+    if (!SDL_GetDateTimeLocalePreferences(dateFormat, timeFormat)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void GetCurrentTime(SDL_Time *ticks, std::source_location location = std::source_location::current())
+inline Result<void> GetCurrentTime(SDL_Time *ticks, Location location = Location::current())
 {
-    if (!SDL_GetCurrentTime(ticks))
+    if (!SDL_GetCurrentTime(ticks)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void TimeToDateTime(SDL_Time ticks, SDL_DateTime *dt, bool localTime, std::source_location location = std::source_location::current())
+inline Result<void> TimeToDateTime(SDL_Time ticks, SDL_DateTime *dt, bool localTime, Location location = Location::current())
 {
-    if (!SDL_TimeToDateTime(ticks, dt, localTime))
+    if (!SDL_TimeToDateTime(ticks, dt, localTime)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline void DateTimeToTime(const SDL_DateTime *dt, SDL_Time *ticks, std::source_location location = std::source_location::current())
+inline Result<void> DateTimeToTime(const SDL_DateTime *dt, SDL_Time *ticks, Location location = Location::current())
 {
-    if (!SDL_DateTimeToTime(dt, ticks))
+    if (!SDL_DateTimeToTime(dt, ticks)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
 inline void TimeToWindows(SDL_Time ticks, Uint32 *dwLowDateTime, Uint32 *dwHighDateTime)
@@ -8724,20 +9356,21 @@ inline SDL_TimerID AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, voi
     return SDL_AddTimerNS(interval, callback, userdata);
 }
 
-inline void RemoveTimer(SDL_TimerID id, std::source_location location = std::source_location::current())
+inline Result<void> RemoveTimer(SDL_TimerID id, Location location = Location::current())
 {
-    if (!SDL_RemoveTimer(id))
+    if (!SDL_RemoveTimer(id)) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<void>(location);
     }
+    return Success();
 }
 
-inline SDL_Tray *CreateTray(SDL_Surface *icon, const char *tooltip, std::source_location location = std::source_location::current())
+inline Result<SDL_Tray *> CreateTray(SDL_Surface *icon, const char *tooltip, Location location = Location::current())
 {
     SDL_Tray *result = SDL_CreateTray(icon, tooltip);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Tray *>(location);
     }
     return result;
 }
@@ -8752,52 +9385,52 @@ inline void SetTrayTooltip(SDL_Tray *tray, const char *tooltip)
     SDL_SetTrayTooltip(tray, tooltip);
 }
 
-inline SDL_TrayMenu *CreateTrayMenu(SDL_Tray *tray, std::source_location location = std::source_location::current())
+inline Result<SDL_TrayMenu *> CreateTrayMenu(SDL_Tray *tray, Location location = Location::current())
 {
     SDL_TrayMenu *result = SDL_CreateTrayMenu(tray);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_TrayMenu *>(location);
     }
     return result;
 }
 
-inline SDL_TrayMenu *CreateTraySubmenu(SDL_TrayEntry *entry, std::source_location location = std::source_location::current())
+inline Result<SDL_TrayMenu *> CreateTraySubmenu(SDL_TrayEntry *entry, Location location = Location::current())
 {
     SDL_TrayMenu *result = SDL_CreateTraySubmenu(entry);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_TrayMenu *>(location);
     }
     return result;
 }
 
-inline SDL_TrayMenu *GetTrayMenu(SDL_Tray *tray, std::source_location location = std::source_location::current())
+inline Result<SDL_TrayMenu *> GetTrayMenu(SDL_Tray *tray, Location location = Location::current())
 {
     SDL_TrayMenu *result = SDL_GetTrayMenu(tray);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_TrayMenu *>(location);
     }
     return result;
 }
 
-inline SDL_TrayMenu *GetTraySubmenu(SDL_TrayEntry *entry, std::source_location location = std::source_location::current())
+inline Result<SDL_TrayMenu *> GetTraySubmenu(SDL_TrayEntry *entry, Location location = Location::current())
 {
     SDL_TrayMenu *result = SDL_GetTraySubmenu(entry);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_TrayMenu *>(location);
     }
     return result;
 }
 
-inline const SDL_TrayEntry **GetTrayEntries(SDL_TrayMenu *menu, int *count, std::source_location location = std::source_location::current())
+inline Result<const SDL_TrayEntry **> GetTrayEntries(SDL_TrayMenu *menu, int *count, Location location = Location::current())
 {
     const SDL_TrayEntry **result = SDL_GetTrayEntries(menu, count);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const SDL_TrayEntry **>(location);
     }
     return result;
 }
@@ -8807,12 +9440,12 @@ inline void RemoveTrayEntry(SDL_TrayEntry *entry)
     SDL_RemoveTrayEntry(entry);
 }
 
-inline SDL_TrayEntry *InsertTrayEntryAt(SDL_TrayMenu *menu, int pos, const char *label, SDL_TrayEntryFlags flags, std::source_location location = std::source_location::current())
+inline Result<SDL_TrayEntry *> InsertTrayEntryAt(SDL_TrayMenu *menu, int pos, const char *label, SDL_TrayEntryFlags flags, Location location = Location::current())
 {
     SDL_TrayEntry *result = SDL_InsertTrayEntryAt(menu, pos, label, flags);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_TrayEntry *>(location);
     }
     return result;
 }
@@ -8822,12 +9455,12 @@ inline void SetTrayEntryLabel(SDL_TrayEntry *entry, const char *label)
     SDL_SetTrayEntryLabel(entry, label);
 }
 
-inline const char *GetTrayEntryLabel(SDL_TrayEntry *entry, std::source_location location = std::source_location::current())
+inline Result<const char *> GetTrayEntryLabel(SDL_TrayEntry *entry, Location location = Location::current())
 {
     const char *result = SDL_GetTrayEntryLabel(entry);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
@@ -8837,12 +9470,9 @@ inline void SetTrayEntryChecked(SDL_TrayEntry *entry, bool checked)
     SDL_SetTrayEntryChecked(entry, checked);
 }
 
-inline void GetTrayEntryChecked(SDL_TrayEntry *entry, std::source_location location = std::source_location::current())
+inline bool GetTrayEntryChecked(SDL_TrayEntry *entry)
 {
-    if (!SDL_GetTrayEntryChecked(entry))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetTrayEntryChecked(entry);
 }
 
 inline void SetTrayEntryEnabled(SDL_TrayEntry *entry, bool enabled)
@@ -8850,12 +9480,9 @@ inline void SetTrayEntryEnabled(SDL_TrayEntry *entry, bool enabled)
     SDL_SetTrayEntryEnabled(entry, enabled);
 }
 
-inline void GetTrayEntryEnabled(SDL_TrayEntry *entry, std::source_location location = std::source_location::current())
+inline bool GetTrayEntryEnabled(SDL_TrayEntry *entry)
 {
-    if (!SDL_GetTrayEntryEnabled(entry))
-    {
-        SDLThrow(location);
-    }
+    return SDL_GetTrayEntryEnabled(entry);
 }
 
 inline void SetTrayEntryCallback(SDL_TrayEntry *entry, SDL_TrayCallback callback, void *userdata)
@@ -8873,32 +9500,32 @@ inline void DestroyTray(SDL_Tray *tray)
     SDL_DestroyTray(tray);
 }
 
-inline SDL_TrayMenu *GetTrayEntryParent(SDL_TrayEntry *entry, std::source_location location = std::source_location::current())
+inline Result<SDL_TrayMenu *> GetTrayEntryParent(SDL_TrayEntry *entry, Location location = Location::current())
 {
     SDL_TrayMenu *result = SDL_GetTrayEntryParent(entry);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_TrayMenu *>(location);
     }
     return result;
 }
 
-inline SDL_TrayEntry *GetTrayMenuParentEntry(SDL_TrayMenu *menu, std::source_location location = std::source_location::current())
+inline Result<SDL_TrayEntry *> GetTrayMenuParentEntry(SDL_TrayMenu *menu, Location location = Location::current())
 {
     SDL_TrayEntry *result = SDL_GetTrayMenuParentEntry(menu);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_TrayEntry *>(location);
     }
     return result;
 }
 
-inline SDL_Tray *GetTrayMenuParentTray(SDL_TrayMenu *menu, std::source_location location = std::source_location::current())
+inline Result<SDL_Tray *> GetTrayMenuParentTray(SDL_TrayMenu *menu, Location location = Location::current())
 {
     SDL_Tray *result = SDL_GetTrayMenuParentTray(menu);
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<SDL_Tray *>(location);
     }
     return result;
 }
@@ -8913,14 +9540,3818 @@ inline int GetVersion()
     return SDL_GetVersion();
 }
 
-inline const char *GetRevision(std::source_location location = std::source_location::current())
+inline Result<const char *> GetRevision(Location location = Location::current())
 {
     const char *result = SDL_GetRevision();
-    if (!result)
+    if (!result) [[unlikely]]
     {
-        SDLThrow(location);
+        return Fail<const char *>(location);
     }
     return result;
 }
 
+// Reports a failed SDL call in a constructor, which has no Result to return it in. Throws,
+// aborts or calls the error callback as the policy says; SDL_HPP_ERROR_EXPECTED logs it.
+SDL_HPP_COLD inline void FailConstruction(Location location)
+{
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_EXPECTED
+    SDL_Log("SDL error: %s", Error{location}.Message());
+#else
+    (void)Fail<void>(location);
+#endif
+}
+
+// Creates the mutex guarding an object, for its constructor. SDL ignores a null mutex,
+// so after a reported failure the object still works from a single thread.
+inline Mutex CreateGuardMutex(Location location)
+{
+    Mutex mutex{SDL_CreateMutex()};
+    if (!mutex) [[unlikely]]
+    {
+        FailConstruction(location);
+    }
+    return mutex;
+}
+
+// Locks the mutex until the returned guard goes out of scope.
+[[nodiscard]] inline LockedMutex ScopedLock(const Mutex &mutex)
+{
+    SDL_LockMutex(mutex.get());
+    return LockedMutex{mutex.get()};
+}
+
+// Items the GPU may still be using, in frames tagged with the fence of the command buffer that
+// used them. Track() starts a frame and Collect() hands back the items of every frame whose
+// fence has signaled. Used by the fenced queues below.
+template <class T> struct GPUFenceTracker
+{
+    explicit GPUFenceTracker(SDL_GPUDevice *device) : m_device{device} {};
+    GPUFenceTracker(const GPUFenceTracker &) = delete;
+
+    GPUFenceTracker &operator=(const GPUFenceTracker &) = delete;
+
+    // Submits the command buffer, and tracks items until the GPU has finished it.
+    Result<void> Submit(SDL_GPUCommandBuffer *commandBuffer, std::vector<T> &items,
+                        Location location = Location::current())
+    {
+        SDL_GPUFence *fence = SDL_SubmitGPUCommandBufferAndAcquireFence(commandBuffer);
+        if (!fence) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        Track(fence, items);
+        return Success();
+    }
+
+    // Tracks items until the fence signals, taking ownership of the fence. Leaves items empty,
+    // reusing the storage of a collected frame.
+    void Track(SDL_GPUFence *fence, std::vector<T> &items)
+    {
+        m_frames.push_back({fence, std::move(items)});
+        items = std::move(m_spare);
+        items.clear();
+    }
+
+    // Calls complete(items) for every frame the GPU has finished, and releases its fence.
+    // Never waits.
+    template <class Function> void Collect(const Function &complete)
+    {
+        size_t remaining = 0;
+        for (size_t i = 0; i < m_frames.size(); ++i)
+        {
+            if (SDL_QueryGPUFence(m_device, m_frames[i].fence))
+            {
+                Retire(m_frames[i], complete);
+            }
+            else
+            {
+                if (remaining != i)
+                {
+                    m_frames[remaining] = std::move(m_frames[i]);
+                }
+                ++remaining;
+            }
+        }
+        m_frames.resize(remaining);
+    }
+
+    // Calls complete(items) for every frame, finished or not, and releases its fence.
+    template <class Function> void ReleaseAll(const Function &complete)
+    {
+        for (Frame &frame : m_frames)
+        {
+            Retire(frame, complete);
+        }
+        m_frames.clear();
+    }
+
+    size_t Size() const
+    {
+        return m_frames.size();
+    }
+
+  private:
+    struct Frame
+    {
+        SDL_GPUFence *fence;
+        std::vector<T> items;
+    };
+
+    template <class Function> void Retire(Frame &frame, const Function &complete)
+    {
+        SDL_ReleaseGPUFence(m_device, frame.fence);
+        frame.fence = nullptr;
+        complete(frame.items);
+        frame.items.clear();
+        if (m_spare.capacity() < frame.items.capacity())
+        {
+            m_spare = std::move(frame.items);
+        }
+    }
+
+    SDL_GPUDevice *m_device;
+    std::vector<Frame> m_frames;
+    std::vector<T> m_spare;
+};
+
+// Defers releasing GPU resources until the GPU is done with them, without waiting for it.
+// Released objects are collected for the frame being recorded. Submitting that frame's
+// command buffer via Submit() tags them with its fence, and Collect() releases the objects
+// of every frame whose fence has signaled.
+struct GPUReleaseQueue
+{
+    explicit GPUReleaseQueue(SDL_GPUDevice *device) : m_device{device}, m_frames{device} {};
+    GPUReleaseQueue(const GPUReleaseQueue &) = delete;
+
+    GPUReleaseQueue &operator=(const GPUReleaseQueue &) = delete;
+
+    // Waits for the GPU to be idle, then releases everything still queued.
+    ~GPUReleaseQueue()
+    {
+        if (m_frames.Size() > 0 || !m_current.empty())
+        {
+            SDL_WaitForGPUIdle(m_device);
+            Collect();
+            ReleaseObjects(m_current);
+        }
+    }
+
+    template <class T> void Release(T *object)
+    {
+        if (object)
+        {
+            m_current.push_back({object, &ReleaseObject<T>});
+        }
+    }
+
+    template <class T> void Release(DeviceOwned<T> &&object)
+    {
+        Release(object.Detach());
+    }
+
+    template <class T, class Context> void Release(SharedDeviceOwned<T, Context> &&object)
+    {
+        Release(object.Detach());
+    }
+
+    // Submits the command buffer, and queues everything released so far
+    // to be released once the GPU has finished it.
+    Result<void> Submit(SDL_GPUCommandBuffer *commandBuffer,
+                        Location location = Location::current())
+    {
+        if (m_current.empty())
+        {
+            if (!SDL_SubmitGPUCommandBuffer(commandBuffer)) [[unlikely]]
+            {
+                return Fail<void>(location);
+            }
+            return Success();
+        }
+
+        return m_frames.Submit(commandBuffer, m_current, location);
+    }
+
+    // Queues everything released so far to be released once the fence signals,
+    // taking ownership of the fence.
+    void Track(SDL_GPUFence *fence)
+    {
+        m_frames.Track(fence, m_current);
+    }
+
+    // Releases the objects of all frames the GPU has finished. Never waits.
+    void Collect()
+    {
+        m_frames.Collect([this](std::vector<Object> &objects) { ReleaseObjects(objects); });
+    }
+
+    size_t PendingFrames() const
+    {
+        return m_frames.Size();
+    }
+
+  private:
+    struct Object
+    {
+        void *object;
+        void (*release)(SDL_GPUDevice *device, void *object);
+    };
+
+    template <class T> static void ReleaseObject(SDL_GPUDevice *device, void *object)
+    {
+        ReleaseFromDevice<T>(device, static_cast<T *>(object));
+    }
+
+    void ReleaseObjects(std::vector<Object> &objects)
+    {
+        for (const Object &object : objects)
+        {
+            object.release(m_device, object.object);
+        }
+        objects.clear();
+    }
+
+    SDL_GPUDevice *m_device;
+    std::vector<Object> m_current;
+    GPUFenceTracker<Object> m_frames;
+};
+
+// Sub-allocates uploads from a few large transfer buffers ("chunks") that are reused,
+// instead of creating, mapping and releasing a transfer buffer per upload.
+// Allocate() returns mapped memory to write the data to, UploadToBuffer()/UploadToTexture()
+// record where it goes, and Flush() issues the recorded uploads in a copy pass, merging
+// uploads of adjacent regions into one call. Like GPUReleaseQueue, Submit() tags the chunks
+// used by a frame with its fence, and Collect() makes them available again once it signaled.
+// A chunk is therefore never mapped while the GPU reads from it, so mapping doesn't cycle.
+// Chunks allocated from after the last Flush() aren't submitted, and wait for the next one.
+struct GPUUploadRing
+{
+    struct Allocation
+    {
+        Uint8 *data;
+        Uint32 size;
+        SDL_GPUTransferBuffer *transferBuffer;
+        Uint32 offset;
+    };
+
+    explicit GPUUploadRing(SDL_GPUDevice *device, Uint32 chunkSize = 8 * 1024 * 1024)
+        : m_device{device}, m_chunkSize{chunkSize}, m_frames{device} {};
+    GPUUploadRing(const GPUUploadRing &) = delete;
+
+    GPUUploadRing &operator=(const GPUUploadRing &) = delete;
+
+    ~GPUUploadRing()
+    {
+        for (Chunk &chunk : m_flushed)
+        {
+            ReleaseChunk(chunk);
+        }
+        for (Chunk &chunk : m_active)
+        {
+            ReleaseChunk(chunk);
+        }
+        for (Chunk &chunk : m_free)
+        {
+            ReleaseChunk(chunk);
+        }
+        m_frames.ReleaseAll([this](std::vector<Chunk> &chunks) {
+            for (Chunk &chunk : chunks)
+            {
+                ReleaseChunk(chunk);
+            }
+        });
+    }
+
+    // Returns size bytes of mapped transfer buffer memory, aligned to alignment (a power of 2).
+    Result<Allocation> Allocate(Uint32 size, Uint32 alignment = 16,
+                                Location location = Location::current())
+    {
+        Chunk *chunk = m_active.empty() ? nullptr : &m_active.back();
+        Uint32 offset = chunk ? (chunk->used + alignment - 1) & ~(alignment - 1) : 0;
+
+        if (!chunk || !chunk->mapped || offset + size > chunk->size)
+        {
+            chunk = NextChunk(size);
+            if (!chunk) [[unlikely]]
+            {
+                return Fail<Allocation>(location);
+            }
+            offset = 0;
+        }
+
+        chunk->used = offset + size;
+        return Allocation{chunk->mapped + offset, size, chunk->transferBuffer, offset};
+    }
+
+    void UploadToBuffer(const Allocation &allocation, SDL_GPUBuffer *buffer, Uint32 offset,
+                        bool cycle = false)
+    {
+        m_bufferUploads.push_back({{allocation.transferBuffer, allocation.offset},
+                                   {buffer, offset, allocation.size},
+                                   cycle});
+    }
+
+    void UploadToTexture(const Allocation &allocation, const SDL_GPUTextureRegion &region,
+                         Uint32 pixelsPerRow = 0, Uint32 rowsPerLayer = 0, bool cycle = false)
+    {
+        m_textureUploads.push_back(
+            {{allocation.transferBuffer, allocation.offset, pixelsPerRow, rowsPerLayer},
+             region,
+             cycle});
+    }
+
+    // Issues all recorded uploads. Consecutive buffer uploads continuing each other
+    // in both the transfer buffer and the destination buffer become one upload.
+    void Flush(SDL_GPUCopyPass *copyPass)
+    {
+        for (Chunk &chunk : m_active)
+        {
+            if (chunk.mapped)
+            {
+                SDL_UnmapGPUTransferBuffer(m_device, chunk.transferBuffer);
+                chunk.mapped = nullptr;
+            }
+        }
+        m_flushed.insert(m_flushed.end(), m_active.begin(), m_active.end());
+        m_active.clear();
+
+        for (size_t i = 0; i < m_bufferUploads.size();)
+        {
+            BufferUpload upload = m_bufferUploads[i++];
+            while (i < m_bufferUploads.size() && Continues(upload, m_bufferUploads[i]))
+            {
+                upload.destination.size += m_bufferUploads[i++].destination.size;
+            }
+            SDL_UploadToGPUBuffer(copyPass, &upload.source, &upload.destination, upload.cycle);
+        }
+        m_bufferUploads.clear();
+
+        for (const TextureUpload &upload : m_textureUploads)
+        {
+            SDL_UploadToGPUTexture(copyPass, &upload.source, &upload.destination, upload.cycle);
+        }
+        m_textureUploads.clear();
+    }
+
+    // Submits the command buffer (containing the Flush()), and keeps the chunks flushed
+    // so far from being reused until the GPU has finished it.
+    Result<void> Submit(SDL_GPUCommandBuffer *commandBuffer,
+                        Location location = Location::current())
+    {
+        return m_frames.Submit(commandBuffer, m_flushed, location);
+    }
+
+    // Keeps the chunks flushed so far from being reused until the fence signals,
+    // taking ownership of the fence.
+    void Track(SDL_GPUFence *fence)
+    {
+        m_frames.Track(fence, m_flushed);
+    }
+
+    // Makes the chunks of all frames the GPU has finished available again. Never waits.
+    void Collect()
+    {
+        m_frames.Collect([this](std::vector<Chunk> &chunks) {
+            for (Chunk &chunk : chunks)
+            {
+                chunk.used = 0;
+                chunk.mapped = nullptr;
+                m_free.push_back(chunk);
+            }
+        });
+    }
+
+  private:
+    struct Chunk
+    {
+        SDL_GPUTransferBuffer *transferBuffer;
+        Uint32 size;
+        Uint32 used;
+        Uint8 *mapped;
+    };
+
+    struct BufferUpload
+    {
+        SDL_GPUTransferBufferLocation source;
+        SDL_GPUBufferRegion destination;
+        bool cycle;
+    };
+
+    struct TextureUpload
+    {
+        SDL_GPUTextureTransferInfo source;
+        SDL_GPUTextureRegion destination;
+        bool cycle;
+    };
+
+    static bool Continues(const BufferUpload &upload, const BufferUpload &next)
+    {
+        return !next.cycle && next.source.transfer_buffer == upload.source.transfer_buffer &&
+               next.source.offset == upload.source.offset + upload.destination.size &&
+               next.destination.buffer == upload.destination.buffer &&
+               next.destination.offset == upload.destination.offset + upload.destination.size;
+    }
+
+    // Maps a free chunk big enough for size bytes, or creates a new one,
+    // and makes it the active chunk allocations come from.
+    Chunk *NextChunk(Uint32 size)
+    {
+        Chunk chunk{};
+        for (size_t i = 0; i < m_free.size(); ++i)
+        {
+            if (m_free[i].size >= size)
+            {
+                chunk = m_free[i];
+                m_free[i] = m_free.back();
+                m_free.pop_back();
+                break;
+            }
+        }
+
+        if (!chunk.transferBuffer)
+        {
+            SDL_GPUTransferBufferCreateInfo createInfo{};
+            createInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+            createInfo.size = size > m_chunkSize ? size : m_chunkSize;
+            chunk.transferBuffer = SDL_CreateGPUTransferBuffer(m_device, &createInfo);
+            if (!chunk.transferBuffer)
+            {
+                return nullptr;
+            }
+            chunk.size = createInfo.size;
+        }
+
+        chunk.mapped =
+            static_cast<Uint8 *>(SDL_MapGPUTransferBuffer(m_device, chunk.transferBuffer, false));
+        if (!chunk.mapped)
+        {
+            m_free.push_back(chunk);
+            return nullptr;
+        }
+
+        m_active.push_back(chunk);
+        return &m_active.back();
+    }
+
+    void ReleaseChunk(Chunk &chunk)
+    {
+        if (chunk.mapped)
+        {
+            SDL_UnmapGPUTransferBuffer(m_device, chunk.transferBuffer);
+        }
+        SDL_ReleaseGPUTransferBuffer(m_device, chunk.transferBuffer);
+    }
+
+    SDL_GPUDevice *m_device;
+    Uint32 m_chunkSize;
+    std::vector<Chunk> m_free;
+    // Mapped chunks allocations come from, and the unmapped ones Flush() issued uploads from.
+    std::vector<Chunk> m_active;
+    std::vector<Chunk> m_flushed;
+    GPUFenceTracker<Chunk> m_frames;
+    std::vector<BufferUpload> m_bufferUploads;
+    std::vector<TextureUpload> m_textureUploads;
+};
+
+// Reads back GPU buffers and textures without stalling: DownloadFromBuffer()/
+// DownloadFromTexture() record a download into a pooled transfer buffer in a copy pass,
+// Submit() tags the frame's downloads with its fence, and Collect() calls each download's
+// callback with the data once its fence has signaled, so readbacks can be several frames
+// in flight.
+struct GPUReadbackQueue
+{
+    // Called from Collect() with the downloaded data, which is only valid during the call.
+    using Callback = void (*)(void *userdata, const void *data, Uint32 size);
+
+    explicit GPUReadbackQueue(SDL_GPUDevice *device) : m_device{device}, m_frames{device} {};
+    GPUReadbackQueue(const GPUReadbackQueue &) = delete;
+
+    GPUReadbackQueue &operator=(const GPUReadbackQueue &) = delete;
+
+    // Waits for the GPU to be idle, so all pending callbacks get called.
+    ~GPUReadbackQueue()
+    {
+        if (m_frames.Size() > 0)
+        {
+            SDL_WaitForGPUIdle(m_device);
+            Collect();
+        }
+        for (Download &download : m_current)
+        {
+            m_free.push_back(download.buffer);
+        }
+        for (const TransferBuffer &buffer : m_free)
+        {
+            SDL_ReleaseGPUTransferBuffer(m_device, buffer.transferBuffer);
+        }
+    }
+
+    Result<void> DownloadFromBuffer(SDL_GPUCopyPass *copyPass, const SDL_GPUBufferRegion &source,
+                                    Callback callback, void *userdata,
+                                    Location location = Location::current())
+    {
+        TransferBuffer buffer = AcquireBuffer(source.size);
+        if (!buffer.transferBuffer) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+
+        SDL_GPUTransferBufferLocation destination{buffer.transferBuffer, 0};
+        SDL_DownloadFromGPUBuffer(copyPass, &source, &destination);
+        m_current.push_back({buffer, source.size, callback, userdata});
+        return Success();
+    }
+
+    // size is the number of bytes the region takes in the transfer buffer,
+    // e.g. from SDL_CalculateGPUTextureFormatSize().
+    Result<void> DownloadFromTexture(SDL_GPUCopyPass *copyPass, const SDL_GPUTextureRegion &source,
+                                     Uint32 size, Callback callback, void *userdata,
+                                     Uint32 pixelsPerRow = 0, Uint32 rowsPerLayer = 0,
+                                     Location location = Location::current())
+    {
+        TransferBuffer buffer = AcquireBuffer(size);
+        if (!buffer.transferBuffer) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+
+        SDL_GPUTextureTransferInfo destination{buffer.transferBuffer, 0, pixelsPerRow,
+                                               rowsPerLayer};
+        SDL_DownloadFromGPUTexture(copyPass, &source, &destination);
+        m_current.push_back({buffer, size, callback, userdata});
+        return Success();
+    }
+
+    // Submits the command buffer containing the downloads recorded so far.
+    Result<void> Submit(SDL_GPUCommandBuffer *commandBuffer,
+                        Location location = Location::current())
+    {
+        return m_frames.Submit(commandBuffer, m_current, location);
+    }
+
+    // Completes the downloads recorded so far once the fence signals,
+    // taking ownership of the fence.
+    void Track(SDL_GPUFence *fence)
+    {
+        m_frames.Track(fence, m_current);
+    }
+
+    // Calls the callbacks of all downloads the GPU has finished. Never waits.
+    void Collect()
+    {
+        m_frames.Collect([this](std::vector<Download> &downloads) {
+            for (const Download &download : downloads)
+            {
+                Complete(download);
+            }
+        });
+    }
+
+    size_t PendingFrames() const
+    {
+        return m_frames.Size();
+    }
+
+  private:
+    struct TransferBuffer
+    {
+        SDL_GPUTransferBuffer *transferBuffer;
+        Uint32 size;
+    };
+
+    struct Download
+    {
+        TransferBuffer buffer;
+        Uint32 size;
+        Callback callback;
+        void *userdata;
+    };
+
+    // Takes the smallest pooled transfer buffer of at least size bytes out of the pool,
+    // or creates one with size rounded up to a power of 2.
+    TransferBuffer AcquireBuffer(Uint32 size)
+    {
+        size_t best = m_free.size();
+        for (size_t i = 0; i < m_free.size(); ++i)
+        {
+            if (m_free[i].size >= size &&
+                (best == m_free.size() || m_free[i].size < m_free[best].size))
+            {
+                best = i;
+            }
+        }
+
+        if (best == m_free.size())
+        {
+            Uint32 bufferSize = 64 * 1024;
+            while (bufferSize < size)
+            {
+                bufferSize *= 2;
+            }
+
+            SDL_GPUTransferBufferCreateInfo createInfo{};
+            createInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD;
+            createInfo.size = bufferSize;
+            SDL_GPUTransferBuffer *transferBuffer =
+                SDL_CreateGPUTransferBuffer(m_device, &createInfo);
+            return TransferBuffer{transferBuffer, transferBuffer ? bufferSize : 0};
+        }
+
+        TransferBuffer buffer = m_free[best];
+        m_free[best] = m_free.back();
+        m_free.pop_back();
+        return buffer;
+    }
+
+    void Complete(const Download &download)
+    {
+        void *data = SDL_MapGPUTransferBuffer(m_device, download.buffer.transferBuffer, false);
+        if (data)
+        {
+            download.callback(download.userdata, data, download.size);
+            SDL_UnmapGPUTransferBuffer(m_device, download.buffer.transferBuffer);
+        }
+        else
+        {
+            download.callback(download.userdata, nullptr, 0);
+        }
+        m_free.push_back(download.buffer);
+    }
+
+    SDL_GPUDevice *m_device;
+    std::vector<TransferBuffer> m_free;
+    std::vector<Download> m_current;
+    GPUFenceTracker<Download> m_frames;
+};
+
+// Appends the bytes of values to key, so create infos can be hashed and compared by content.
+template <class T> void AppendContentKey(std::string &key, const T *values, size_t count)
+{
+    key.append(reinterpret_cast<const char *>(values), sizeof(T) * count);
+}
+
+template <class T> void AppendContentKey(std::string &key, const T &value)
+{
+    AppendContentKey(key, &value, 1);
+}
+
+struct ContentKeyHash
+{
+    size_t operator()(const std::string &key) const
+    {
+        return SDL_murmur3_32(key.data(), key.size(), 0);
+    }
+};
+
+// Runs the parts of a job on worker threads and the calling thread.
+struct WorkerPool
+{
+    // Runs one part of a job, concurrently with the other parts. Returns false with the SDL
+    // error set on failure.
+    using PartFunction = bool (*)(void *userdata, int part);
+
+    // Starts numThreads - 1 workers; Run() works on the calling thread too.
+    explicit WorkerPool(int numThreads = SDL_GetNumLogicalCPUCores(),
+                        Location location = Location::current())
+        : m_mutex{CreateGuardMutex(location)}, m_work{SDL_CreateSemaphore(0)},
+          m_done{SDL_CreateCondition()}
+    {
+        // Without a mutex, which was reported already, only the calling thread works.
+        if (!m_mutex) [[unlikely]]
+        {
+            return;
+        }
+        if (!m_work || !m_done) [[unlikely]]
+        {
+            FailConstruction(location);
+            return;
+        }
+        for (int i = 1; i < numThreads; ++i)
+        {
+            Thread thread{SDL_CreateThread(WorkerThread, "SDLWorker", this)};
+            if (thread)
+            {
+                m_threads.push_back(std::move(thread));
+            }
+        }
+    }
+    WorkerPool(const WorkerPool &) = delete;
+
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    ~WorkerPool()
+    {
+        {
+            LockedMutex lock = ScopedLock(m_mutex);
+            m_quit = true;
+        }
+        for (size_t i = 0; i < m_threads.size(); ++i)
+        {
+            SDL_SignalSemaphore(m_work.get());
+        }
+        m_threads.clear();
+    }
+
+    int NumThreads() const
+    {
+        return int(m_threads.size()) + 1;
+    }
+
+    // Runs function for the parts 0 to numParts - 1, taking them in order, and returns once
+    // all of them have run. Returns false if any failed, with the error of the first failing
+    // part set on the calling thread. Only one thread may call Run() at a time.
+    bool Run(int numParts, PartFunction function, void *userdata)
+    {
+        if (numParts <= 0)
+        {
+            return true;
+        }
+
+        {
+            LockedMutex lock = ScopedLock(m_mutex);
+            m_function = function;
+            m_userdata = userdata;
+            m_numParts = numParts;
+            m_next = 0;
+            m_finished = 0;
+        }
+        for (size_t i = 0; i < m_threads.size() && int(i) + 1 < numParts; ++i)
+        {
+            SDL_SignalSemaphore(m_work.get());
+        }
+        RunParts();
+
+        std::string error;
+        bool failed = false;
+        {
+            LockedMutex lock = ScopedLock(m_mutex);
+            while (m_finished < m_numParts)
+            {
+                SDL_WaitCondition(m_done.get(), m_mutex.get());
+            }
+            m_numParts = 0;
+            failed = m_failed;
+            m_failed = false;
+            error.swap(m_error);
+        }
+        if (failed) [[unlikely]]
+        {
+            // SDL errors are per thread, so the worker's error is set again on this one.
+            SDL_SetError("%s", error.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    // Splits rows into bands of whole rows, a few per thread so that uneven bands even out,
+    // and runs function(firstRow, numRows) for each. Bands start on rows beginning on a cache
+    // line for the given pitch, so that writing a band doesn't share cache lines with the
+    // next. function returns false with the SDL error set on failure, and so does RunBands().
+    template <class Function> bool RunBands(int rows, int pitch, const Function &function)
+    {
+        int step = SDL_CACHELINE_SIZE;
+        for (int rest = pitch % step; rest != 0;)
+        {
+            int next = step % rest;
+            step = rest;
+            rest = next;
+        }
+        step = SDL_CACHELINE_SIZE / SDL_max(step, 1);
+        int steps = (rows + step - 1) / step;
+
+        struct Bands
+        {
+            const Function &function;
+            int rows;
+            int step;
+            int steps;
+            int numBands;
+        } bands{function, rows, step, steps, SDL_min(steps, NumThreads() * 4)};
+
+        return Run(
+            bands.numBands,
+            [](void *userdata, int band) {
+                Bands &bands = *static_cast<Bands *>(userdata);
+                Sint64 steps = bands.steps;
+                int first = int(steps * band / bands.numBands) * bands.step;
+                int end = int(steps * (band + 1) / bands.numBands) * bands.step;
+                end = SDL_min(end, bands.rows);
+                return bands.function(first, end - first);
+            },
+            &bands);
+    }
+
+  private:
+    static int SDLCALL WorkerThread(void *data)
+    {
+        WorkerPool *pool = static_cast<WorkerPool *>(data);
+        do
+        {
+            SDL_WaitSemaphore(pool->m_work.get());
+        } while (pool->RunParts());
+        return 0;
+    }
+
+    // Run() resets m_numParts once done, so late workers find nothing to run.
+    // Returns false once the pool is being destroyed.
+    bool RunParts()
+    {
+        for (;;)
+        {
+            int part = 0;
+            {
+                LockedMutex lock = ScopedLock(m_mutex);
+                if (m_quit)
+                {
+                    return false;
+                }
+                if (m_next >= m_numParts)
+                {
+                    return true;
+                }
+                part = m_next++;
+            }
+            bool succeeded = m_function(m_userdata, part);
+
+            LockedMutex lock = ScopedLock(m_mutex);
+            if (!succeeded && !m_failed)
+            {
+                m_failed = true;
+                m_error = SDL_GetError();
+            }
+            if (++m_finished == m_numParts)
+            {
+                SDL_SignalCondition(m_done.get());
+            }
+        }
+    }
+
+    Mutex m_mutex;
+    Semaphore m_work;
+    Condition m_done;
+    std::vector<Thread> m_threads;
+    PartFunction m_function = nullptr;
+    void *m_userdata = nullptr;
+    int m_numParts = 0;
+    int m_next = 0;
+    int m_finished = 0;
+    bool m_failed = false;
+    bool m_quit = false;
+    std::string m_error;
+};
+
+// Creates every distinct graphics and compute pipeline only once, and owns them.
+// Create infos are keyed by their contents, including the arrays they point to, while shaders
+// are keyed by identity. Zero-initialize create infos, so their padding fields don't split keys.
+// Safe to use from multiple threads.
+//
+// Save() writes the keys of the cached pipelines to storage, and Prebuild() creates them
+// again on a later run, in parallel, before they are first needed. Graphics pipelines are only
+// saved when both their shaders have a stable ID set via RegisterShader(), and pipelines
+// created with properties are never saved.
+struct GPUPipelineCache
+{
+    explicit GPUPipelineCache(SDL_GPUDevice *device, Location location = Location::current())
+        : m_device{device}, m_mutex{CreateGuardMutex(location)}, m_created{SDL_CreateCondition()}
+    {
+        if (!m_created) [[unlikely]]
+        {
+            FailConstruction(location);
+        }
+    }
+    GPUPipelineCache(const GPUPipelineCache &) = delete;
+
+    GPUPipelineCache &operator=(const GPUPipelineCache &) = delete;
+
+    ~GPUPipelineCache()
+    {
+        for (const auto &[key, pipeline] : m_graphics)
+        {
+            if (pipeline)
+            {
+                SDL_ReleaseGPUGraphicsPipeline(m_device, pipeline);
+            }
+        }
+        for (const auto &[key, pipeline] : m_compute)
+        {
+            if (pipeline)
+            {
+                SDL_ReleaseGPUComputePipeline(m_device, pipeline);
+            }
+        }
+    }
+
+    Result<SDL_GPUGraphicsPipeline *> GetGraphicsPipeline(
+        const SDL_GPUGraphicsPipelineCreateInfo &createInfo,
+        Location location = Location::current())
+    {
+        SDL_GPUGraphicsPipeline *pipeline = FindOrCreate(createInfo);
+        if (!pipeline) [[unlikely]]
+        {
+            return Fail<SDL_GPUGraphicsPipeline *>(location);
+        }
+        return pipeline;
+    }
+
+    Result<SDL_GPUComputePipeline *> GetComputePipeline(
+        const SDL_GPUComputePipelineCreateInfo &createInfo,
+        Location location = Location::current())
+    {
+        SDL_GPUComputePipeline *pipeline = FindOrCreate(createInfo);
+        if (!pipeline) [[unlikely]]
+        {
+            return Fail<SDL_GPUComputePipeline *>(location);
+        }
+        return pipeline;
+    }
+
+    // Gives the shader an ID that stays the same across runs, e.g. a hash of its code,
+    // so graphics pipelines using it can be saved and prebuilt.
+    void RegisterShader(Uint32 id, SDL_GPUShader *shader)
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        m_shaderIDs[shader] = id;
+        m_shaders[id] = shader;
+    }
+
+    Result<void> Save(SDL_Storage *storage, const char *path,
+                      Location location = Location::current())
+    {
+        Key manifest;
+        AppendContentKey(manifest, ManifestMagic);
+        {
+            LockedMutex lock = ScopedLock(m_mutex);
+            for (const auto &[key, pipeline] : m_graphics)
+            {
+                Key entry = key;
+                if (pipeline && Properties(entry) == 0 && ToShaderID(entry, 0) &&
+                    ToShaderID(entry, sizeof(Uint64)))
+                {
+                    AppendEntry(manifest, GraphicsEntry, entry);
+                }
+            }
+            for (const auto &[key, pipeline] : m_compute)
+            {
+                if (pipeline && Properties(key) == 0)
+                {
+                    AppendEntry(manifest, ComputeEntry, key);
+                }
+            }
+        }
+
+        if (!SDL_WriteStorageFile(storage, path, manifest.data(), manifest.size())) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        return Success();
+    }
+
+    // Creates the pipelines saved in path on the threads of pool, which must not run another
+    // job meanwhile, and returns how many of them were created.
+    Result<int> Prebuild(SDL_Storage *storage, const char *path, WorkerPool &pool,
+                         Location location = Location::current())
+    {
+        Uint64 size = 0;
+        if (!SDL_GetStorageFileSize(storage, path, &size)) [[unlikely]]
+        {
+            return Fail<int>(location);
+        }
+        Key manifest(size, '\0');
+        if (!SDL_ReadStorageFile(storage, path, manifest.data(), size)) [[unlikely]]
+        {
+            return Fail<int>(location);
+        }
+
+        PrebuildJobs jobs{this, {}};
+        Reader reader{manifest};
+        Uint32 magic = 0;
+        reader.Read(magic);
+        while (reader.ok && magic == ManifestMagic && reader.Remaining() > 0)
+        {
+            Entry entry;
+            reader.Read(entry.kind);
+            reader.ReadArray(entry.key);
+            bool resolved = entry.kind == ComputeEntry ||
+                            (FromShaderID(entry.key, 0) && FromShaderID(entry.key, sizeof(Uint64)));
+            if (reader.ok && resolved)
+            {
+                jobs.entries.push_back(std::move(entry));
+            }
+        }
+        if (!reader.ok || magic != ManifestMagic) [[unlikely]]
+        {
+            SDL_SetError("%s is not a valid pipeline cache manifest", path);
+            return Fail<int>(location);
+        }
+
+        // A pipeline that fails to build is only left out of the count, and created on demand.
+        pool.Run(
+            int(jobs.entries.size()),
+            [](void *userdata, int part) {
+                PrebuildJobs &jobs = *static_cast<PrebuildJobs *>(userdata);
+                if (jobs.cache->Build(jobs.entries[part]))
+                {
+                    SDL_AddAtomicInt(&jobs.built, 1);
+                }
+                return true;
+            },
+            &jobs);
+        return SDL_GetAtomicInt(&jobs.built);
+    }
+
+    size_t Size()
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        return m_graphics.size() + m_compute.size() - m_creating;
+    }
+
+  private:
+    using Key = std::string;
+
+    template <class T> using Map = std::unordered_map<Key, T *, ContentKeyHash>;
+
+    struct Entry
+    {
+        Uint8 kind;
+        Key key;
+    };
+
+    struct PrebuildJobs
+    {
+        GPUPipelineCache *cache;
+        std::vector<Entry> entries;
+        SDL_AtomicInt built{};
+    };
+
+    // Reads back what AppendContentKey() wrote. Any read past the end clears ok.
+    struct Reader
+    {
+        const Key &data;
+        size_t offset = 0;
+        bool ok = true;
+
+        size_t Remaining() const
+        {
+            return data.size() - offset;
+        }
+
+        template <class T> void Read(T *values, size_t count)
+        {
+            if (!ok || Remaining() / sizeof(T) < count)
+            {
+                ok = false;
+                return;
+            }
+            std::memcpy(values, data.data() + offset, sizeof(T) * count);
+            offset += sizeof(T) * count;
+        }
+
+        template <class T> void Read(T &value)
+        {
+            Read(&value, 1);
+        }
+
+        // Reads an element count followed by the elements.
+        template <class T> void ReadArray(T &values)
+        {
+            Uint32 count = 0;
+            Read(count);
+            if (ok && Remaining() / sizeof(values[0]) >= count)
+            {
+                values.resize(count);
+                Read(values.data(), count);
+            }
+            else
+            {
+                ok = false;
+            }
+        }
+    };
+
+    static constexpr Uint32 ManifestMagic = 0x31435050; // "PPC1"
+    static constexpr Uint8 GraphicsEntry = 'G';
+    static constexpr Uint8 ComputeEntry = 'C';
+
+    static void AppendEntry(Key &manifest, Uint8 kind, const Key &key)
+    {
+        AppendContentKey(manifest, kind);
+        AppendContentKey(manifest, Uint32(key.size()));
+        manifest.append(key);
+    }
+
+    // Shaders are the first two fields of a graphics key, and properties the last field
+    // of every key.
+    static Key GraphicsKey(const SDL_GPUGraphicsPipelineCreateInfo &info)
+    {
+        const SDL_GPUVertexInputState &input = info.vertex_input_state;
+        const SDL_GPUGraphicsPipelineTargetInfo &target = info.target_info;
+        Key key;
+        AppendContentKey(key, Uint64(uintptr_t(info.vertex_shader)));
+        AppendContentKey(key, Uint64(uintptr_t(info.fragment_shader)));
+        AppendContentKey(key, input.num_vertex_buffers);
+        AppendContentKey(key, input.vertex_buffer_descriptions, input.num_vertex_buffers);
+        AppendContentKey(key, input.num_vertex_attributes);
+        AppendContentKey(key, input.vertex_attributes, input.num_vertex_attributes);
+        AppendContentKey(key, info.primitive_type);
+        AppendContentKey(key, info.rasterizer_state);
+        AppendContentKey(key, info.multisample_state);
+        AppendContentKey(key, info.depth_stencil_state);
+        AppendContentKey(key, target.num_color_targets);
+        AppendContentKey(key, target.color_target_descriptions, target.num_color_targets);
+        AppendContentKey(key, target.depth_stencil_format);
+        AppendContentKey(key, target.has_depth_stencil_target);
+        AppendContentKey(key, info.props);
+        return key;
+    }
+
+    static Key ComputeKey(const SDL_GPUComputePipelineCreateInfo &info)
+    {
+        Uint32 entrypointSize = Uint32(std::strlen(info.entrypoint) + 1);
+        Key key;
+        AppendContentKey(key, Uint32(info.code_size));
+        AppendContentKey(key, info.code, info.code_size);
+        AppendContentKey(key, entrypointSize);
+        AppendContentKey(key, info.entrypoint, entrypointSize);
+        AppendContentKey(key, info.format);
+        AppendContentKey(key, info.num_samplers);
+        AppendContentKey(key, info.num_readonly_storage_textures);
+        AppendContentKey(key, info.num_readonly_storage_buffers);
+        AppendContentKey(key, info.num_readwrite_storage_textures);
+        AppendContentKey(key, info.num_readwrite_storage_buffers);
+        AppendContentKey(key, info.num_uniform_buffers);
+        AppendContentKey(key, info.threadcount_x);
+        AppendContentKey(key, info.threadcount_y);
+        AppendContentKey(key, info.threadcount_z);
+        AppendContentKey(key, info.props);
+        return key;
+    }
+
+    static SDL_PropertiesID Properties(const Key &key)
+    {
+        SDL_PropertiesID props = 0;
+        std::memcpy(&props, key.data() + key.size() - sizeof(props), sizeof(props));
+        return props;
+    }
+
+    // Replaces the shader pointer at offset in a graphics key with its registered ID.
+    bool ToShaderID(Key &key, size_t offset) const
+    {
+        Uint64 shader = 0;
+        std::memcpy(&shader, key.data() + offset, sizeof(shader));
+        auto it = m_shaderIDs.find(reinterpret_cast<SDL_GPUShader *>(uintptr_t(shader)));
+        if (it == m_shaderIDs.end())
+        {
+            return false;
+        }
+        Uint64 id = it->second;
+        std::memcpy(key.data() + offset, &id, sizeof(id));
+        return true;
+    }
+
+    bool FromShaderID(Key &key, size_t offset)
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        Uint64 id = 0;
+        if (key.size() < offset + sizeof(id))
+        {
+            return false;
+        }
+        std::memcpy(&id, key.data() + offset, sizeof(id));
+        auto it = m_shaders.find(Uint32(id));
+        if (it == m_shaders.end())
+        {
+            return false;
+        }
+        Uint64 shader = uintptr_t(it->second);
+        std::memcpy(key.data() + offset, &shader, sizeof(shader));
+        return true;
+    }
+
+    // Returns the pipeline for key, waiting while another thread creates it. Otherwise
+    // returns nullptr, with key entered as being created by the calling thread.
+    template <class T> T *FindOrReserve(Map<T> &map, const Key &key)
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        for (;;)
+        {
+            auto [it, inserted] = map.try_emplace(key, nullptr);
+            if (inserted)
+            {
+                ++m_creating;
+                return nullptr;
+            }
+            if (it->second)
+            {
+                return it->second;
+            }
+            SDL_WaitCondition(m_created.get(), m_mutex.get());
+        }
+    }
+
+    // Ends the creation FindOrReserve() entered key for. After a failure, the threads
+    // waiting for the pipeline try to create it themselves.
+    template <class T> T *Publish(Map<T> &map, const Key &key, T *pipeline)
+    {
+        {
+            LockedMutex lock = ScopedLock(m_mutex);
+            if (pipeline)
+            {
+                map[key] = pipeline;
+            }
+            else
+            {
+                map.erase(key);
+            }
+            --m_creating;
+        }
+        SDL_BroadcastCondition(m_created.get());
+        return pipeline;
+    }
+
+    // Pipelines are created without holding the lock, so threads creating different pipelines
+    // don't wait on each other. A thread asking for a pipeline being created waits for it.
+    SDL_GPUGraphicsPipeline *FindOrCreate(const SDL_GPUGraphicsPipelineCreateInfo &createInfo)
+    {
+        Key key = GraphicsKey(createInfo);
+        if (SDL_GPUGraphicsPipeline *pipeline = FindOrReserve(m_graphics, key))
+        {
+            return pipeline;
+        }
+        return Publish(m_graphics, key, SDL_CreateGPUGraphicsPipeline(m_device, &createInfo));
+    }
+
+    SDL_GPUComputePipeline *FindOrCreate(const SDL_GPUComputePipelineCreateInfo &createInfo)
+    {
+        Key key = ComputeKey(createInfo);
+        if (SDL_GPUComputePipeline *pipeline = FindOrReserve(m_compute, key))
+        {
+            return pipeline;
+        }
+        return Publish(m_compute, key, SDL_CreateGPUComputePipeline(m_device, &createInfo));
+    }
+
+    // Creates the pipeline of a manifest entry, with its shader IDs already replaced.
+    bool Build(const Entry &entry)
+    {
+        Reader reader{entry.key};
+        if (entry.kind == GraphicsEntry)
+        {
+            std::vector<SDL_GPUVertexBufferDescription> vertexBuffers;
+            std::vector<SDL_GPUVertexAttribute> vertexAttributes;
+            std::vector<SDL_GPUColorTargetDescription> colorTargets;
+            SDL_GPUGraphicsPipelineCreateInfo info{};
+            Uint64 vertexShader = 0;
+            Uint64 fragmentShader = 0;
+            reader.Read(vertexShader);
+            reader.Read(fragmentShader);
+            reader.ReadArray(vertexBuffers);
+            reader.ReadArray(vertexAttributes);
+            reader.Read(info.primitive_type);
+            reader.Read(info.rasterizer_state);
+            reader.Read(info.multisample_state);
+            reader.Read(info.depth_stencil_state);
+            reader.ReadArray(colorTargets);
+            reader.Read(info.target_info.depth_stencil_format);
+            reader.Read(info.target_info.has_depth_stencil_target);
+            reader.Read(info.props);
+            if (!reader.ok || reader.Remaining() != 0)
+            {
+                return false;
+            }
+            info.vertex_shader = reinterpret_cast<SDL_GPUShader *>(uintptr_t(vertexShader));
+            info.fragment_shader = reinterpret_cast<SDL_GPUShader *>(uintptr_t(fragmentShader));
+            info.vertex_input_state = {vertexBuffers.data(), Uint32(vertexBuffers.size()),
+                                       vertexAttributes.data(), Uint32(vertexAttributes.size())};
+            info.target_info.color_target_descriptions = colorTargets.data();
+            info.target_info.num_color_targets = Uint32(colorTargets.size());
+            return FindOrCreate(info) != nullptr;
+        }
+
+        std::vector<Uint8> code;
+        std::vector<char> entrypoint;
+        SDL_GPUComputePipelineCreateInfo info{};
+        reader.ReadArray(code);
+        reader.ReadArray(entrypoint);
+        reader.Read(info.format);
+        reader.Read(info.num_samplers);
+        reader.Read(info.num_readonly_storage_textures);
+        reader.Read(info.num_readonly_storage_buffers);
+        reader.Read(info.num_readwrite_storage_textures);
+        reader.Read(info.num_readwrite_storage_buffers);
+        reader.Read(info.num_uniform_buffers);
+        reader.Read(info.threadcount_x);
+        reader.Read(info.threadcount_y);
+        reader.Read(info.threadcount_z);
+        reader.Read(info.props);
+        if (!reader.ok || reader.Remaining() != 0 || entrypoint.empty() || entrypoint.back() != 0)
+        {
+            return false;
+        }
+        info.code_size = code.size();
+        info.code = code.data();
+        info.entrypoint = entrypoint.data();
+        return FindOrCreate(info) != nullptr;
+    }
+
+    SDL_GPUDevice *m_device;
+    Mutex m_mutex;
+    Condition m_created;
+    // A null pipeline is being created by some thread.
+    Map<SDL_GPUGraphicsPipeline> m_graphics;
+    Map<SDL_GPUComputePipeline> m_compute;
+    size_t m_creating = 0;
+    std::unordered_map<SDL_GPUShader *, Uint32> m_shaderIDs;
+    std::unordered_map<Uint32, SDL_GPUShader *> m_shaders;
+};
+
+// How GPUObjectCache keys and creates objects of type T.
+template <class T> struct GPUObjectTraits;
+
+template <> struct GPUObjectTraits<SDL_GPUSampler>
+{
+    using CreateInfo = SDL_GPUSamplerCreateInfo;
+
+    // The create info has explicit padding fields, so it can be keyed as a whole.
+    static std::string Key(const CreateInfo &createInfo)
+    {
+        std::string key;
+        AppendContentKey(key, createInfo);
+        return key;
+    }
+
+    static SDL_GPUSampler *Create(SDL_GPUDevice *device, const CreateInfo &createInfo)
+    {
+        return SDL_CreateGPUSampler(device, &createInfo);
+    }
+};
+
+template <> struct GPUObjectTraits<SDL_GPUShader>
+{
+    using CreateInfo = SDL_GPUShaderCreateInfo;
+
+    static std::string Key(const CreateInfo &createInfo)
+    {
+        std::string key;
+        AppendContentKey(key, Uint64(createInfo.code_size));
+        AppendContentKey(key, createInfo.code, createInfo.code_size);
+        AppendContentKey(key, createInfo.entrypoint, std::strlen(createInfo.entrypoint) + 1);
+        AppendContentKey(key, createInfo.format);
+        AppendContentKey(key, createInfo.stage);
+        AppendContentKey(key, createInfo.num_samplers);
+        AppendContentKey(key, createInfo.num_storage_textures);
+        AppendContentKey(key, createInfo.num_storage_buffers);
+        AppendContentKey(key, createInfo.num_uniform_buffers);
+        AppendContentKey(key, createInfo.props);
+        return key;
+    }
+
+    static SDL_GPUShader *Create(SDL_GPUDevice *device, const CreateInfo &createInfo)
+    {
+        return SDL_CreateGPUShader(device, &createInfo);
+    }
+};
+
+// Interns GPU objects: while a handle to an object is alive, creating one from an equal
+// create info returns that same object instead of a duplicate. The object is released
+// with its last handle. Safe to use from multiple threads.
+template <class T> struct GPUObjectCache
+{
+    using CreateInfo = typename GPUObjectTraits<T>::CreateInfo;
+    using Handle = std::shared_ptr<const DeviceOwned<T>>;
+
+    explicit GPUObjectCache(SDL_GPUDevice *device, Location location = Location::current())
+        : m_device{device}, m_mutex{CreateGuardMutex(location)} {};
+    GPUObjectCache(const GPUObjectCache &) = delete;
+
+    GPUObjectCache &operator=(const GPUObjectCache &) = delete;
+
+    Result<Handle> Get(const CreateInfo &createInfo, Location location = Location::current())
+    {
+        std::string key = GPUObjectTraits<T>::Key(createInfo);
+        LockedMutex lock = ScopedLock(m_mutex);
+        std::weak_ptr<const DeviceOwned<T>> &entry = m_objects[key];
+        if (Handle handle = entry.lock())
+        {
+            ++m_hits;
+            return handle;
+        }
+
+        T *object = GPUObjectTraits<T>::Create(m_device, createInfo);
+        if (!object) [[unlikely]]
+        {
+            m_objects.erase(key);
+            return Fail<Handle>(location);
+        }
+        ++m_misses;
+        Handle handle = std::make_shared<const DeviceOwned<T>>(m_device, object);
+        entry = handle;
+        return handle;
+    }
+
+    // Forgets the keys of objects whose handles are all gone.
+    void Prune()
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        std::erase_if(m_objects, [](const auto &entry) { return entry.second.expired(); });
+    }
+
+    // Number of calls to Get() that returned an existing object.
+    Uint64 Hits()
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        return m_hits;
+    }
+
+    // Number of calls to Get() that created an object.
+    Uint64 Misses()
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        return m_misses;
+    }
+
+  private:
+    SDL_GPUDevice *m_device;
+    Mutex m_mutex;
+    std::unordered_map<std::string, std::weak_ptr<const DeviceOwned<T>>, ContentKeyHash> m_objects;
+    Uint64 m_hits = 0;
+    Uint64 m_misses = 0;
+};
+
+using GPUSamplerCache = GPUObjectCache<SDL_GPUSampler>;
+using GPUShaderCache = GPUObjectCache<SDL_GPUShader>;
+
+// Records GPU passes on the threads of a WorkerPool, each pass into its own command buffer, and
+// submits the command buffers so that every pass comes after the passes it depends on. Each
+// command buffer is acquired, recorded and submitted on the same thread, as SDL requires.
+struct GPUCommandRecorder
+{
+    // Records a pass into commandBuffer, without submitting it. Returns false with the SDL error
+    // set on failure, and the command buffer is then canceled, so it must not fail once it has
+    // acquired a swapchain texture.
+    using RecordFunction = bool (*)(void *userdata, SDL_GPUCommandBuffer *commandBuffer);
+    using PassID = int;
+
+    // What a failed AddPass() returns under SDL_HPP_ERROR_CALLBACK, where 0 is the first pass.
+    // A pass depending on it fails to be added in turn.
+    static constexpr PassID InvalidPass = -1;
+
+    // pool must outlive the recorder, and not run another job during Execute().
+    GPUCommandRecorder(SDL_GPUDevice *device, WorkerPool &pool,
+                       Location location = Location::current())
+        : m_device{device}, m_pool{pool}, m_mutex{CreateGuardMutex(location)},
+          m_submitted{SDL_CreateCondition()}
+    {
+        if (!m_submitted) [[unlikely]]
+        {
+            FailConstruction(location);
+        }
+    }
+    GPUCommandRecorder(const GPUCommandRecorder &) = delete;
+
+    GPUCommandRecorder &operator=(const GPUCommandRecorder &) = delete;
+
+    // Adds a pass to the next Execute(). dependencies must be passes added before it.
+    Result<PassID> AddPass(RecordFunction record, void *userdata,
+                           std::initializer_list<PassID> dependencies = {},
+                           Location location = Location::current())
+    {
+        PassID id = PassID(m_passes.size());
+        for (PassID dependency : dependencies)
+        {
+            if (dependency < 0 || dependency >= id) [[unlikely]]
+            {
+                SDL_SetError("Pass %d depends on unknown pass %d", id, dependency);
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_CALLBACK
+                (void)Fail<PassID>(location);
+                return InvalidPass;
+#else
+                return Fail<PassID>(location);
+#endif
+            }
+        }
+        m_passes.push_back({record, userdata, dependencies, false});
+        return id;
+    }
+
+    // Records and submits all added passes, and returns once all of them are submitted or
+    // canceled. Fails with the error of the first pass that failed to record or submit.
+    Result<void> Execute(Location location = Location::current())
+    {
+        // The pool takes passes in the order they were added, so a pass waiting for its
+        // dependencies only ever waits for passes already taken by another thread, which
+        // can't deadlock.
+        bool submitted = m_pool.Run(
+            int(m_passes.size()),
+            [](void *userdata, int pass) {
+                GPUCommandRecorder *recorder = static_cast<GPUCommandRecorder *>(userdata);
+                return recorder->RunPass(recorder->m_passes[pass]);
+            },
+            this);
+        m_passes.clear();
+        if (!submitted) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        return Success();
+    }
+
+  private:
+    struct Pass
+    {
+        RecordFunction record;
+        void *userdata;
+        std::vector<PassID> dependencies;
+        bool submitted;
+    };
+
+    bool RunPass(Pass &pass)
+    {
+        SDL_GPUCommandBuffer *commandBuffer = SDL_AcquireGPUCommandBuffer(m_device);
+        bool recorded = commandBuffer && pass.record(pass.userdata, commandBuffer);
+        if (commandBuffer && !recorded) [[unlikely]]
+        {
+            // Keeps the error of the pass, not that of canceling.
+            std::string error = SDL_GetError();
+            SDL_CancelGPUCommandBuffer(commandBuffer);
+            SDL_SetError("%s", error.c_str());
+        }
+
+        LockedMutex lock = ScopedLock(m_mutex);
+        for (PassID dependency : pass.dependencies)
+        {
+            while (!m_passes[dependency].submitted)
+            {
+                SDL_WaitCondition(m_submitted.get(), m_mutex.get());
+            }
+        }
+        bool submitted = recorded && SDL_SubmitGPUCommandBuffer(commandBuffer);
+        // Also set when failing, so the dependent passes don't wait forever.
+        pass.submitted = true;
+        SDL_BroadcastCondition(m_submitted.get());
+        return submitted;
+    }
+
+    SDL_GPUDevice *m_device;
+    WorkerPool &m_pool;
+    Mutex m_mutex;
+    Condition m_submitted;
+    std::vector<Pass> m_passes;
+};
+
+// Owns a render pass begun with sdl::BeginGPURenderPass, and ends it when going out of scope.
+// Shadows the state bound through it, skipping calls that wouldn't change anything and
+// narrowing slot bindings to the slots that changed. Slots from MaxSlots on aren't shadowed.
+struct RenderPass
+{
+    static constexpr Uint32 MaxSlots = 16;
+
+    explicit RenderPass(SDL_GPURenderPass *renderPass) : m_renderPass{renderPass} {};
+    RenderPass(const RenderPass &) = delete;
+
+    RenderPass &operator=(const RenderPass &) = delete;
+
+    ~RenderPass()
+    {
+        End();
+    }
+
+    SDL_GPURenderPass *Get() const
+    {
+        return m_renderPass;
+    }
+
+    void End()
+    {
+        if (m_renderPass)
+        {
+            SDL_EndGPURenderPass(m_renderPass);
+            m_renderPass = nullptr;
+        }
+    }
+
+    void BindGraphicsPipeline(SDL_GPUGraphicsPipeline *pipeline)
+    {
+        if (Update(m_pipeline, pipeline))
+        {
+            SDL_BindGPUGraphicsPipeline(m_renderPass, pipeline);
+        }
+    }
+
+    void SetViewport(const SDL_GPUViewport &viewport)
+    {
+        if (Update(m_viewport, viewport))
+        {
+            SDL_SetGPUViewport(m_renderPass, &viewport);
+        }
+    }
+
+    void SetScissor(const SDL_Rect &scissor)
+    {
+        if (Update(m_scissor, scissor))
+        {
+            SDL_SetGPUScissor(m_renderPass, &scissor);
+        }
+    }
+
+    void SetBlendConstants(SDL_FColor blendConstants)
+    {
+        if (Update(m_blendConstants, blendConstants))
+        {
+            SDL_SetGPUBlendConstants(m_renderPass, blendConstants);
+        }
+    }
+
+    void SetStencilReference(Uint8 reference)
+    {
+        if (Update(m_stencilReference, reference))
+        {
+            SDL_SetGPUStencilReference(m_renderPass, reference);
+        }
+    }
+
+    void BindVertexBuffers(Uint32 firstSlot, const SDL_GPUBufferBinding *bindings,
+                           Uint32 numBindings)
+    {
+        BindSlots(m_vertexBuffers, firstSlot, bindings, numBindings, SDL_BindGPUVertexBuffers);
+    }
+
+    void BindIndexBuffer(const SDL_GPUBufferBinding &binding, SDL_GPUIndexElementSize size)
+    {
+        if (Update(m_indexBuffer, IndexBinding{binding, size}))
+        {
+            SDL_BindGPUIndexBuffer(m_renderPass, &binding, size);
+        }
+    }
+
+    void BindVertexSamplers(Uint32 firstSlot, const SDL_GPUTextureSamplerBinding *bindings,
+                            Uint32 numBindings)
+    {
+        BindSlots(m_vertexSamplers, firstSlot, bindings, numBindings, SDL_BindGPUVertexSamplers);
+    }
+
+    void BindVertexStorageTextures(Uint32 firstSlot, SDL_GPUTexture *const *textures,
+                                   Uint32 numBindings)
+    {
+        BindSlots(m_vertexStorageTextures, firstSlot, textures, numBindings,
+                  SDL_BindGPUVertexStorageTextures);
+    }
+
+    void BindVertexStorageBuffers(Uint32 firstSlot, SDL_GPUBuffer *const *buffers,
+                                  Uint32 numBindings)
+    {
+        BindSlots(m_vertexStorageBuffers, firstSlot, buffers, numBindings,
+                  SDL_BindGPUVertexStorageBuffers);
+    }
+
+    void BindFragmentSamplers(Uint32 firstSlot, const SDL_GPUTextureSamplerBinding *bindings,
+                              Uint32 numBindings)
+    {
+        BindSlots(m_fragmentSamplers, firstSlot, bindings, numBindings,
+                  SDL_BindGPUFragmentSamplers);
+    }
+
+    void BindFragmentStorageTextures(Uint32 firstSlot, SDL_GPUTexture *const *textures,
+                                     Uint32 numBindings)
+    {
+        BindSlots(m_fragmentStorageTextures, firstSlot, textures, numBindings,
+                  SDL_BindGPUFragmentStorageTextures);
+    }
+
+    void BindFragmentStorageBuffers(Uint32 firstSlot, SDL_GPUBuffer *const *buffers,
+                                    Uint32 numBindings)
+    {
+        BindSlots(m_fragmentStorageBuffers, firstSlot, buffers, numBindings,
+                  SDL_BindGPUFragmentStorageBuffers);
+    }
+
+    // Number of bind and set calls passed on to SDL.
+    Uint32 Issued() const
+    {
+        return m_issued;
+    }
+
+    // Number of bind and set calls skipped because they wouldn't have changed anything.
+    Uint32 Elided() const
+    {
+        return m_elided;
+    }
+
+  private:
+    template <class T>
+    using BindFunction = void (*)(SDL_GPURenderPass *, Uint32, const T *, Uint32);
+
+    struct IndexBinding
+    {
+        SDL_GPUBufferBinding binding;
+        SDL_GPUIndexElementSize size;
+    };
+
+    static bool Same(const IndexBinding &a, const IndexBinding &b)
+    {
+        return Same(a.binding, b.binding) && a.size == b.size;
+    }
+
+    static bool Same(const SDL_GPUBufferBinding &a, const SDL_GPUBufferBinding &b)
+    {
+        return a.buffer == b.buffer && a.offset == b.offset;
+    }
+
+    static bool Same(const SDL_GPUTextureSamplerBinding &a, const SDL_GPUTextureSamplerBinding &b)
+    {
+        return a.texture == b.texture && a.sampler == b.sampler;
+    }
+
+    // For types without padding.
+    template <class T> static bool Same(const T &a, const T &b)
+    {
+        return std::memcmp(&a, &b, sizeof(T)) == 0;
+    }
+
+    // Returns whether the call setting value needs to be issued, counting it.
+    template <class T> bool Update(std::optional<T> &shadow, const T &value)
+    {
+        if (shadow && Same(*shadow, value))
+        {
+            ++m_elided;
+            return false;
+        }
+        shadow = value;
+        ++m_issued;
+        return true;
+    }
+
+    template <class T>
+    void BindSlots(std::optional<T> (&shadow)[MaxSlots], Uint32 firstSlot, const T *bindings,
+                   Uint32 numBindings, BindFunction<T> bind)
+    {
+        if (firstSlot >= MaxSlots || numBindings > MaxSlots - firstSlot)
+        {
+            for (Uint32 slot = firstSlot; slot < MaxSlots; ++slot)
+            {
+                shadow[slot] = bindings[slot - firstSlot];
+            }
+            bind(m_renderPass, firstSlot, bindings, numBindings);
+            ++m_issued;
+            return;
+        }
+
+        Uint32 first = numBindings;
+        Uint32 last = 0;
+        for (Uint32 i = 0; i < numBindings; ++i)
+        {
+            std::optional<T> &slot = shadow[firstSlot + i];
+            if (!slot || !Same(*slot, bindings[i]))
+            {
+                slot = bindings[i];
+                first = first < i ? first : i;
+                last = i;
+            }
+        }
+        if (first == numBindings)
+        {
+            ++m_elided;
+            return;
+        }
+        bind(m_renderPass, firstSlot + first, bindings + first, last - first + 1);
+        ++m_issued;
+    }
+
+    SDL_GPURenderPass *m_renderPass;
+    std::optional<SDL_GPUGraphicsPipeline *> m_pipeline;
+    std::optional<SDL_GPUViewport> m_viewport;
+    std::optional<SDL_Rect> m_scissor;
+    std::optional<SDL_FColor> m_blendConstants;
+    std::optional<Uint8> m_stencilReference;
+    std::optional<IndexBinding> m_indexBuffer;
+    std::optional<SDL_GPUBufferBinding> m_vertexBuffers[MaxSlots];
+    std::optional<SDL_GPUTextureSamplerBinding> m_vertexSamplers[MaxSlots];
+    std::optional<SDL_GPUTexture *> m_vertexStorageTextures[MaxSlots];
+    std::optional<SDL_GPUBuffer *> m_vertexStorageBuffers[MaxSlots];
+    std::optional<SDL_GPUTextureSamplerBinding> m_fragmentSamplers[MaxSlots];
+    std::optional<SDL_GPUTexture *> m_fragmentStorageTextures[MaxSlots];
+    std::optional<SDL_GPUBuffer *> m_fragmentStorageBuffers[MaxSlots];
+    Uint32 m_issued = 0;
+    Uint32 m_elided = 0;
+};
+
+// An upload transfer buffer, and optionally a GPU buffer it is copied to, that grow by
+// doubling to fit what is mapped. Replaced buffers are released right away, which SDL defers
+// until the GPU is done with them.
+struct GPUGrowableBuffer
+{
+    // Without usage, there's only the transfer buffer.
+    GPUGrowableBuffer(SDL_GPUDevice *device, SDL_GPUBufferUsageFlags usage,
+                      Uint32 initialCapacity)
+        : m_device{device}, m_usage{usage}, m_initialCapacity{initialCapacity} {};
+    GPUGrowableBuffer(const GPUGrowableBuffer &) = delete;
+
+    GPUGrowableBuffer &operator=(const GPUGrowableBuffer &) = delete;
+
+    ~GPUGrowableBuffer()
+    {
+        SDL_ReleaseGPUBuffer(m_device, m_buffer);
+        SDL_ReleaseGPUTransferBuffer(m_device, m_transferBuffer);
+    }
+
+    // Maps size bytes of the transfer buffer, cycling it. Returns nullptr on failure.
+    void *Map(Uint32 size)
+    {
+        return Reserve(size) ? SDL_MapGPUTransferBuffer(m_device, m_transferBuffer, true)
+                             : nullptr;
+    }
+
+    void Unmap()
+    {
+        SDL_UnmapGPUTransferBuffer(m_device, m_transferBuffer);
+    }
+
+    // Copies the first size bytes of the transfer buffer to the GPU buffer, cycling it.
+    void Upload(SDL_GPUCopyPass *copyPass, Uint32 size)
+    {
+        SDL_GPUTransferBufferLocation source{m_transferBuffer, 0};
+        SDL_GPUBufferRegion destination{m_buffer, 0, size};
+        SDL_UploadToGPUBuffer(copyPass, &source, &destination, true);
+    }
+
+    SDL_GPUBuffer *Buffer() const
+    {
+        return m_buffer;
+    }
+
+    SDL_GPUTransferBuffer *TransferBuffer() const
+    {
+        return m_transferBuffer;
+    }
+
+  private:
+    bool Reserve(Uint32 size)
+    {
+        if (size <= m_capacity)
+        {
+            return true;
+        }
+        Uint32 capacity = m_capacity ? m_capacity : m_initialCapacity;
+        while (capacity < size)
+        {
+            capacity *= 2;
+        }
+
+        SDL_ReleaseGPUBuffer(m_device, m_buffer);
+        SDL_ReleaseGPUTransferBuffer(m_device, m_transferBuffer);
+        m_buffer = nullptr;
+        m_capacity = 0;
+        if (m_usage)
+        {
+            SDL_GPUBufferCreateInfo bufferInfo{};
+            bufferInfo.usage = m_usage;
+            bufferInfo.size = capacity;
+            m_buffer = SDL_CreateGPUBuffer(m_device, &bufferInfo);
+        }
+        SDL_GPUTransferBufferCreateInfo transferInfo{};
+        transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        transferInfo.size = capacity;
+        m_transferBuffer = SDL_CreateGPUTransferBuffer(m_device, &transferInfo);
+        if ((m_usage && !m_buffer) || !m_transferBuffer)
+        {
+            return false;
+        }
+        m_capacity = capacity;
+        return true;
+    }
+
+    SDL_GPUDevice *m_device;
+    SDL_GPUBufferUsageFlags m_usage;
+    Uint32 m_initialCapacity;
+    SDL_GPUBuffer *m_buffer = nullptr;
+    SDL_GPUTransferBuffer *m_transferBuffer = nullptr;
+    Uint32 m_capacity = 0;
+};
+
+// Sorts indexed draws by a key and issues them through an sdl::RenderPass, which skips the
+// binds that didn't change. Consecutive draws sharing all their state are merged into one
+// SDL_DrawGPUIndexedPrimitivesIndirect. Add() the draws, upload their indirect commands
+// with Prepare() during a copy pass, then issue them with Draw() during the render pass.
+struct GPUDrawQueue
+{
+    struct DrawPacket
+    {
+        // Draws are issued in ascending key order, and in the order they were added for
+        // equal keys. Putting the pipeline and bindings in the high bits makes draws sharing
+        // them consecutive, so they can be merged.
+        Uint64 key;
+        SDL_GPUGraphicsPipeline *pipeline;
+        SDL_GPUBufferBinding vertexBuffer;
+        SDL_GPUBufferBinding indexBuffer;
+        SDL_GPUIndexElementSize indexElementSize;
+        // Bound if texture isn't null.
+        SDL_GPUTextureSamplerBinding fragmentSampler;
+        SDL_GPUIndexedIndirectDrawCommand command;
+    };
+
+    explicit GPUDrawQueue(SDL_GPUDevice *device)
+        : m_indirectBuffer{device, SDL_GPU_BUFFERUSAGE_INDIRECT, 4096} {};
+    GPUDrawQueue(const GPUDrawQueue &) = delete;
+
+    GPUDrawQueue &operator=(const GPUDrawQueue &) = delete;
+
+    // The uniform data is copied, and pushed to slot 0 before the draw.
+    void Add(const DrawPacket &draw, const void *vertexUniforms = nullptr,
+             Uint32 vertexUniformsSize = 0, const void *fragmentUniforms = nullptr,
+             Uint32 fragmentUniformsSize = 0)
+    {
+        m_sorted.push_back({draw.key, Uint32(m_packets.size())});
+        m_packets.push_back({draw, StoreUniforms(vertexUniforms, vertexUniformsSize),
+                             StoreUniforms(fragmentUniforms, fragmentUniformsSize)});
+    }
+
+    // Sorts the draws, and uploads the commands of the merged ones to the indirect buffer.
+    // If this fails, Draw() issues nothing.
+    Result<void> Prepare(SDL_GPUCopyPass *copyPass, Location location = Location::current())
+    {
+        Sort();
+
+        m_runs.clear();
+        Uint32 numCommands = 0;
+        for (Uint32 i = 0; i < m_sorted.size();)
+        {
+            Uint32 end = i + 1;
+            while (end < m_sorted.size() && SameState(m_packets[m_sorted[i].index],
+                                                      m_packets[m_sorted[end].index]))
+            {
+                ++end;
+            }
+            Uint32 count = end - i;
+            m_runs.push_back({i, count, count > 1 ? numCommands : 0});
+            numCommands += count > 1 ? count : 0;
+            i = end;
+        }
+        if (numCommands == 0)
+        {
+            return Success();
+        }
+
+        Uint32 size = numCommands * Uint32(sizeof(SDL_GPUIndexedIndirectDrawCommand));
+        void *mapped = m_indirectBuffer.Map(size);
+        if (!mapped) [[unlikely]]
+        {
+            m_runs.clear();
+            return Fail<void>(location);
+        }
+        auto *commands = static_cast<SDL_GPUIndexedIndirectDrawCommand *>(mapped);
+        for (const Run &run : m_runs)
+        {
+            for (Uint32 i = 0; run.count > 1 && i < run.count; ++i)
+            {
+                const QueuedDraw &draw = m_packets[m_sorted[run.first + i].index];
+                commands[run.firstCommand + i] = draw.draw.command;
+            }
+        }
+        m_indirectBuffer.Unmap();
+        m_indirectBuffer.Upload(copyPass, size);
+        return Success();
+    }
+
+    // Issues the draws sorted by Prepare(), pushing their uniforms to commandBuffer,
+    // and clears the queue.
+    void Draw(RenderPass &renderPass, SDL_GPUCommandBuffer *commandBuffer)
+    {
+        const QueuedDraw *previous = nullptr;
+        m_drawCalls = 0;
+        for (const Run &run : m_runs)
+        {
+            const QueuedDraw &packet = m_packets[m_sorted[run.first].index];
+            const DrawPacket &draw = packet.draw;
+            renderPass.BindGraphicsPipeline(draw.pipeline);
+            renderPass.BindVertexBuffers(0, &draw.vertexBuffer, 1);
+            renderPass.BindIndexBuffer(draw.indexBuffer, draw.indexElementSize);
+            if (draw.fragmentSampler.texture)
+            {
+                renderPass.BindFragmentSamplers(0, &draw.fragmentSampler, 1);
+            }
+            if (packet.vertexUniforms.size &&
+                (!previous || !SameUniforms(previous->vertexUniforms, packet.vertexUniforms)))
+            {
+                SDL_PushGPUVertexUniformData(commandBuffer, 0, Data(packet.vertexUniforms),
+                                             packet.vertexUniforms.size);
+            }
+            if (packet.fragmentUniforms.size &&
+                (!previous || !SameUniforms(previous->fragmentUniforms, packet.fragmentUniforms)))
+            {
+                SDL_PushGPUFragmentUniformData(commandBuffer, 0, Data(packet.fragmentUniforms),
+                                               packet.fragmentUniforms.size);
+            }
+            previous = &packet;
+
+            if (run.count == 1)
+            {
+                const SDL_GPUIndexedIndirectDrawCommand &command = draw.command;
+                SDL_DrawGPUIndexedPrimitives(renderPass.Get(), command.num_indices,
+                                             command.num_instances, command.first_index,
+                                             command.vertex_offset, command.first_instance);
+            }
+            else
+            {
+                Uint32 offset = run.firstCommand * sizeof(SDL_GPUIndexedIndirectDrawCommand);
+                SDL_DrawGPUIndexedPrimitivesIndirect(renderPass.Get(), m_indirectBuffer.Buffer(),
+                                                     offset, run.count);
+            }
+            ++m_drawCalls;
+        }
+        Clear();
+    }
+
+    void Clear()
+    {
+        m_packets.clear();
+        m_sorted.clear();
+        m_scratch.clear();
+        m_runs.clear();
+        m_uniforms.clear();
+    }
+
+    // Number of draw calls the last Draw() issued.
+    Uint32 DrawCalls() const
+    {
+        return m_drawCalls;
+    }
+
+  private:
+    struct Uniforms
+    {
+        Uint32 offset;
+        Uint32 size;
+    };
+
+    struct QueuedDraw
+    {
+        DrawPacket draw;
+        Uniforms vertexUniforms;
+        Uniforms fragmentUniforms;
+    };
+
+    struct SortEntry
+    {
+        Uint64 key;
+        Uint32 index;
+    };
+
+    // Draws merged into one indirect draw when count > 1.
+    struct Run
+    {
+        Uint32 first;
+        Uint32 count;
+        Uint32 firstCommand;
+    };
+
+    Uniforms StoreUniforms(const void *data, Uint32 size)
+    {
+        Uniforms uniforms{Uint32(m_uniforms.size()), size};
+        m_uniforms.insert(m_uniforms.end(), static_cast<const Uint8 *>(data),
+                          static_cast<const Uint8 *>(data) + size);
+        return uniforms;
+    }
+
+    const Uint8 *Data(Uniforms uniforms) const
+    {
+        return m_uniforms.data() + uniforms.offset;
+    }
+
+    bool SameUniforms(Uniforms a, Uniforms b) const
+    {
+        return a.size == b.size && std::memcmp(Data(a), Data(b), a.size) == 0;
+    }
+
+    bool SameState(const QueuedDraw &a, const QueuedDraw &b) const
+    {
+        const DrawPacket &x = a.draw;
+        const DrawPacket &y = b.draw;
+        return x.pipeline == y.pipeline && x.vertexBuffer.buffer == y.vertexBuffer.buffer &&
+               x.vertexBuffer.offset == y.vertexBuffer.offset &&
+               x.indexBuffer.buffer == y.indexBuffer.buffer &&
+               x.indexBuffer.offset == y.indexBuffer.offset &&
+               x.indexElementSize == y.indexElementSize &&
+               x.fragmentSampler.texture == y.fragmentSampler.texture &&
+               x.fragmentSampler.sampler == y.fragmentSampler.sampler &&
+               SameUniforms(a.vertexUniforms, b.vertexUniforms) &&
+               SameUniforms(a.fragmentUniforms, b.fragmentUniforms);
+    }
+
+    // LSD radix sort on 8-bit digits, which is stable. Digits that are the same in every
+    // key are skipped, so keys only using a few bits take few passes.
+    void Sort()
+    {
+        m_scratch.resize(m_sorted.size());
+        for (int shift = 0; shift < 64 && !m_sorted.empty(); shift += 8)
+        {
+            Uint32 offsets[256] = {};
+            for (const SortEntry &entry : m_sorted)
+            {
+                ++offsets[(entry.key >> shift) & 0xFF];
+            }
+            if (offsets[(m_sorted[0].key >> shift) & 0xFF] == m_sorted.size())
+            {
+                continue;
+            }
+
+            Uint32 offset = 0;
+            for (Uint32 &count : offsets)
+            {
+                Uint32 bucketSize = count;
+                count = offset;
+                offset += bucketSize;
+            }
+            for (const SortEntry &entry : m_sorted)
+            {
+                m_scratch[offsets[(entry.key >> shift) & 0xFF]++] = entry;
+            }
+            m_sorted.swap(m_scratch);
+        }
+    }
+
+    GPUGrowableBuffer m_indirectBuffer;
+    std::vector<QueuedDraw> m_packets;
+    std::vector<SortEntry> m_sorted;
+    std::vector<SortEntry> m_scratch;
+    std::vector<Run> m_runs;
+    std::vector<Uint8> m_uniforms;
+    Uint32 m_drawCalls = 0;
+};
+
+// Packs per-draw uniform data into one storage buffer instead of pushing it per draw.
+// Push() returns the index of the data in the buffer, which the draw passes on to its
+// shader, e.g. as first_instance. Upload() copies everything pushed since the last upload
+// during a copy pass, and BindVertex()/BindFragment() bind the buffer to a render pass.
+struct GPUUniformArena
+{
+    explicit GPUUniformArena(SDL_GPUDevice *device)
+        : m_buffer{device, SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ, 64 * 1024} {};
+    GPUUniformArena(const GPUUniformArena &) = delete;
+
+    GPUUniformArena &operator=(const GPUUniformArena &) = delete;
+
+    // Places the data at a multiple of stride, and returns that multiple, so the shader
+    // can read it as element index of a structured buffer with that stride.
+    Uint32 Push(const void *data, Uint32 size, Uint32 stride)
+    {
+        Uint32 index = Uint32((m_data.size() + stride - 1) / stride);
+        m_data.resize(size_t(index) * stride);
+        m_data.insert(m_data.end(), static_cast<const Uint8 *>(data),
+                      static_cast<const Uint8 *>(data) + size);
+        return index;
+    }
+
+    template <class T> Uint32 Push(const T &uniforms)
+    {
+        return Push(&uniforms, sizeof(T), sizeof(T));
+    }
+
+    // Uploads the data pushed since the last upload, replacing it in the storage buffer.
+    // The upload cycles the buffer, so draws still in flight keep reading the previous data.
+    Result<void> Upload(SDL_GPUCopyPass *copyPass, Location location = Location::current())
+    {
+        if (m_data.empty())
+        {
+            return Success();
+        }
+
+        Uint32 size = Uint32(m_data.size());
+        void *mapped = m_buffer.Map(size);
+        if (!mapped) [[unlikely]]
+        {
+            m_data.clear();
+            return Fail<void>(location);
+        }
+        std::memcpy(mapped, m_data.data(), size);
+        m_buffer.Unmap();
+        m_buffer.Upload(copyPass, size);
+        m_data.clear();
+        return Success();
+    }
+
+    void BindVertex(RenderPass &renderPass, Uint32 slot) const
+    {
+        SDL_GPUBuffer *buffer = m_buffer.Buffer();
+        renderPass.BindVertexStorageBuffers(slot, &buffer, 1);
+    }
+
+    void BindFragment(RenderPass &renderPass, Uint32 slot) const
+    {
+        SDL_GPUBuffer *buffer = m_buffer.Buffer();
+        renderPass.BindFragmentStorageBuffers(slot, &buffer, 1);
+    }
+
+    SDL_GPUBuffer *Buffer() const
+    {
+        return m_buffer.Buffer();
+    }
+
+  private:
+    GPUGrowableBuffer m_buffer;
+    std::vector<Uint8> m_data;
+};
+
+// Packs rectangles into a width x height area, using the skyline bottom-left heuristic.
+// Removed rectangles go to a free list, and later inserts that fit reuse them, so an atlas
+// can keep streaming entries in and out without being repacked.
+struct AtlasPacker
+{
+    AtlasPacker(int width, int height) : m_width{width}, m_height{height}
+    {
+        Clear();
+    }
+
+    // Finds room for a w x h rectangle. Returns false if there's none.
+    bool Insert(int w, int h, SDL_Rect &rect)
+    {
+        if (w <= 0 || h <= 0)
+        {
+            return false;
+        }
+        return InsertIntoFreeList(w, h, rect) || InsertIntoSkyline(w, h, rect);
+    }
+
+    // Makes the room of a rectangle returned by Insert() available again.
+    void Remove(const SDL_Rect &rect)
+    {
+        m_free.push_back(rect);
+    }
+
+    void Clear()
+    {
+        m_skyline.assign(1, {0, 0, m_width});
+        m_free.clear();
+    }
+
+  private:
+    struct Segment
+    {
+        int x;
+        int y;
+        int width;
+    };
+
+    // Best fit by area, splitting the rest of the free rectangle in two.
+    bool InsertIntoFreeList(int w, int h, SDL_Rect &rect)
+    {
+        size_t best = m_free.size();
+        for (size_t i = 0; i < m_free.size(); ++i)
+        {
+            const SDL_Rect &free = m_free[i];
+            if (free.w >= w && free.h >= h &&
+                (best == m_free.size() || free.w * free.h < m_free[best].w * m_free[best].h))
+            {
+                best = i;
+            }
+        }
+        if (best == m_free.size())
+        {
+            return false;
+        }
+
+        SDL_Rect free = m_free[best];
+        m_free[best] = m_free.back();
+        m_free.pop_back();
+        rect = {free.x, free.y, w, h};
+        if (free.w > w)
+        {
+            m_free.push_back({free.x + w, free.y, free.w - w, h});
+        }
+        if (free.h > h)
+        {
+            m_free.push_back({free.x, free.y + h, free.w, free.h - h});
+        }
+        return true;
+    }
+
+    // Returns the y a w x h rectangle would be placed at on the segment, or -1.
+    int Fit(size_t index, int w, int h) const
+    {
+        int x = m_skyline[index].x;
+        if (x + w > m_width)
+        {
+            return -1;
+        }
+        int y = 0;
+        for (size_t i = index; i < m_skyline.size() && m_skyline[i].x < x + w; ++i)
+        {
+            y = y > m_skyline[i].y ? y : m_skyline[i].y;
+        }
+        return y + h <= m_height ? y : -1;
+    }
+
+    bool InsertIntoSkyline(int w, int h, SDL_Rect &rect)
+    {
+        size_t best = m_skyline.size();
+        int bestY = m_height;
+        for (size_t i = 0; i < m_skyline.size(); ++i)
+        {
+            int y = Fit(i, w, h);
+            if (y >= 0 && y < bestY)
+            {
+                best = i;
+                bestY = y;
+            }
+        }
+        if (best == m_skyline.size())
+        {
+            return false;
+        }
+
+        rect = {m_skyline[best].x, bestY, w, h};
+        m_skyline.insert(m_skyline.begin() + best, {rect.x, bestY + h, w});
+
+        // Cut the segments now lying below the new one.
+        size_t i = best + 1;
+        while (i < m_skyline.size() && m_skyline[i].x < rect.x + w)
+        {
+            int overlap = rect.x + w - m_skyline[i].x;
+            if (overlap < m_skyline[i].width)
+            {
+                m_skyline[i].x += overlap;
+                m_skyline[i].width -= overlap;
+                break;
+            }
+            m_skyline.erase(m_skyline.begin() + i);
+        }
+
+        // Merge neighbours of the same height.
+        for (size_t j = 0; j + 1 < m_skyline.size();)
+        {
+            if (m_skyline[j].y == m_skyline[j + 1].y)
+            {
+                m_skyline[j].width += m_skyline[j + 1].width;
+                m_skyline.erase(m_skyline.begin() + j + 1);
+            }
+            else
+            {
+                ++j;
+            }
+        }
+        return true;
+    }
+
+    int m_width;
+    int m_height;
+    std::vector<Segment> m_skyline;
+    std::vector<SDL_Rect> m_free;
+};
+
+// Packs surfaces into an SDL_Texture, which it doesn't own. Insert() returns the rectangle
+// an entry got, and Remove() lets later entries reuse it. padding pixels are left between
+// entries, so filtering doesn't bleed between them.
+struct TextureAtlas
+{
+    explicit TextureAtlas(SDL_Texture *texture, int padding = 1)
+        : m_texture{texture}, m_padding{padding},
+          m_packer{texture->w + padding, texture->h + padding} {};
+    TextureAtlas(const TextureAtlas &) = delete;
+
+    TextureAtlas &operator=(const TextureAtlas &) = delete;
+
+    Result<SDL_Rect> Insert(SDL_Surface *surface, Location location = Location::current())
+    {
+        SDL_Rect rect;
+        if (!m_packer.Insert(surface->w + m_padding, surface->h + m_padding, rect)) [[unlikely]]
+        {
+            SDL_SetError("Texture atlas is full");
+            return Fail<SDL_Rect>(location);
+        }
+        rect.w = surface->w;
+        rect.h = surface->h;
+
+        Surface converted;
+        if (surface->format != m_texture->format || SDL_MUSTLOCK(surface))
+        {
+            converted.reset(SDL_ConvertSurface(surface, m_texture->format));
+            surface = converted.get();
+            if (!surface) [[unlikely]]
+            {
+                Remove(rect);
+                return Fail<SDL_Rect>(location);
+            }
+        }
+        if (!SDL_UpdateTexture(m_texture, &rect, surface->pixels, surface->pitch)) [[unlikely]]
+        {
+            Remove(rect);
+            return Fail<SDL_Rect>(location);
+        }
+        return rect;
+    }
+
+    void Remove(const SDL_Rect &rect)
+    {
+        m_packer.Remove({rect.x, rect.y, rect.w + m_padding, rect.h + m_padding});
+    }
+
+    SDL_Texture *Get() const
+    {
+        return m_texture;
+    }
+
+  private:
+    SDL_Texture *m_texture;
+    int m_padding;
+    AtlasPacker m_packer;
+};
+
+// Packs surfaces into an SDL_GPUTexture, which it doesn't own. Insert() converts a surface
+// to the format matching the texture, and stages it. Upload() copies all staged surfaces
+// to the texture during a copy pass. Entries can be used once that copy pass is submitted.
+struct GPUTextureAtlas
+{
+    // format is the SDL_PixelFormat with the layout of the texture's SDL_GPUTextureFormat,
+    // e.g. SDL_PIXELFORMAT_RGBA32 for SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM.
+    GPUTextureAtlas(SDL_GPUDevice *device, SDL_GPUTexture *texture, int width, int height,
+                    SDL_PixelFormat format, int padding = 1)
+        : m_texture{texture}, m_format{format}, m_padding{padding},
+          m_packer{width + padding, height + padding}, m_transferBuffer{device, 0, 256 * 1024} {};
+    GPUTextureAtlas(const GPUTextureAtlas &) = delete;
+
+    GPUTextureAtlas &operator=(const GPUTextureAtlas &) = delete;
+
+    Result<SDL_Rect> Insert(SDL_Surface *surface, Location location = Location::current())
+    {
+        SDL_Rect rect;
+        if (!m_packer.Insert(surface->w + m_padding, surface->h + m_padding, rect)) [[unlikely]]
+        {
+            SDL_SetError("Texture atlas is full");
+            return Fail<SDL_Rect>(location);
+        }
+        rect.w = surface->w;
+        rect.h = surface->h;
+
+        Surface converted;
+        if (surface->format != m_format || SDL_MUSTLOCK(surface))
+        {
+            converted.reset(SDL_ConvertSurface(surface, m_format));
+            surface = converted.get();
+            if (!surface) [[unlikely]]
+            {
+                Remove(rect);
+                return Fail<SDL_Rect>(location);
+            }
+        }
+
+        size_t rowSize = size_t(surface->w) * SDL_BYTESPERPIXEL(m_format);
+        size_t offset = m_staging.size();
+        m_staging.resize(offset + rowSize * surface->h);
+        for (int y = 0; y < surface->h; ++y)
+        {
+            std::memcpy(m_staging.data() + offset + rowSize * y,
+                        static_cast<const Uint8 *>(surface->pixels) + size_t(surface->pitch) * y,
+                        rowSize);
+        }
+        m_pending.push_back({rect, Uint32(offset)});
+        return rect;
+    }
+
+    // Staged entries that haven't been uploaded yet are dropped.
+    void Remove(const SDL_Rect &rect)
+    {
+        for (size_t i = 0; i < m_pending.size(); ++i)
+        {
+            if (m_pending[i].rect.x == rect.x && m_pending[i].rect.y == rect.y)
+            {
+                m_pending.erase(m_pending.begin() + i);
+                break;
+            }
+        }
+        m_packer.Remove({rect.x, rect.y, rect.w + m_padding, rect.h + m_padding});
+    }
+
+    Result<void> Upload(SDL_GPUCopyPass *copyPass, Location location = Location::current())
+    {
+        if (m_pending.empty())
+        {
+            m_staging.clear();
+            return Success();
+        }
+
+        Uint32 size = Uint32(m_staging.size());
+        void *mapped = m_transferBuffer.Map(size);
+        if (!mapped) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        std::memcpy(mapped, m_staging.data(), size);
+        m_transferBuffer.Unmap();
+
+        // Not cycling the texture, as that would discard the entries already in it.
+        for (const Pending &pending : m_pending)
+        {
+            const SDL_Rect &rect = pending.rect;
+            SDL_GPUTextureTransferInfo source{m_transferBuffer.TransferBuffer(), pending.offset,
+                                              Uint32(rect.w), Uint32(rect.h)};
+            SDL_GPUTextureRegion destination{};
+            destination.texture = m_texture;
+            destination.x = Uint32(rect.x);
+            destination.y = Uint32(rect.y);
+            destination.w = Uint32(rect.w);
+            destination.h = Uint32(rect.h);
+            destination.d = 1;
+            SDL_UploadToGPUTexture(copyPass, &source, &destination, false);
+        }
+        m_pending.clear();
+        m_staging.clear();
+        return Success();
+    }
+
+    SDL_GPUTexture *Get() const
+    {
+        return m_texture;
+    }
+
+  private:
+    struct Pending
+    {
+        SDL_Rect rect;
+        Uint32 offset;
+    };
+
+    SDL_GPUTexture *m_texture;
+    SDL_PixelFormat m_format;
+    int m_padding;
+    AtlasPacker m_packer;
+    GPUGrowableBuffer m_transferBuffer;
+    std::vector<Uint8> m_staging;
+    std::vector<Pending> m_pending;
+};
+
+// Batches textured quads into few SDL_RenderGeometryRaw calls. The vertices are kept as
+// separate position, color and texture coordinate arrays, in the layout SDL_RenderGeometryRaw
+// takes. By default sprites are drawn in order, and a batch is rendered whenever the texture
+// changes. With sortByTexture, sprites are grouped by texture until Flush(), which renders
+// one batch per texture, at the cost of sprites of different textures not overlapping in
+// the order they were drawn.
+struct SpriteBatch
+{
+    explicit SpriteBatch(SDL_Renderer *renderer, bool sortByTexture = false)
+        : m_renderer{renderer}, m_sortByTexture{sortByTexture} {};
+
+    // source is in texels, or nullptr for the whole texture.
+    Result<void> Draw(SDL_Texture *texture, const SDL_FRect *source, const SDL_FRect &destination,
+                      SDL_FColor color = {1, 1, 1, 1}, Location location = Location::current())
+    {
+        Batch *batch = FindBatch(texture);
+        if (!batch)
+        {
+            if (!m_sortByTexture && !Render()) [[unlikely]]
+            {
+                return Fail<void>(location);
+            }
+            batch = AddBatch(texture);
+        }
+
+        float u0 = 0;
+        float v0 = 0;
+        float u1 = 1;
+        float v1 = 1;
+        if (source && texture)
+        {
+            u0 = source->x / texture->w;
+            v0 = source->y / texture->h;
+            u1 = (source->x + source->w) / texture->w;
+            v1 = (source->y + source->h) / texture->h;
+        }
+        float x0 = destination.x;
+        float y0 = destination.y;
+        float x1 = destination.x + destination.w;
+        float y1 = destination.y + destination.h;
+        batch->xy.insert(batch->xy.end(), {x0, y0, x1, y0, x1, y1, x0, y1});
+        batch->uv.insert(batch->uv.end(), {u0, v0, u1, v0, u1, v1, u0, v1});
+        batch->colors.insert(batch->colors.end(), {color, color, color, color});
+        return Success();
+    }
+
+    // Renders all sprites drawn so far.
+    Result<void> Flush(Location location = Location::current())
+    {
+        if (!Render()) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        return Success();
+    }
+
+    // Number of SDL_RenderGeometryRaw calls made so far.
+    Uint32 RenderCalls() const
+    {
+        return m_renderCalls;
+    }
+
+  private:
+    struct Batch
+    {
+        SDL_Texture *texture;
+        std::vector<float> xy;
+        std::vector<SDL_FColor> colors;
+        std::vector<float> uv;
+    };
+
+    Batch *FindBatch(SDL_Texture *texture)
+    {
+        if (!m_sortByTexture)
+        {
+            return m_used && m_batches[0].texture == texture ? &m_batches[0] : nullptr;
+        }
+        for (size_t i = 0; i < m_used; ++i)
+        {
+            if (m_batches[i].texture == texture)
+            {
+                return &m_batches[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // Batches are reused, so their arrays keep their capacity from frame to frame.
+    Batch *AddBatch(SDL_Texture *texture)
+    {
+        if (m_used == m_batches.size())
+        {
+            m_batches.emplace_back();
+        }
+        Batch &batch = m_batches[m_used++];
+        batch.texture = texture;
+        batch.xy.clear();
+        batch.colors.clear();
+        batch.uv.clear();
+        return &batch;
+    }
+
+    bool Render()
+    {
+        bool result = true;
+        for (size_t i = 0; i < m_used; ++i)
+        {
+            const Batch &batch = m_batches[i];
+            int numVertices = int(batch.colors.size());
+            int numIndices = numVertices / 4 * 6;
+            // Every batch uses the same quad indices, so they're only ever appended.
+            for (int quad = int(m_indices.size()) / 6; quad < numVertices / 4; ++quad)
+            {
+                int first = quad * 4;
+                m_indices.insert(m_indices.end(),
+                                 {first, first + 1, first + 2, first, first + 2, first + 3});
+            }
+            result &= SDL_RenderGeometryRaw(m_renderer, batch.texture, batch.xy.data(),
+                                            2 * sizeof(float), batch.colors.data(),
+                                            sizeof(SDL_FColor), batch.uv.data(), 2 * sizeof(float),
+                                            numVertices, m_indices.data(), numIndices,
+                                            sizeof(int));
+            ++m_renderCalls;
+        }
+        m_used = 0;
+        return result;
+    }
+
+    SDL_Renderer *m_renderer;
+    bool m_sortByTexture;
+    std::vector<Batch> m_batches;
+    size_t m_used = 0;
+    std::vector<int> m_indices;
+    Uint32 m_renderCalls = 0;
+};
+
+// Collects points, lines and rectangles per color, and renders each kind with one SDL call
+// per color. Lines continuing where the previous line of the same color ended are joined
+// into one SDL_RenderLines polyline. The remaining, independent lines are rendered together
+// as 1 pixel wide quads with one SDL_RenderGeometry, which may differ from SDL_RenderLine by
+// a pixel along diagonal lines. The primitives are kept until Clear(), so the same batch can
+// be rendered again, e.g. with another camera.
+struct PrimitiveBatch
+{
+    void AddPoint(SDL_FPoint point, SDL_FColor color)
+    {
+        Find(color).points.push_back(point);
+    }
+
+    void AddLine(SDL_FPoint from, SDL_FPoint to, SDL_FColor color)
+    {
+        Bucket &bucket = Find(color);
+        if (bucket.lineStarts.empty() || bucket.linePoints.back().x != from.x ||
+            bucket.linePoints.back().y != from.y)
+        {
+            bucket.lineStarts.push_back(int(bucket.linePoints.size()));
+            bucket.linePoints.push_back(from);
+        }
+        bucket.linePoints.push_back(to);
+    }
+
+    void AddRect(const SDL_FRect &rect, SDL_FColor color)
+    {
+        Find(color).rects.push_back(rect);
+    }
+
+    void AddFillRect(const SDL_FRect &rect, SDL_FColor color)
+    {
+        Find(color).fillRects.push_back(rect);
+    }
+
+    // Renders everything at position * zoom + offset, leaving the draw color as it was.
+    Result<void> Render(SDL_Renderer *renderer, float zoom = 1, SDL_FPoint offset = {0, 0},
+                        Location location = Location::current())
+    {
+        const float pointScale[4] = {zoom, zoom, zoom, zoom};
+        const float pointOffset[4] = {offset.x, offset.y, offset.x, offset.y};
+        const float rectOffset[4] = {offset.x, offset.y, 0, 0};
+
+        float r = 0;
+        float g = 0;
+        float b = 0;
+        float a = 1;
+        bool result = SDL_GetRenderDrawColorFloat(renderer, &r, &g, &b, &a);
+        m_renderCalls = 0;
+        for (const Bucket &bucket : m_buckets)
+        {
+            const SDL_FColor &color = bucket.color;
+            result &= SDL_SetRenderDrawColorFloat(renderer, color.r, color.g, color.b, color.a);
+            if (!bucket.points.empty())
+            {
+                Transform(bucket.points, m_points, pointScale, pointOffset);
+                result &= SDL_RenderPoints(renderer, m_points.data(), int(m_points.size()));
+                ++m_renderCalls;
+            }
+            if (!bucket.linePoints.empty())
+            {
+                Transform(bucket.linePoints, m_points, pointScale, pointOffset);
+                m_vertices.clear();
+                m_indices.clear();
+                for (size_t i = 0; i < bucket.lineStarts.size(); ++i)
+                {
+                    int start = bucket.lineStarts[i];
+                    int end = i + 1 < bucket.lineStarts.size() ? bucket.lineStarts[i + 1]
+                                                               : int(m_points.size());
+                    if (end - start == 2)
+                    {
+                        AddLineQuad(m_points[start], m_points[start + 1], color);
+                    }
+                    else
+                    {
+                        result &= SDL_RenderLines(renderer, m_points.data() + start, end - start);
+                        ++m_renderCalls;
+                    }
+                }
+                if (!m_vertices.empty())
+                {
+                    result &= SDL_RenderGeometry(renderer, nullptr, m_vertices.data(),
+                                                 int(m_vertices.size()), m_indices.data(),
+                                                 int(m_indices.size()));
+                    ++m_renderCalls;
+                }
+            }
+            if (!bucket.rects.empty())
+            {
+                Transform(bucket.rects, m_rects, pointScale, rectOffset);
+                result &= SDL_RenderRects(renderer, m_rects.data(), int(m_rects.size()));
+                ++m_renderCalls;
+            }
+            if (!bucket.fillRects.empty())
+            {
+                Transform(bucket.fillRects, m_rects, pointScale, rectOffset);
+                result &= SDL_RenderFillRects(renderer, m_rects.data(), int(m_rects.size()));
+                ++m_renderCalls;
+            }
+        }
+        SDL_SetRenderDrawColorFloat(renderer, r, g, b, a);
+        if (!result) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        return Success();
+    }
+
+    // Number of SDL render calls the last Render() made.
+    Uint32 RenderCalls() const
+    {
+        return m_renderCalls;
+    }
+
+    // Removes all primitives, keeping the memory for the next ones.
+    void Clear()
+    {
+        for (Bucket &bucket : m_buckets)
+        {
+            bucket.points.clear();
+            bucket.linePoints.clear();
+            bucket.lineStarts.clear();
+            bucket.rects.clear();
+            bucket.fillRects.clear();
+        }
+    }
+
+  private:
+    struct Bucket
+    {
+        SDL_FColor color;
+        std::vector<SDL_FPoint> points;
+        std::vector<SDL_FPoint> linePoints;
+        std::vector<int> lineStarts;
+        std::vector<SDL_FRect> rects;
+        std::vector<SDL_FRect> fillRects;
+    };
+
+    Bucket &Find(SDL_FColor color)
+    {
+        for (Bucket &bucket : m_buckets)
+        {
+            if (bucket.color.r == color.r && bucket.color.g == color.g &&
+                bucket.color.b == color.b && bucket.color.a == color.a)
+            {
+                return bucket;
+            }
+        }
+        m_buckets.emplace_back();
+        m_buckets.back().color = color;
+        return m_buckets.back();
+    }
+
+    // Adds a quad covering the pixels of the line from a to b: 1 pixel wide around the pixel
+    // centers, and reaching half a pixel past both ends, as SDL_RenderLine draws both ends.
+    void AddLineQuad(SDL_FPoint a, SDL_FPoint b, SDL_FColor color)
+    {
+        float dx = b.x - a.x;
+        float dy = b.y - a.y;
+        float length = SDL_sqrtf(dx * dx + dy * dy);
+        if (length > 0)
+        {
+            dx *= 0.5f / length;
+            dy *= 0.5f / length;
+        }
+        else
+        {
+            dx = 0.5f;
+        }
+        float ax = a.x + 0.5f - dx;
+        float ay = a.y + 0.5f - dy;
+        float bx = b.x + 0.5f + dx;
+        float by = b.y + 0.5f + dy;
+        int first = int(m_vertices.size());
+        m_vertices.push_back({{ax - dy, ay + dx}, color, {0, 0}});
+        m_vertices.push_back({{ax + dy, ay - dx}, color, {0, 0}});
+        m_vertices.push_back({{bx + dy, by - dx}, color, {0, 0}});
+        m_vertices.push_back({{bx - dy, by + dx}, color, {0, 0}});
+        for (int index : {0, 1, 2, 0, 2, 3})
+        {
+            m_indices.push_back(first + index);
+        }
+    }
+
+    // Copies the floats of source to destination as source * scale + offset, with scale and
+    // offset repeating every 4 floats.
+    template <class T>
+    static void Transform(const std::vector<T> &source, std::vector<T> &destination,
+                          const float (&scale)[4], const float (&offset)[4])
+    {
+        destination.resize(source.size());
+        const float *from = reinterpret_cast<const float *>(source.data());
+        float *to = reinterpret_cast<float *>(destination.data());
+        size_t count = source.size() * sizeof(T) / sizeof(float);
+        size_t i = 0;
+#if defined(SDL_SSE_INTRINSICS)
+        __m128 scale4 = _mm_loadu_ps(scale);
+        __m128 offset4 = _mm_loadu_ps(offset);
+        for (; i + 4 <= count; i += 4)
+        {
+            _mm_storeu_ps(to + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(from + i), scale4), offset4));
+        }
+#elif defined(SDL_NEON_INTRINSICS)
+        float32x4_t scale4 = vld1q_f32(scale);
+        float32x4_t offset4 = vld1q_f32(offset);
+        for (; i + 4 <= count; i += 4)
+        {
+            vst1q_f32(to + i, vmlaq_f32(offset4, vld1q_f32(from + i), scale4));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            to[i] = from[i] * scale[i % 4] + offset[i % 4];
+        }
+    }
+
+    std::vector<Bucket> m_buckets;
+    std::vector<SDL_FPoint> m_points;
+    std::vector<SDL_FRect> m_rects;
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices;
+    Uint32 m_renderCalls = 0;
+};
+
+// Pixel conversion and blending kernels for common format pairs, in SSE2, AVX2 and NEON
+// variants. Get() picks the fastest variant the CPU supports the first time it's called.
+// The kernels work on little endian 32-bit pixels, with alpha in the top byte.
+struct PixelKernels
+{
+    // Swaps the red and blue channels, e.g. ARGB8888 <-> ABGR8888.
+    void (*swapRedBlue)(const Uint32 *source, Uint32 *destination, size_t count);
+    // RGB24 to XRGB8888, or BGR24 to XBGR8888, setting the top byte to 255.
+    void (*expand24To32)(const Uint8 *source, Uint32 *destination, size_t count);
+    // Blends like SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+    // destination = source + destination * (255 - source alpha) / 255, per channel.
+    void (*blendPremultiplied)(const Uint32 *source, Uint32 *destination, size_t count);
+    const char *name;
+
+    static const PixelKernels &Get()
+    {
+        static const PixelKernels kernels = Variants().back();
+        return kernels;
+    }
+
+    // The scalar kernels, followed by each SIMD variant the CPU supports, from slowest to
+    // fastest, e.g. to test them against each other. Variants without a kernel of their own
+    // use the one of the variant before.
+    static std::vector<PixelKernels> Variants()
+    {
+        std::vector<PixelKernels> variants{
+            {SwapRedBlue, Expand24To32, BlendPremultiplied, "scalar"}};
+#if defined(SDL_SSE2_INTRINSICS)
+        if (SDL_HasSSE2())
+        {
+            variants.push_back({SwapRedBlueSSE2, Expand24To32, BlendPremultipliedSSE2, "SSE2"});
+        }
+#endif
+#if defined(SDL_AVX2_INTRINSICS)
+        if (SDL_HasAVX2())
+        {
+            variants.push_back(
+                {SwapRedBlueAVX2, Expand24To32AVX2, BlendPremultipliedAVX2, "AVX2"});
+        }
+#endif
+#if defined(SDL_NEON_INTRINSICS)
+        if (SDL_HasNEON())
+        {
+            variants.push_back(
+                {SwapRedBlueNEON, Expand24To32NEON, BlendPremultipliedNEON, "NEON"});
+        }
+#endif
+        return variants;
+    }
+
+    // Converts the pixels like SDL_ConvertPixels, with the kernels if they cover the formats.
+    bool Convert(int width, int height, SDL_PixelFormat srcFormat, const void *src,
+                 int srcPitch, SDL_PixelFormat dstFormat, void *dst, int dstPitch) const
+    {
+        auto is = [&](SDL_PixelFormat from, SDL_PixelFormat to) {
+            return SDL_BYTEORDER == SDL_LIL_ENDIAN && srcFormat == from && dstFormat == to;
+        };
+        const Uint8 *source = static_cast<const Uint8 *>(src);
+        Uint8 *destination = static_cast<Uint8 *>(dst);
+
+        if (is(SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888) ||
+            is(SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888) ||
+            is(SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888) ||
+            is(SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888))
+        {
+            for (int y = 0; y < height; ++y, source += srcPitch, destination += dstPitch)
+            {
+                swapRedBlue(reinterpret_cast<const Uint32 *>(source),
+                                    reinterpret_cast<Uint32 *>(destination), size_t(width));
+            }
+            return true;
+        }
+        if (is(SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_XRGB8888) ||
+            is(SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888) ||
+            is(SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_XBGR8888) ||
+            is(SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_ABGR8888))
+        {
+            for (int y = 0; y < height; ++y, source += srcPitch, destination += dstPitch)
+            {
+                expand24To32(source, reinterpret_cast<Uint32 *>(destination), size_t(width));
+            }
+            return true;
+        }
+        return SDL_ConvertPixels(width, height, srcFormat, src, srcPitch, dstFormat, dst,
+                                 dstPitch);
+    }
+
+    // Whether blitting src to dst with SDL_BLENDMODE_BLEND_PREMULTIPLIED can use
+    // blendPremultiplied: both surfaces are ARGB8888, or both ABGR8888, and src has no color
+    // key and no color or alpha modulation.
+    static bool CanBlend(SDL_Surface *src, SDL_Surface *dst)
+    {
+        Uint8 r = 0;
+        Uint8 g = 0;
+        Uint8 b = 0;
+        Uint8 a = 0;
+        return SDL_BYTEORDER == SDL_LIL_ENDIAN && src != dst && src->format == dst->format &&
+               (src->format == SDL_PIXELFORMAT_ARGB8888 ||
+                src->format == SDL_PIXELFORMAT_ABGR8888) &&
+               !SDL_MUSTLOCK(src) && !SDL_MUSTLOCK(dst) && !SDL_SurfaceHasColorKey(src) &&
+               SDL_GetSurfaceColorMod(src, &r, &g, &b) && SDL_GetSurfaceAlphaMod(src, &a) &&
+               (r & g & b & a) == 255;
+    }
+
+    // Blends the pixels of source onto destination, which must be of the same size.
+    void Blend(SDL_Surface *src, const SDL_Rect &source, SDL_Surface *dst,
+               const SDL_Rect &destination) const
+    {
+        for (int row = 0; row < source.h; ++row)
+        {
+            const Uint8 *from = static_cast<const Uint8 *>(src->pixels) +
+                                size_t(source.y + row) * src->pitch + size_t(source.x) * 4;
+            Uint8 *to = static_cast<Uint8 *>(dst->pixels) +
+                        size_t(destination.y + row) * dst->pitch + size_t(destination.x) * 4;
+            blendPremultiplied(reinterpret_cast<const Uint32 *>(from),
+                               reinterpret_cast<Uint32 *>(to), size_t(source.w));
+        }
+    }
+
+  private:
+    // The scalar kernels also finish the pixels left over by the SIMD ones.
+    static void SwapRedBlue(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            Uint32 pixel = source[i];
+            destination[i] =
+                (pixel & 0xFF00FF00) | ((pixel >> 16) & 0xFF) | ((pixel & 0xFF) << 16);
+        }
+    }
+
+    static void Expand24To32(const Uint8 *source, Uint32 *destination, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i, source += 3)
+        {
+            destination[i] =
+                0xFF000000 | (Uint32(source[0]) << 16) | (Uint32(source[1]) << 8) | source[2];
+        }
+    }
+
+    // Divides by 255 the way SDL's blitters do.
+    static Uint32 MultiplyDivide255(Uint32 a, Uint32 b)
+    {
+        Uint32 x = a * b + 1;
+        return (x + (x >> 8)) >> 8;
+    }
+
+    static void BlendPremultiplied(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            Uint32 s = source[i];
+            Uint32 d = destination[i];
+            Uint32 inverseAlpha = 255 - (s >> 24);
+            Uint32 result = 0;
+            for (int shift = 0; shift < 32; shift += 8)
+            {
+                Uint32 channel = ((s >> shift) & 0xFF) +
+                                 MultiplyDivide255((d >> shift) & 0xFF, inverseAlpha);
+                result |= (channel < 255 ? channel : 255) << shift;
+            }
+            destination[i] = result;
+        }
+    }
+
+#if defined(SDL_SSE2_INTRINSICS)
+    SDL_TARGETING("sse2")
+    static void SwapRedBlueSSE2(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        const __m128i greenAlpha = _mm_set1_epi32(int(0xFF00FF00));
+        const __m128i low = _mm_set1_epi32(0xFF);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+            __m128i red = _mm_and_si128(_mm_srli_epi32(pixels, 16), low);
+            __m128i blue = _mm_slli_epi32(_mm_and_si128(pixels, low), 16);
+            pixels = _mm_or_si128(_mm_and_si128(pixels, greenAlpha), _mm_or_si128(red, blue));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i), pixels);
+        }
+        SwapRedBlue(source + i, destination + i, count - i);
+    }
+
+    SDL_TARGETING("sse2")
+    static void BlendPremultipliedSSE2(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi16(1);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+            __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(destination + i));
+            // Source alpha in every byte of its pixel, inverted.
+            __m128i alpha = _mm_srli_epi32(s, 24);
+            alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 8));
+            alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+            __m128i inverse = _mm_xor_si128(alpha, _mm_set1_epi32(-1));
+
+            __m128i halves[2];
+            for (int half = 0; half < 2; ++half)
+            {
+                __m128i d16 = half ? _mm_unpackhi_epi8(d, zero) : _mm_unpacklo_epi8(d, zero);
+                __m128i a16 = half ? _mm_unpackhi_epi8(inverse, zero)
+                                   : _mm_unpacklo_epi8(inverse, zero);
+                __m128i x = _mm_add_epi16(_mm_mullo_epi16(d16, a16), one);
+                halves[half] = _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+            }
+            __m128i blended = _mm_adds_epu8(s, _mm_packus_epi16(halves[0], halves[1]));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i), blended);
+        }
+        BlendPremultiplied(source + i, destination + i, count - i);
+    }
+#endif
+
+#if defined(SDL_AVX2_INTRINSICS)
+    SDL_TARGETING("avx2")
+    static void SwapRedBlueAVX2(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13,
+                                                 12, 15, 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11,
+                                                 14, 13, 12, 15);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+            pixels = _mm256_shuffle_epi8(pixels, shuffle);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), pixels);
+        }
+        SwapRedBlue(source + i, destination + i, count - i);
+    }
+
+    SDL_TARGETING("avx2")
+    static void Expand24To32AVX2(const Uint8 *source, Uint32 *destination, size_t count)
+    {
+        const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10,
+                                                 9, -1, 2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1,
+                                                 11, 10, 9, -1);
+        const __m256i alpha = _mm256_set1_epi32(int(0xFF000000));
+        size_t i = 0;
+        // Each 16-byte load uses 12 bytes, so stop early enough not to read past the end.
+        for (; i + 10 <= count; i += 8)
+        {
+            const Uint8 *pixels = source + i * 3;
+            __m256i loaded = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels + 12)), 1);
+            __m256i expanded = _mm256_or_si256(_mm256_shuffle_epi8(loaded, shuffle), alpha);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), expanded);
+        }
+        Expand24To32(source + i * 3, destination + i, count - i);
+    }
+
+    SDL_TARGETING("avx2")
+    static void BlendPremultipliedAVX2(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i one = _mm256_set1_epi16(1);
+        const __m256i broadcastAlpha = _mm256_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11,
+                                                        15, 15, 15, 15, 3, 3, 3, 3, 7, 7, 7, 7,
+                                                        11, 11, 11, 11, 15, 15, 15, 15);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+            __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(destination + i));
+            __m256i inverse = _mm256_xor_si256(_mm256_shuffle_epi8(s, broadcastAlpha),
+                                               _mm256_set1_epi32(-1));
+
+            __m256i halves[2];
+            for (int half = 0; half < 2; ++half)
+            {
+                __m256i d16 = half ? _mm256_unpackhi_epi8(d, zero) : _mm256_unpacklo_epi8(d, zero);
+                __m256i a16 = half ? _mm256_unpackhi_epi8(inverse, zero)
+                                   : _mm256_unpacklo_epi8(inverse, zero);
+                __m256i x = _mm256_add_epi16(_mm256_mullo_epi16(d16, a16), one);
+                halves[half] = _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+            }
+            __m256i blended = _mm256_adds_epu8(s, _mm256_packus_epi16(halves[0], halves[1]));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), blended);
+        }
+        BlendPremultiplied(source + i, destination + i, count - i);
+    }
+#endif
+
+#if defined(SDL_NEON_INTRINSICS)
+    static void SwapRedBlueNEON(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x16x4_t pixels = vld4q_u8(reinterpret_cast<const Uint8 *>(source + i));
+            uint8x16_t blue = pixels.val[0];
+            pixels.val[0] = pixels.val[2];
+            pixels.val[2] = blue;
+            vst4q_u8(reinterpret_cast<Uint8 *>(destination + i), pixels);
+        }
+        SwapRedBlue(source + i, destination + i, count - i);
+    }
+
+    static void Expand24To32NEON(const Uint8 *source, Uint32 *destination, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x16x3_t pixels = vld3q_u8(source + i * 3);
+            uint8x16x4_t expanded;
+            expanded.val[0] = pixels.val[2];
+            expanded.val[1] = pixels.val[1];
+            expanded.val[2] = pixels.val[0];
+            expanded.val[3] = vdupq_n_u8(255);
+            vst4q_u8(reinterpret_cast<Uint8 *>(destination + i), expanded);
+        }
+        Expand24To32(source + i * 3, destination + i, count - i);
+    }
+
+    static void BlendPremultipliedNEON(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        const uint16x8_t one = vdupq_n_u16(1);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            uint8x8x4_t s = vld4_u8(reinterpret_cast<const Uint8 *>(source + i));
+            uint8x8x4_t d = vld4_u8(reinterpret_cast<const Uint8 *>(destination + i));
+            uint8x8_t inverse = vmvn_u8(s.val[3]);
+            for (int channel = 0; channel < 4; ++channel)
+            {
+                uint16x8_t x = vaddq_u16(vmull_u8(d.val[channel], inverse), one);
+                x = vaddq_u16(x, vshrq_n_u16(x, 8));
+                d.val[channel] = vqadd_u8(s.val[channel], vshrn_n_u16(x, 8));
+            }
+            vst4_u8(reinterpret_cast<Uint8 *>(destination + i), d);
+        }
+        BlendPremultiplied(source + i, destination + i, count - i);
+    }
+#endif
+};
+
+// Like SDL_ConvertPixels, using PixelKernels for ARGB8888 <-> ABGR8888, XRGB8888 <-> XBGR8888,
+// RGB24 to XRGB8888/ARGB8888 and BGR24 to XBGR8888/ABGR8888.
+inline Result<void> ConvertPixelsSIMD(int width, int height, SDL_PixelFormat srcFormat,
+                                      const void *src, int srcPitch, SDL_PixelFormat dstFormat,
+                                      void *dst, int dstPitch,
+                                      Location location = Location::current())
+{
+    bool converted = PixelKernels::Get().Convert(width, height, srcFormat, src, srcPitch,
+                                                 dstFormat, dst, dstPitch);
+    if (!converted) [[unlikely]]
+    {
+        return Fail<void>(location);
+    }
+    return Success();
+}
+
+// Clips blitting srcRect, or all of src, to (x, y) like SDL_BlitSurface: to src, then to the
+// clip rectangle of dst. Returns false if nothing is left to blit.
+inline bool ClipBlit(SDL_Surface *src, const SDL_Rect *srcRect, SDL_Surface *dst, int x, int y,
+                     SDL_Rect &source, SDL_Rect &destination)
+{
+    source = srcRect ? *srcRect : SDL_Rect{0, 0, src->w, src->h};
+    SDL_Rect bounds{0, 0, src->w, src->h};
+    SDL_Rect clipped;
+    if (!SDL_GetRectIntersection(&source, &bounds, &clipped))
+    {
+        return false;
+    }
+    destination = {x + clipped.x - source.x, y + clipped.y - source.y, clipped.w, clipped.h};
+    source = clipped;
+    SDL_GetSurfaceClipRect(dst, &bounds);
+    if (!SDL_GetRectIntersection(&destination, &bounds, &clipped))
+    {
+        return false;
+    }
+    source = {source.x + clipped.x - destination.x, source.y + clipped.y - destination.y,
+              clipped.w, clipped.h};
+    destination = clipped;
+    return true;
+}
+
+// Like SDL_BlitSurface with src in SDL_BLENDMODE_BLEND_PREMULTIPLIED, blitting to (x, y).
+// Uses PixelKernels when PixelKernels::CanBlend().
+inline Result<void> BlitSurfacePremultiplied(SDL_Surface *src, const SDL_Rect *srcRect,
+                                             SDL_Surface *dst, int x, int y,
+                                             Location location = Location::current())
+{
+    if (!PixelKernels::CanBlend(src, dst))
+    {
+        SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+        SDL_GetSurfaceBlendMode(src, &mode);
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        SDL_Rect dstRect{x, y, 0, 0};
+        bool result = SDL_BlitSurface(src, srcRect, dst, &dstRect);
+        SDL_SetSurfaceBlendMode(src, mode);
+        if (!result) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        return Success();
+    }
+
+    SDL_Rect source;
+    SDL_Rect destination;
+    if (ClipBlit(src, srcRect, dst, x, y, source, destination))
+    {
+        PixelKernels::Get().Blend(src, source, dst, destination);
+    }
+    return Success();
+}
+
+// Copies the blend mode and the color and alpha mods of from to to.
+inline void CopySurfaceBlending(SDL_Surface *from, SDL_Surface *to)
+{
+    SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+    Uint8 r = 255;
+    Uint8 g = 255;
+    Uint8 b = 255;
+    Uint8 a = 255;
+    SDL_GetSurfaceBlendMode(from, &mode);
+    SDL_GetSurfaceColorMod(from, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(from, &a);
+    SDL_SetSurfaceBlendMode(to, mode);
+    SDL_SetSurfaceColorMod(to, r, g, b);
+    SDL_SetSurfaceAlphaMod(to, a);
+}
+
+// Blits source of src unscaled to destination of dst, of the same size, in bands of
+// destination rows on pool. Blitting changes the blit maps of both surfaces, so each band blits
+// between surfaces of its own over the same pixels, with the blend mode, color and alpha mods
+// and color key of src. Used by the parallel surface functions below.
+inline bool BlitSurfaceBands(WorkerPool &pool, SDL_Surface *src, const SDL_Rect &source,
+                             SDL_Surface *dst, const SDL_Rect &destination)
+{
+    SDL_Rect clip;
+    SDL_GetSurfaceClipRect(dst, &clip);
+    int top = SDL_max(destination.y, clip.y);
+    int bottom = SDL_min(destination.y + destination.h, clip.y + clip.h);
+    if (bottom <= top)
+    {
+        return true;
+    }
+
+    // Read once here rather than from every band.
+    SDL_Colorspace srcColorspace = SDL_GetSurfaceColorspace(src);
+    SDL_Colorspace dstColorspace = SDL_GetSurfaceColorspace(dst);
+    SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+    Uint8 r = 255;
+    Uint8 g = 255;
+    Uint8 b = 255;
+    Uint8 a = 255;
+    Uint32 key = 0;
+    SDL_GetSurfaceBlendMode(src, &mode);
+    SDL_GetSurfaceColorMod(src, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(src, &a);
+    bool hasKey = SDL_SurfaceHasColorKey(src) && SDL_GetSurfaceColorKey(src, &key);
+
+    return pool.RunBands(bottom - top, dst->pitch, [&](int firstRow, int numRows) {
+        Uint8 *pixels = static_cast<Uint8 *>(dst->pixels) + size_t(top + firstRow) * dst->pitch;
+        Surface from{SDL_CreateSurfaceFrom(src->w, src->h, src->format, src->pixels, src->pitch)};
+        Surface to{SDL_CreateSurfaceFrom(dst->w, numRows, dst->format, pixels, dst->pitch)};
+        if (!from || !to) [[unlikely]]
+        {
+            return false;
+        }
+        SDL_SetSurfaceColorspace(from.get(), srcColorspace);
+        SDL_SetSurfaceColorspace(to.get(), dstColorspace);
+        SDL_SetSurfaceBlendMode(from.get(), mode);
+        SDL_SetSurfaceColorMod(from.get(), r, g, b);
+        SDL_SetSurfaceAlphaMod(from.get(), a);
+        if (hasKey)
+        {
+            SDL_SetSurfaceColorKey(from.get(), true, key);
+        }
+        SDL_Rect bandClip{clip.x, 0, clip.w, numRows};
+        SDL_SetSurfaceClipRect(to.get(), &bandClip);
+        SDL_Rect rect = destination;
+        rect.y -= top + firstRow;
+        return SDL_BlitSurface(from.get(), &source, to.get(), &rect);
+    });
+}
+
+// Like SDL_ConvertSurface, converting in bands of rows on pool with PixelKernels.
+// Surfaces SDL_ConvertPixels can't convert on its own, like indexed, RLE, color keyed or
+// non-sRGB ones, are converted on this thread.
+inline Result<Surface> ConvertSurfaceParallel(WorkerPool &pool, SDL_Surface *surface,
+                                              SDL_PixelFormat format,
+                                              Location location = Location::current())
+{
+    Surface converted;
+    if (SDL_MUSTLOCK(surface) || SDL_ISPIXELFORMAT_INDEXED(surface->format) ||
+        SDL_ISPIXELFORMAT_INDEXED(format) || SDL_ISPIXELFORMAT_FOURCC(surface->format) ||
+        SDL_ISPIXELFORMAT_FOURCC(format) || SDL_SurfaceHasColorKey(surface) ||
+        SDL_GetSurfaceColorspace(surface) != SDL_COLORSPACE_SRGB)
+    {
+        converted.reset(SDL_ConvertSurface(surface, format));
+        if (!converted) [[unlikely]]
+        {
+            return Fail<Surface>(location);
+        }
+        return converted;
+    }
+
+    converted.reset(SDL_CreateSurface(surface->w, surface->h, format));
+    if (!converted) [[unlikely]]
+    {
+        return Fail<Surface>(location);
+    }
+    SDL_Surface *dst = converted.get();
+    bool result = pool.RunBands(surface->h, dst->pitch, [&](int firstRow, int numRows) {
+        const Uint8 *from =
+            static_cast<const Uint8 *>(surface->pixels) + size_t(firstRow) * surface->pitch;
+        Uint8 *to = static_cast<Uint8 *>(dst->pixels) + size_t(firstRow) * dst->pitch;
+        return PixelKernels::Get().Convert(surface->w, numRows, surface->format, from,
+                                           surface->pitch, format, to, dst->pitch);
+    });
+    if (!result) [[unlikely]]
+    {
+        return Fail<Surface>(location);
+    }
+    CopySurfaceBlending(surface, dst);
+    return converted;
+}
+
+// Like BlitSurfacePremultiplied, blending in bands of rows on pool.
+inline Result<void> BlitSurfacePremultipliedParallel(WorkerPool &pool, SDL_Surface *src,
+                                                     const SDL_Rect *srcRect, SDL_Surface *dst,
+                                                     int x, int y,
+                                                     Location location = Location::current())
+{
+    if (src == dst || SDL_MUSTLOCK(src) || SDL_MUSTLOCK(dst) ||
+        SDL_ISPIXELFORMAT_INDEXED(src->format) || SDL_ISPIXELFORMAT_INDEXED(dst->format))
+    {
+        return BlitSurfacePremultiplied(src, srcRect, dst, x, y, location);
+    }
+
+    SDL_Rect source;
+    SDL_Rect destination;
+    if (!ClipBlit(src, srcRect, dst, x, y, source, destination))
+    {
+        return Success();
+    }
+
+    if (PixelKernels::CanBlend(src, dst))
+    {
+        const PixelKernels &kernels = PixelKernels::Get();
+        pool.RunBands(source.h, dst->pitch, [&](int firstRow, int numRows) {
+            SDL_Rect from{source.x, source.y + firstRow, source.w, numRows};
+            SDL_Rect to{destination.x, destination.y + firstRow, destination.w, numRows};
+            kernels.Blend(src, from, dst, to);
+            return true;
+        });
+        return Success();
+    }
+
+    SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+    SDL_GetSurfaceBlendMode(src, &mode);
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    bool result = BlitSurfaceBands(pool, src, source, dst, destination);
+    SDL_SetSurfaceBlendMode(src, mode);
+    if (!result) [[unlikely]]
+    {
+        return Fail<void>(location);
+    }
+    return Success();
+}
+
+// A typed view of the pixels of a surface whose format is known at compile time, unlike
+// ReadSurfacePixel and WriteSurfacePixel, which look up the format for every pixel. Keeps the
+// surface locked while it exists. A row is a span of Pixel, and iterating the view yields the
+// rows, so per-pixel loops compile down to plain (and vectorisable) array accesses.
+// Formats of 1, 2 or 4 bytes per pixel are supported; Pixel holds the packed pixel.
+template <SDL_PixelFormat Format> struct PixelView
+{
+    // The macros test the format in a boolean context, which warns for an enum constant.
+    static constexpr int BytesPerPixel = SDL_BYTESPERPIXEL(Uint32(Format));
+
+    // SDL_BYTESPERPIXEL is 1 or 2 for FOURCC formats, which aren't arrays of pixels.
+    static_assert(!SDL_ISPIXELFORMAT_FOURCC(Uint32(Format)),
+                  "PixelView needs a packed or array format");
+    static_assert(BytesPerPixel == 1 || BytesPerPixel == 2 || BytesPerPixel == 4,
+                  "PixelView needs a format of 1, 2 or 4 bytes per pixel");
+
+    using Pixel = std::conditional_t<BytesPerPixel == 1, Uint8,
+                                     std::conditional_t<BytesPerPixel == 2, Uint16, Uint32>>;
+
+    struct RowIterator
+    {
+        using value_type = std::span<Pixel>;
+        using difference_type = std::ptrdiff_t;
+
+        std::span<Pixel> operator*() const
+        {
+            return {reinterpret_cast<Pixel *>(row), size_t(width)};
+        }
+
+        RowIterator &operator++()
+        {
+            row += pitch;
+            return *this;
+        }
+
+        RowIterator operator++(int)
+        {
+            RowIterator previous = *this;
+            row += pitch;
+            return previous;
+        }
+
+        bool operator==(const RowIterator &other) const
+        {
+            return row == other.row;
+        }
+
+        Uint8 *row = nullptr;
+        int width = 0;
+        int pitch = 0;
+    };
+
+    // Locks surface, which must be in Format, until the returned view is destroyed.
+    static Result<PixelView> Lock(SDL_Surface *surface, Location location = Location::current())
+    {
+        if (surface->format != Format) [[unlikely]]
+        {
+            SDL_SetError("PixelView of %s on a surface in %s", SDL_GetPixelFormatName(Format),
+                         SDL_GetPixelFormatName(surface->format));
+            return Fail<PixelView>(location);
+        }
+        if (!SDL_LockSurface(surface)) [[unlikely]]
+        {
+            return Fail<PixelView>(location);
+        }
+        return PixelView{surface};
+    }
+
+    // An empty view, as returned by a failing Lock() with SDL_HPP_ERROR_CALLBACK.
+    PixelView() {};
+    PixelView(const PixelView &) = delete;
+
+    PixelView &operator=(const PixelView &) = delete;
+
+    PixelView(PixelView &&other) noexcept : m_surface{other.m_surface}
+    {
+        other.m_surface = nullptr;
+    }
+
+    PixelView &operator=(PixelView &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Unlock();
+            m_surface = other.m_surface;
+            other.m_surface = nullptr;
+        }
+        return *this;
+    }
+
+    ~PixelView()
+    {
+        Unlock();
+    }
+
+    void Unlock()
+    {
+        if (m_surface)
+        {
+            SDL_UnlockSurface(m_surface);
+            m_surface = nullptr;
+        }
+    }
+
+    explicit operator bool() const
+    {
+        return m_surface != nullptr;
+    }
+
+    int Width() const
+    {
+        return m_surface ? m_surface->w : 0;
+    }
+
+    int Height() const
+    {
+        return m_surface ? m_surface->h : 0;
+    }
+
+    std::span<Pixel> Row(int y) const
+    {
+        return *RowIterator{RowPointer(y), m_surface->w, m_surface->pitch};
+    }
+
+    std::span<Pixel> operator[](int y) const
+    {
+        return Row(y);
+    }
+
+    Pixel &At(int x, int y) const
+    {
+        return reinterpret_cast<Pixel *>(RowPointer(y))[x];
+    }
+
+    // All pixels as one span if the rows are contiguous in memory, an empty span otherwise.
+    std::span<Pixel> Pixels() const
+    {
+        if (!m_surface || m_surface->pitch != m_surface->w * BytesPerPixel)
+        {
+            return {};
+        }
+        return {static_cast<Pixel *>(m_surface->pixels), size_t(m_surface->w) * m_surface->h};
+    }
+
+    RowIterator begin() const
+    {
+        return m_surface ? RowIterator{RowPointer(0), m_surface->w, m_surface->pitch}
+                         : RowIterator{};
+    }
+
+    RowIterator end() const
+    {
+        return m_surface ? RowIterator{RowPointer(m_surface->h), m_surface->w, m_surface->pitch}
+                         : RowIterator{};
+    }
+
+  private:
+    explicit PixelView(SDL_Surface *surface) : m_surface{surface} {};
+
+    Uint8 *RowPointer(int y) const
+    {
+        return static_cast<Uint8 *>(m_surface->pixels) + ptrdiff_t(y) * m_surface->pitch;
+    }
+
+    SDL_Surface *m_surface = nullptr;
+};
+
+// Expands a channel of the given bits to 8 bits, rounding like SDL does.
+template <int Bits> constexpr Uint8 ExpandPixelChannel(Uint32 value)
+{
+    constexpr Uint32 max = (1u << Bits) - 1;
+    return Uint8((value * 255 + max / 2) / max);
+}
+
+// Like SDL_MapRGBA, for a packed Format known at compile time (see PixelFormatTraits).
+// Compiles down to shifts and masks, which vectorise in loops over arrays of pixels.
+template <SDL_PixelFormat Format> constexpr Uint32 MapRGBA(Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    using Traits = PixelFormatTraits<Format>;
+    return (Uint32(r) >> (8 - Traits::RBits) << Traits::RShift) |
+           (Uint32(g) >> (8 - Traits::GBits) << Traits::GShift) |
+           (Uint32(b) >> (8 - Traits::BBits) << Traits::BShift) |
+           (Uint32(a) >> (8 - Traits::ABits) << Traits::AShift);
+}
+
+template <SDL_PixelFormat Format> constexpr Uint32 MapRGB(Uint8 r, Uint8 g, Uint8 b)
+{
+    return MapRGBA<Format>(r, g, b, 255);
+}
+
+// Like SDL_GetRGBA, for a packed Format known at compile time. Formats without alpha give 255.
+template <SDL_PixelFormat Format>
+constexpr void GetRGBA(Uint32 pixel, Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a)
+{
+    using Traits = PixelFormatTraits<Format>;
+    *r = ExpandPixelChannel<Traits::RBits>((pixel & Traits::RMask) >> Traits::RShift);
+    *g = ExpandPixelChannel<Traits::GBits>((pixel & Traits::GMask) >> Traits::GShift);
+    *b = ExpandPixelChannel<Traits::BBits>((pixel & Traits::BMask) >> Traits::BShift);
+    if constexpr (Traits::ABits > 0)
+    {
+        *a = ExpandPixelChannel<Traits::ABits>((pixel & Traits::AMask) >> Traits::AShift);
+    }
+    else
+    {
+        *a = 255;
+    }
+}
+
+template <SDL_PixelFormat Format>
+constexpr void GetRGB(Uint32 pixel, Uint8 *r, Uint8 *g, Uint8 *b)
+{
+    Uint8 a = 0;
+    GetRGBA<Format>(pixel, r, g, b, &a);
+}
+
+// Recycles the pixels of surfaces of the same size, format and pitch, so that paths creating
+// and destroying same-sized surfaces every frame, like frame capture, stop allocating pixels
+// once warmed up. Rows and pixels are aligned to SDL_GetSIMDAlignment(). The pool must outlive
+// its surfaces, and nothing may keep a surface (through its refcount) past its PooledSurface.
+struct SurfacePool
+{
+    // Destroys a surface and hands its pixels back to the pool.
+    struct Recycler
+    {
+        void operator()(SDL_Surface *surface) const
+        {
+            pool->Recycle(surface);
+        }
+
+        SurfacePool *pool = nullptr;
+    };
+
+    using PooledSurface = std::unique_ptr<SDL_Surface, Recycler>;
+
+    // Keeps up to maxIdle unused pixel buffers of each size, format and pitch.
+    explicit SurfacePool(size_t maxIdle = 4, Location location = Location::current())
+        : m_mutex{CreateGuardMutex(location)}, m_maxIdle{maxIdle} {};
+    SurfacePool(const SurfacePool &) = delete;
+
+    SurfacePool &operator=(const SurfacePool &) = delete;
+
+    ~SurfacePool()
+    {
+        Trim();
+    }
+
+    // Like SDL_CreateSurface, reusing pixels from the pool if there are any to spare. Only
+    // formats of whole bytes per pixel are supported.
+    Result<PooledSurface> Create(int width, int height, SDL_PixelFormat format,
+                                 Location location = Location::current())
+    {
+        size_t alignment = SDL_GetSIMDAlignment();
+        Sint64 pitch = (Sint64(width) * SDL_BYTESPERPIXEL(format) + alignment - 1) /
+                       Sint64(alignment) * Sint64(alignment);
+        bool supported = width >= 0 && height >= 0 && !SDL_ISPIXELFORMAT_FOURCC(format) &&
+                         SDL_BITSPERPIXEL(format) >= 8 &&
+                         pitch * SDL_max(height, 1) <= SDL_MAX_SINT32;
+        if (!supported) [[unlikely]]
+        {
+            SDL_SetError("SurfacePool can't create a %dx%d surface in %s", width, height,
+                         SDL_GetPixelFormatName(format));
+            return Fail<PooledSurface>(location);
+        }
+
+        Key key{width, height, format, int(pitch)};
+        void *pixels = nullptr;
+        {
+            LockedMutex lock = ScopedLock(m_mutex);
+            std::vector<void *> &idle = m_idle[key];
+            if (!idle.empty())
+            {
+                pixels = idle.back();
+                idle.pop_back();
+            }
+        }
+        if (!pixels)
+        {
+            pixels = SDL_aligned_alloc(alignment, size_t(pitch) * SDL_max(height, 1));
+            if (!pixels) [[unlikely]]
+            {
+                return Fail<PooledSurface>(location);
+            }
+        }
+
+        SDL_Surface *surface = SDL_CreateSurfaceFrom(width, height, format, pixels, key.pitch);
+        if (!surface) [[unlikely]]
+        {
+            Return(key, pixels);
+            return Fail<PooledSurface>(location);
+        }
+        return PooledSurface{surface, Recycler{this}};
+    }
+
+    // Frees all the pixels not in use.
+    void Trim()
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        for (auto &[key, idle] : m_idle)
+        {
+            for (void *pixels : idle)
+            {
+                SDL_aligned_free(pixels);
+            }
+        }
+        m_idle.clear();
+    }
+
+  private:
+    struct Key
+    {
+        int width;
+        int height;
+        SDL_PixelFormat format;
+        int pitch;
+
+        bool operator==(const Key &) const = default;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key &key) const
+        {
+            return SDL_murmur3_32(&key, sizeof(key), 0);
+        }
+    };
+
+    void Recycle(SDL_Surface *surface)
+    {
+        Key key{surface->w, surface->h, surface->format, surface->pitch};
+        void *pixels = surface->pixels;
+        SDL_DestroySurface(surface);
+        Return(key, pixels);
+    }
+
+    void Return(const Key &key, void *pixels)
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        std::vector<void *> &idle = m_idle[key];
+        if (idle.size() < m_maxIdle)
+        {
+            idle.push_back(pixels);
+        }
+        else
+        {
+            SDL_aligned_free(pixels);
+        }
+    }
+
+    Mutex m_mutex;
+    size_t m_maxIdle;
+    std::unordered_map<Key, std::vector<void *>, KeyHash> m_idle;
+};
+
 } // namespace sdl
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "SDL.hpp"
+
+namespace benchmark
+{
+
+// Runs function iterations times, and returns the mean time of one run in nanoseconds.
+template <class Function> double Measure(int iterations, const Function &function)
+{
+    function(); // Warm up caches and lazily initialized state.
+    Uint64 start = SDL_GetPerformanceCounter();
+    for (int i = 0; i < iterations; ++i)
+    {
+        function();
+    }
+    Uint64 ticks = SDL_GetPerformanceCounter() - start;
+    return double(ticks) * 1e9 / double(SDL_GetPerformanceFrequency()) / iterations;
+}
+
+inline void Report(const char *name, double nanoseconds)
+{
+    SDL_Log("%-40s %12.1f ns", name, nanoseconds);
+}
+
+} // namespace benchmark
@@ -0,0 +1,48 @@
+// Times the parallel surface operations on a 3840x2160 image with pools of 1, 2, 4, ... threads
+// up to the number of logical cores, to show how they scale.
+
+#include "Benchmark.h"
+
+#include <string>
+
+constexpr int Iterations = 20;
+constexpr int Width = 3840;
+constexpr int Height = 2160;
+
+static void Report(const char *what, int numThreads, double nanoseconds, double oneThread)
+{
+    std::string name = std::string(what) + ", " + std::to_string(numThreads) + " threads";
+    benchmark::Report(name.c_str(), nanoseconds);
+    SDL_Log("%-40s %12.2fx", "  speedup", oneThread / nanoseconds);
+}
+
+int main()
+{
+    sdl::Surface source{sdl::CreateSurface(Width, Height, SDL_PIXELFORMAT_ARGB8888)};
+    sdl::Surface target{sdl::CreateSurface(Width, Height, SDL_PIXELFORMAT_ARGB8888)};
+    // Half transparent premultiplied gray.
+    sdl::FillSurfaceRect(source.get(), nullptr, 0x80404040);
+
+    double convertOne = 0;
+    double blendOne = 0;
+    int numCores = SDL_GetNumLogicalCPUCores();
+    for (int numThreads = 1; numThreads <= numCores; numThreads *= 2)
+    {
+        sdl::WorkerPool pool{numThreads};
+        double convert = benchmark::Measure(Iterations, [&] {
+            sdl::ConvertSurfaceParallel(pool, source.get(), SDL_PIXELFORMAT_ABGR8888);
+        });
+        double blend = benchmark::Measure(Iterations, [&] {
+            sdl::BlitSurfacePremultipliedParallel(pool, source.get(), nullptr, target.get(), 0,
+                                                  0);
+        });
+        if (numThreads == 1)
+        {
+            convertOne = convert;
+            blendOne = blend;
+        }
+        Report("Convert to ABGR8888", numThreads, convert, convertOne);
+        Report("Premultiplied blend", numThreads, blend, blendOne);
+    }
+    return 0;
+}
@@ -0,0 +1,107 @@
+// Times two sample filters, inverting and converting to grayscale, written once with
+// ReadSurfacePixel/WriteSurfacePixel and once with PixelView, and checks that both give the
+// same pixels.
+
+#include "Benchmark.h"
+
+#include <cstring>
+
+constexpr int Iterations = 10;
+constexpr int Size = 1024;
+constexpr SDL_PixelFormat Format = SDL_PIXELFORMAT_ARGB8888;
+
+using View = sdl::PixelView<Format>;
+
+static Uint8 Gray(Uint8 r, Uint8 g, Uint8 b)
+{
+    return Uint8((r * 77 + g * 150 + b * 29) >> 8);
+}
+
+SDL_NOINLINE void InvertPerPixel(SDL_Surface *surface)
+{
+    for (int y = 0; y < surface->h; ++y)
+    {
+        for (int x = 0; x < surface->w; ++x)
+        {
+            Uint8 r, g, b, a;
+            sdl::ReadSurfacePixel(surface, x, y, &r, &g, &b, &a);
+            sdl::WriteSurfacePixel(surface, x, y, 255 - r, 255 - g, 255 - b, a);
+        }
+    }
+}
+
+SDL_NOINLINE void InvertView(const View &view)
+{
+    for (std::span<View::Pixel> row : view)
+    {
+        for (View::Pixel &pixel : row)
+        {
+            pixel ^= 0x00FFFFFF;
+        }
+    }
+}
+
+SDL_NOINLINE void GrayscalePerPixel(SDL_Surface *surface)
+{
+    for (int y = 0; y < surface->h; ++y)
+    {
+        for (int x = 0; x < surface->w; ++x)
+        {
+            Uint8 r, g, b, a;
+            sdl::ReadSurfacePixel(surface, x, y, &r, &g, &b, &a);
+            Uint8 gray = Gray(r, g, b);
+            sdl::WriteSurfacePixel(surface, x, y, gray, gray, gray, a);
+        }
+    }
+}
+
+SDL_NOINLINE void GrayscaleView(const View &view)
+{
+    for (std::span<View::Pixel> row : view)
+    {
+        for (View::Pixel &pixel : row)
+        {
+            Uint8 r, g, b, a;
+            sdl::GetRGBA<Format>(pixel, &r, &g, &b, &a);
+            Uint8 gray = Gray(r, g, b);
+            pixel = sdl::MapRGBA<Format>(gray, gray, gray, a);
+        }
+    }
+}
+
+static void Fill(SDL_Surface *surface)
+{
+    Uint32 state = 1;
+    Uint8 *pixels = static_cast<Uint8 *>(surface->pixels);
+    for (int i = 0; i < surface->pitch * surface->h; ++i)
+    {
+        state = state * 1664525 + 1013904223;
+        pixels[i] = Uint8(state >> 24);
+    }
+}
+
+int main()
+{
+    sdl::Surface perPixel{sdl::CreateSurface(Size, Size, Format)};
+    sdl::Surface viewed{sdl::CreateSurface(Size, Size, Format)};
+    Fill(perPixel.get());
+    Fill(viewed.get());
+    View view = View::Lock(viewed.get());
+
+    benchmark::Report("Invert, Read/WriteSurfacePixel",
+                      benchmark::Measure(Iterations, [&] { InvertPerPixel(perPixel.get()); }));
+    benchmark::Report("Invert, PixelView",
+                      benchmark::Measure(Iterations, [&] { InvertView(view); }));
+    benchmark::Report("Grayscale, Read/WriteSurfacePixel",
+                      benchmark::Measure(Iterations, [&] { GrayscalePerPixel(perPixel.get()); }));
+    benchmark::Report("Grayscale, PixelView",
+                      benchmark::Measure(Iterations, [&] { GrayscaleView(view); }));
+
+    // Both ran the same filters the same number of times.
+    if (std::memcmp(perPixel->pixels, viewed->pixels, size_t(perPixel->pitch) * Size) != 0)
+    {
+        SDL_Log("The filters give different pixels through PixelView");
+        return 1;
+    }
+    return 0;
+}
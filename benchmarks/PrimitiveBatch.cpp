@@ -0,0 +1,88 @@
+// Times a debug overlay of 10k independent lines and 1k rectangles in 4 colors, drawn with one
+// SDL call per primitive against PrimitiveBatch, and logs how many render calls each makes.
+
+#include "Benchmark.h"
+
+#include <iterator>
+
+constexpr int Iterations = 100;
+constexpr int NumLines = 10000;
+constexpr int NumRects = 1000;
+constexpr int Size = 512;
+
+struct Line
+{
+    SDL_FPoint from;
+    SDL_FPoint to;
+    SDL_FColor color;
+};
+
+static const SDL_FColor colors[] = {{1, 0, 0, 1}, {0, 1, 0, 1}, {0, 0, 1, 1}, {1, 1, 1, 1}};
+
+SDL_NOINLINE void RenderPerPrimitive(SDL_Renderer *renderer, const std::vector<Line> &lines,
+                                     const std::vector<SDL_FRect> &rects)
+{
+    for (const Line &line : lines)
+    {
+        SDL_SetRenderDrawColorFloat(renderer, line.color.r, line.color.g, line.color.b,
+                                    line.color.a);
+        SDL_RenderLine(renderer, line.from.x, line.from.y, line.to.x, line.to.y);
+    }
+    for (size_t i = 0; i < rects.size(); ++i)
+    {
+        const SDL_FColor &color = colors[i % std::size(colors)];
+        SDL_SetRenderDrawColorFloat(renderer, color.r, color.g, color.b, color.a);
+        SDL_RenderRect(renderer, &rects[i]);
+    }
+}
+
+SDL_NOINLINE void RenderBatched(SDL_Renderer *renderer, sdl::PrimitiveBatch &batch,
+                                const std::vector<Line> &lines,
+                                const std::vector<SDL_FRect> &rects)
+{
+    batch.Clear();
+    for (const Line &line : lines)
+    {
+        batch.AddLine(line.from, line.to, line.color);
+    }
+    for (size_t i = 0; i < rects.size(); ++i)
+    {
+        batch.AddRect(rects[i], colors[i % std::size(colors)]);
+    }
+    batch.Render(renderer);
+}
+
+int main()
+{
+    sdl::Surface target{sdl::CreateSurface(Size, Size, SDL_PIXELFORMAT_ARGB8888)};
+    sdl::Renderer renderer{sdl::CreateSoftwareRenderer(target.get())};
+
+    Uint32 state = 1;
+    auto random = [&state] {
+        state = state * 1664525 + 1013904223;
+        return float(state >> 8) / float(1 << 24) * Size;
+    };
+    std::vector<Line> lines(NumLines);
+    for (int i = 0; i < NumLines; ++i)
+    {
+        SDL_FPoint from{random(), random()};
+        SDL_FPoint to{random(), random()};
+        lines[i] = {from, to, colors[i % std::size(colors)]};
+    }
+    std::vector<SDL_FRect> rects(NumRects);
+    for (SDL_FRect &rect : rects)
+    {
+        rect = {random(), random(), random() / 8, random() / 8};
+    }
+
+    benchmark::Report("Per primitive", benchmark::Measure(Iterations, [&] {
+                          RenderPerPrimitive(renderer.get(), lines, rects);
+                      }));
+    SDL_Log("%-40s %12d", "  render calls", NumLines + NumRects);
+    sdl::PrimitiveBatch batch;
+    benchmark::Report("PrimitiveBatch", benchmark::Measure(Iterations, [&] {
+                          RenderBatched(renderer.get(), batch, lines, rects);
+                      }));
+    SDL_Log("%-40s %12u", "  render calls", unsigned(batch.RenderCalls()));
+    return 0;
+}
@@ -0,0 +1,66 @@
+// Times getting per-draw uniforms for 10k draws to the GPU: pushing them per draw, against
+// packing them with GPUUniformArena and uploading them once. Only the CPU side of recording and
+// submitting is timed. Issuing the draws would need shaders, and adds the same cost to both.
+
+#include "Benchmark.h"
+
+constexpr int Iterations = 100;
+constexpr int NumDraws = 10000;
+
+struct DrawUniforms
+{
+    float transform[16];
+    float color[4];
+};
+
+SDL_NOINLINE void PushUniforms(SDL_GPUDevice *device, const DrawUniforms *uniforms)
+{
+    SDL_GPUCommandBuffer *commandBuffer = SDL_AcquireGPUCommandBuffer(device);
+    for (int i = 0; i < NumDraws; ++i)
+    {
+        SDL_PushGPUVertexUniformData(commandBuffer, 0, &uniforms[i], sizeof(DrawUniforms));
+    }
+    SDL_SubmitGPUCommandBuffer(commandBuffer);
+}
+
+SDL_NOINLINE void PackUniforms(SDL_GPUDevice *device, sdl::GPUUniformArena &arena,
+                               const DrawUniforms *uniforms)
+{
+    SDL_GPUCommandBuffer *commandBuffer = SDL_AcquireGPUCommandBuffer(device);
+    for (int i = 0; i < NumDraws; ++i)
+    {
+        arena.Push(uniforms[i]);
+    }
+    SDL_GPUCopyPass *copyPass = SDL_BeginGPUCopyPass(commandBuffer);
+    arena.Upload(copyPass);
+    SDL_EndGPUCopyPass(copyPass);
+    SDL_SubmitGPUCommandBuffer(commandBuffer);
+}
+
+int main()
+{
+    sdl::GPUDevice device{SDL_CreateGPUDevice(
+        SDL_GPU_SHADERFORMAT_SPIRV | SDL_GPU_SHADERFORMAT_DXIL | SDL_GPU_SHADERFORMAT_MSL, false,
+        nullptr)};
+    if (!device)
+    {
+        SDL_Log("No GPU device, skipping: %s", SDL_GetError());
+        return 0;
+    }
+
+    std::vector<DrawUniforms> uniforms(NumDraws);
+    for (int i = 0; i < NumDraws; ++i)
+    {
+        uniforms[i].transform[0] = float(i);
+    }
+
+    benchmark::Report("10k draws, pushed uniforms", benchmark::Measure(Iterations, [&] {
+                          PushUniforms(device.get(), uniforms.data());
+                      }));
+    sdl::GPUUniformArena arena{device.get()};
+    benchmark::Report("10k draws, uniform arena", benchmark::Measure(Iterations, [&] {
+                          PackUniforms(device.get(), arena, uniforms.data());
+                      }));
+    SDL_WaitForGPUIdle(device.get());
+    return 0;
+}
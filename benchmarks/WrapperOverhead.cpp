@@ -0,0 +1,36 @@
+// Times sdl::RenderTexture against a plain SDL_RenderTexture on a software renderer. It is
+// built as WrapperOverhead and as WrapperOverheadNoLocation, with SDL_HPP_SOURCE_LOCATION 0;
+// compare the code of RenderWrapped in both, e.g. with objdump -d, for what capturing the
+// caller's source location costs.
+
+#include "Benchmark.h"
+
+constexpr int Iterations = 1000000;
+
+SDL_NOINLINE void RenderPlain(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_FRect &rect)
+{
+    SDL_RenderTexture(renderer, texture, nullptr, &rect);
+}
+
+SDL_NOINLINE void RenderWrapped(SDL_Renderer *renderer, SDL_Texture *texture,
+                                const SDL_FRect &rect)
+{
+    sdl::RenderTexture(renderer, texture, nullptr, &rect);
+}
+
+int main()
+{
+    sdl::Surface target{sdl::CreateSurface(64, 64, SDL_PIXELFORMAT_ARGB8888)};
+    sdl::Renderer renderer{sdl::CreateSoftwareRenderer(target.get())};
+    sdl::Texture texture{sdl::CreateTexture(renderer.get(), SDL_PIXELFORMAT_ARGB8888,
+                                            SDL_TEXTUREACCESS_STATIC, 1, 1)};
+    SDL_FRect rect{0, 0, 1, 1};
+
+    benchmark::Report("SDL_RenderTexture", benchmark::Measure(Iterations, [&] {
+                          RenderPlain(renderer.get(), texture.get(), rect);
+                      }));
+    benchmark::Report("sdl::RenderTexture", benchmark::Measure(Iterations, [&] {
+                          RenderWrapped(renderer.get(), texture.get(), rect);
+                      }));
+    return 0;
+}
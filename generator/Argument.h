@@ -18,6 +18,7 @@ struct Argument
             CXString cxs = clang_getTypeSpelling(pointeeType);
             m_pointeeTypeString = clang_getCString(cxs);
             clang_disposeString(cxs);
+            m_pointsToRecord = clang_getCanonicalType(pointeeType).kind == CXType_Record;
         }
     }
 
@@ -36,6 +37,12 @@ struct Argument
         return m_isPointer;
     }
 
+    // Whether this points to a struct, rather than e.g. to a typedef of an int like SDL_SpinLock.
+    bool PointsToRecord() const
+    {
+        return m_pointsToRecord;
+    }
+
     const std::string &PointeeTypeString() const
     {
         return m_pointeeTypeString;
@@ -45,6 +52,7 @@ struct Argument
     std::string m_name;
     std::string m_declaration;
     bool m_isPointer;
+    bool m_pointsToRecord = false;
     std::string m_pointeeTypeString;
 };
 
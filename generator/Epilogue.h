@@ -1 +1,3805 @@
+// Reports a failed SDL call in a constructor, which has no Result to return it in. Throws,
+// aborts or calls the error callback as the policy says; SDL_HPP_ERROR_EXPECTED logs it.
+SDL_HPP_COLD inline void FailConstruction(Location location)
+{
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_EXPECTED
+    SDL_Log("SDL error: %s", Error{location}.Message());
+#else
+    (void)Fail<void>(location);
+#endif
+}
+
+// Creates the mutex guarding an object, for its constructor. SDL ignores a null mutex,
+// so after a reported failure the object still works from a single thread.
+inline Mutex CreateGuardMutex(Location location)
+{
+    Mutex mutex{SDL_CreateMutex()};
+    if (!mutex) [[unlikely]]
+    {
+        FailConstruction(location);
+    }
+    return mutex;
+}
+
+// Locks the mutex until the returned guard goes out of scope.
+[[nodiscard]] inline LockedMutex ScopedLock(const Mutex &mutex)
+{
+    SDL_LockMutex(mutex.get());
+    return LockedMutex{mutex.get()};
+}
+
+// Items the GPU may still be using, in frames tagged with the fence of the command buffer that
+// used them. Track() starts a frame and Collect() hands back the items of every frame whose
+// fence has signaled. Used by the fenced queues below.
+template <class T> struct GPUFenceTracker
+{
+    explicit GPUFenceTracker(SDL_GPUDevice *device) : m_device{device} {};
+    GPUFenceTracker(const GPUFenceTracker &) = delete;
+
+    GPUFenceTracker &operator=(const GPUFenceTracker &) = delete;
+
+    // Submits the command buffer, and tracks items until the GPU has finished it.
+    Result<void> Submit(SDL_GPUCommandBuffer *commandBuffer, std::vector<T> &items,
+                        Location location = Location::current())
+    {
+        SDL_GPUFence *fence = SDL_SubmitGPUCommandBufferAndAcquireFence(commandBuffer);
+        if (!fence) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        Track(fence, items);
+        return Success();
+    }
+
+    // Tracks items until the fence signals, taking ownership of the fence. Leaves items empty,
+    // reusing the storage of a collected frame.
+    void Track(SDL_GPUFence *fence, std::vector<T> &items)
+    {
+        m_frames.push_back({fence, std::move(items)});
+        items = std::move(m_spare);
+        items.clear();
+    }
+
+    // Calls complete(items) for every frame the GPU has finished, and releases its fence.
+    // Never waits.
+    template <class Function> void Collect(const Function &complete)
+    {
+        size_t remaining = 0;
+        for (size_t i = 0; i < m_frames.size(); ++i)
+        {
+            if (SDL_QueryGPUFence(m_device, m_frames[i].fence))
+            {
+                Retire(m_frames[i], complete);
+            }
+            else
+            {
+                if (remaining != i)
+                {
+                    m_frames[remaining] = std::move(m_frames[i]);
+                }
+                ++remaining;
+            }
+        }
+        m_frames.resize(remaining);
+    }
+
+    // Calls complete(items) for every frame, finished or not, and releases its fence.
+    template <class Function> void ReleaseAll(const Function &complete)
+    {
+        for (Frame &frame : m_frames)
+        {
+            Retire(frame, complete);
+        }
+        m_frames.clear();
+    }
+
+    size_t Size() const
+    {
+        return m_frames.size();
+    }
+
+  private:
+    struct Frame
+    {
+        SDL_GPUFence *fence;
+        std::vector<T> items;
+    };
+
+    template <class Function> void Retire(Frame &frame, const Function &complete)
+    {
+        SDL_ReleaseGPUFence(m_device, frame.fence);
+        frame.fence = nullptr;
+        complete(frame.items);
+        frame.items.clear();
+        if (m_spare.capacity() < frame.items.capacity())
+        {
+            m_spare = std::move(frame.items);
+        }
+    }
+
+    SDL_GPUDevice *m_device;
+    std::vector<Frame> m_frames;
+    std::vector<T> m_spare;
+};
+
+// Defers releasing GPU resources until the GPU is done with them, without waiting for it.
+// Released objects are collected for the frame being recorded. Submitting that frame's
+// command buffer via Submit() tags them with its fence, and Collect() releases the objects
+// of every frame whose fence has signaled.
+struct GPUReleaseQueue
+{
+    explicit GPUReleaseQueue(SDL_GPUDevice *device) : m_device{device}, m_frames{device} {};
+    GPUReleaseQueue(const GPUReleaseQueue &) = delete;
+
+    GPUReleaseQueue &operator=(const GPUReleaseQueue &) = delete;
+
+    // Waits for the GPU to be idle, then releases everything still queued.
+    ~GPUReleaseQueue()
+    {
+        if (m_frames.Size() > 0 || !m_current.empty())
+        {
+            SDL_WaitForGPUIdle(m_device);
+            Collect();
+            ReleaseObjects(m_current);
+        }
+    }
+
+    template <class T> void Release(T *object)
+    {
+        if (object)
+        {
+            m_current.push_back({object, &ReleaseObject<T>});
+        }
+    }
+
+    template <class T> void Release(DeviceOwned<T> &&object)
+    {
+        Release(object.Detach());
+    }
+
+    template <class T, class Context> void Release(SharedDeviceOwned<T, Context> &&object)
+    {
+        Release(object.Detach());
+    }
+
+    // Submits the command buffer, and queues everything released so far
+    // to be released once the GPU has finished it.
+    Result<void> Submit(SDL_GPUCommandBuffer *commandBuffer,
+                        Location location = Location::current())
+    {
+        if (m_current.empty())
+        {
+            if (!SDL_SubmitGPUCommandBuffer(commandBuffer)) [[unlikely]]
+            {
+                return Fail<void>(location);
+            }
+            return Success();
+        }
+
+        return m_frames.Submit(commandBuffer, m_current, location);
+    }
+
+    // Queues everything released so far to be released once the fence signals,
+    // taking ownership of the fence.
+    void Track(SDL_GPUFence *fence)
+    {
+        m_frames.Track(fence, m_current);
+    }
+
+    // Releases the objects of all frames the GPU has finished. Never waits.
+    void Collect()
+    {
+        m_frames.Collect([this](std::vector<Object> &objects) { ReleaseObjects(objects); });
+    }
+
+    size_t PendingFrames() const
+    {
+        return m_frames.Size();
+    }
+
+  private:
+    struct Object
+    {
+        void *object;
+        void (*release)(SDL_GPUDevice *device, void *object);
+    };
+
+    template <class T> static void ReleaseObject(SDL_GPUDevice *device, void *object)
+    {
+        ReleaseFromDevice<T>(device, static_cast<T *>(object));
+    }
+
+    void ReleaseObjects(std::vector<Object> &objects)
+    {
+        for (const Object &object : objects)
+        {
+            object.release(m_device, object.object);
+        }
+        objects.clear();
+    }
+
+    SDL_GPUDevice *m_device;
+    std::vector<Object> m_current;
+    GPUFenceTracker<Object> m_frames;
+};
+
+// Sub-allocates uploads from a few large transfer buffers ("chunks") that are reused,
+// instead of creating, mapping and releasing a transfer buffer per upload.
+// Allocate() returns mapped memory to write the data to, UploadToBuffer()/UploadToTexture()
+// record where it goes, and Flush() issues the recorded uploads in a copy pass, merging
+// uploads of adjacent regions into one call. Like GPUReleaseQueue, Submit() tags the chunks
+// used by a frame with its fence, and Collect() makes them available again once it signaled.
+// A chunk is therefore never mapped while the GPU reads from it, so mapping doesn't cycle.
+// Chunks allocated from after the last Flush() aren't submitted, and wait for the next one.
+struct GPUUploadRing
+{
+    struct Allocation
+    {
+        Uint8 *data;
+        Uint32 size;
+        SDL_GPUTransferBuffer *transferBuffer;
+        Uint32 offset;
+    };
+
+    explicit GPUUploadRing(SDL_GPUDevice *device, Uint32 chunkSize = 8 * 1024 * 1024)
+        : m_device{device}, m_chunkSize{chunkSize}, m_frames{device} {};
+    GPUUploadRing(const GPUUploadRing &) = delete;
+
+    GPUUploadRing &operator=(const GPUUploadRing &) = delete;
+
+    ~GPUUploadRing()
+    {
+        for (Chunk &chunk : m_flushed)
+        {
+            ReleaseChunk(chunk);
+        }
+        for (Chunk &chunk : m_active)
+        {
+            ReleaseChunk(chunk);
+        }
+        for (Chunk &chunk : m_free)
+        {
+            ReleaseChunk(chunk);
+        }
+        m_frames.ReleaseAll([this](std::vector<Chunk> &chunks) {
+            for (Chunk &chunk : chunks)
+            {
+                ReleaseChunk(chunk);
+            }
+        });
+    }
+
+    // Returns size bytes of mapped transfer buffer memory, aligned to alignment (a power of 2).
+    Result<Allocation> Allocate(Uint32 size, Uint32 alignment = 16,
+                                Location location = Location::current())
+    {
+        Chunk *chunk = m_active.empty() ? nullptr : &m_active.back();
+        Uint32 offset = chunk ? (chunk->used + alignment - 1) & ~(alignment - 1) : 0;
+
+        if (!chunk || !chunk->mapped || offset + size > chunk->size)
+        {
+            chunk = NextChunk(size);
+            if (!chunk) [[unlikely]]
+            {
+                return Fail<Allocation>(location);
+            }
+            offset = 0;
+        }
+
+        chunk->used = offset + size;
+        return Allocation{chunk->mapped + offset, size, chunk->transferBuffer, offset};
+    }
+
+    void UploadToBuffer(const Allocation &allocation, SDL_GPUBuffer *buffer, Uint32 offset,
+                        bool cycle = false)
+    {
+        m_bufferUploads.push_back({{allocation.transferBuffer, allocation.offset},
+                                   {buffer, offset, allocation.size},
+                                   cycle});
+    }
+
+    void UploadToTexture(const Allocation &allocation, const SDL_GPUTextureRegion &region,
+                         Uint32 pixelsPerRow = 0, Uint32 rowsPerLayer = 0, bool cycle = false)
+    {
+        m_textureUploads.push_back(
+            {{allocation.transferBuffer, allocation.offset, pixelsPerRow, rowsPerLayer},
+             region,
+             cycle});
+    }
+
+    // Issues all recorded uploads. Consecutive buffer uploads continuing each other
+    // in both the transfer buffer and the destination buffer become one upload.
+    void Flush(SDL_GPUCopyPass *copyPass)
+    {
+        for (Chunk &chunk : m_active)
+        {
+            if (chunk.mapped)
+            {
+                SDL_UnmapGPUTransferBuffer(m_device, chunk.transferBuffer);
+                chunk.mapped = nullptr;
+            }
+        }
+        m_flushed.insert(m_flushed.end(), m_active.begin(), m_active.end());
+        m_active.clear();
+
+        for (size_t i = 0; i < m_bufferUploads.size();)
+        {
+            BufferUpload upload = m_bufferUploads[i++];
+            while (i < m_bufferUploads.size() && Continues(upload, m_bufferUploads[i]))
+            {
+                upload.destination.size += m_bufferUploads[i++].destination.size;
+            }
+            SDL_UploadToGPUBuffer(copyPass, &upload.source, &upload.destination, upload.cycle);
+        }
+        m_bufferUploads.clear();
+
+        for (const TextureUpload &upload : m_textureUploads)
+        {
+            SDL_UploadToGPUTexture(copyPass, &upload.source, &upload.destination, upload.cycle);
+        }
+        m_textureUploads.clear();
+    }
+
+    // Submits the command buffer (containing the Flush()), and keeps the chunks flushed
+    // so far from being reused until the GPU has finished it.
+    Result<void> Submit(SDL_GPUCommandBuffer *commandBuffer,
+                        Location location = Location::current())
+    {
+        return m_frames.Submit(commandBuffer, m_flushed, location);
+    }
+
+    // Keeps the chunks flushed so far from being reused until the fence signals,
+    // taking ownership of the fence.
+    void Track(SDL_GPUFence *fence)
+    {
+        m_frames.Track(fence, m_flushed);
+    }
+
+    // Makes the chunks of all frames the GPU has finished available again. Never waits.
+    void Collect()
+    {
+        m_frames.Collect([this](std::vector<Chunk> &chunks) {
+            for (Chunk &chunk : chunks)
+            {
+                chunk.used = 0;
+                chunk.mapped = nullptr;
+                m_free.push_back(chunk);
+            }
+        });
+    }
+
+  private:
+    struct Chunk
+    {
+        SDL_GPUTransferBuffer *transferBuffer;
+        Uint32 size;
+        Uint32 used;
+        Uint8 *mapped;
+    };
+
+    struct BufferUpload
+    {
+        SDL_GPUTransferBufferLocation source;
+        SDL_GPUBufferRegion destination;
+        bool cycle;
+    };
+
+    struct TextureUpload
+    {
+        SDL_GPUTextureTransferInfo source;
+        SDL_GPUTextureRegion destination;
+        bool cycle;
+    };
+
+    static bool Continues(const BufferUpload &upload, const BufferUpload &next)
+    {
+        return !next.cycle && next.source.transfer_buffer == upload.source.transfer_buffer &&
+               next.source.offset == upload.source.offset + upload.destination.size &&
+               next.destination.buffer == upload.destination.buffer &&
+               next.destination.offset == upload.destination.offset + upload.destination.size;
+    }
+
+    // Maps a free chunk big enough for size bytes, or creates a new one,
+    // and makes it the active chunk allocations come from.
+    Chunk *NextChunk(Uint32 size)
+    {
+        Chunk chunk{};
+        for (size_t i = 0; i < m_free.size(); ++i)
+        {
+            if (m_free[i].size >= size)
+            {
+                chunk = m_free[i];
+                m_free[i] = m_free.back();
+                m_free.pop_back();
+                break;
+            }
+        }
+
+        if (!chunk.transferBuffer)
+        {
+            SDL_GPUTransferBufferCreateInfo createInfo{};
+            createInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+            createInfo.size = size > m_chunkSize ? size : m_chunkSize;
+            chunk.transferBuffer = SDL_CreateGPUTransferBuffer(m_device, &createInfo);
+            if (!chunk.transferBuffer)
+            {
+                return nullptr;
+            }
+            chunk.size = createInfo.size;
+        }
+
+        chunk.mapped =
+            static_cast<Uint8 *>(SDL_MapGPUTransferBuffer(m_device, chunk.transferBuffer, false));
+        if (!chunk.mapped)
+        {
+            m_free.push_back(chunk);
+            return nullptr;
+        }
+
+        m_active.push_back(chunk);
+        return &m_active.back();
+    }
+
+    void ReleaseChunk(Chunk &chunk)
+    {
+        if (chunk.mapped)
+        {
+            SDL_UnmapGPUTransferBuffer(m_device, chunk.transferBuffer);
+        }
+        SDL_ReleaseGPUTransferBuffer(m_device, chunk.transferBuffer);
+    }
+
+    SDL_GPUDevice *m_device;
+    Uint32 m_chunkSize;
+    std::vector<Chunk> m_free;
+    // Mapped chunks allocations come from, and the unmapped ones Flush() issued uploads from.
+    std::vector<Chunk> m_active;
+    std::vector<Chunk> m_flushed;
+    GPUFenceTracker<Chunk> m_frames;
+    std::vector<BufferUpload> m_bufferUploads;
+    std::vector<TextureUpload> m_textureUploads;
+};
+
+// Reads back GPU buffers and textures without stalling: DownloadFromBuffer()/
+// DownloadFromTexture() record a download into a pooled transfer buffer in a copy pass,
+// Submit() tags the frame's downloads with its fence, and Collect() calls each download's
+// callback with the data once its fence has signaled, so readbacks can be several frames
+// in flight.
+struct GPUReadbackQueue
+{
+    // Called from Collect() with the downloaded data, which is only valid during the call.
+    using Callback = void (*)(void *userdata, const void *data, Uint32 size);
+
+    explicit GPUReadbackQueue(SDL_GPUDevice *device) : m_device{device}, m_frames{device} {};
+    GPUReadbackQueue(const GPUReadbackQueue &) = delete;
+
+    GPUReadbackQueue &operator=(const GPUReadbackQueue &) = delete;
+
+    // Waits for the GPU to be idle, so all pending callbacks get called.
+    ~GPUReadbackQueue()
+    {
+        if (m_frames.Size() > 0)
+        {
+            SDL_WaitForGPUIdle(m_device);
+            Collect();
+        }
+        for (Download &download : m_current)
+        {
+            m_free.push_back(download.buffer);
+        }
+        for (const TransferBuffer &buffer : m_free)
+        {
+            SDL_ReleaseGPUTransferBuffer(m_device, buffer.transferBuffer);
+        }
+    }
+
+    Result<void> DownloadFromBuffer(SDL_GPUCopyPass *copyPass, const SDL_GPUBufferRegion &source,
+                                    Callback callback, void *userdata,
+                                    Location location = Location::current())
+    {
+        TransferBuffer buffer = AcquireBuffer(source.size);
+        if (!buffer.transferBuffer) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+
+        SDL_GPUTransferBufferLocation destination{buffer.transferBuffer, 0};
+        SDL_DownloadFromGPUBuffer(copyPass, &source, &destination);
+        m_current.push_back({buffer, source.size, callback, userdata});
+        return Success();
+    }
+
+    // size is the number of bytes the region takes in the transfer buffer,
+    // e.g. from SDL_CalculateGPUTextureFormatSize().
+    Result<void> DownloadFromTexture(SDL_GPUCopyPass *copyPass, const SDL_GPUTextureRegion &source,
+                                     Uint32 size, Callback callback, void *userdata,
+                                     Uint32 pixelsPerRow = 0, Uint32 rowsPerLayer = 0,
+                                     Location location = Location::current())
+    {
+        TransferBuffer buffer = AcquireBuffer(size);
+        if (!buffer.transferBuffer) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+
+        SDL_GPUTextureTransferInfo destination{buffer.transferBuffer, 0, pixelsPerRow,
+                                               rowsPerLayer};
+        SDL_DownloadFromGPUTexture(copyPass, &source, &destination);
+        m_current.push_back({buffer, size, callback, userdata});
+        return Success();
+    }
+
+    // Submits the command buffer containing the downloads recorded so far.
+    Result<void> Submit(SDL_GPUCommandBuffer *commandBuffer,
+                        Location location = Location::current())
+    {
+        return m_frames.Submit(commandBuffer, m_current, location);
+    }
+
+    // Completes the downloads recorded so far once the fence signals,
+    // taking ownership of the fence.
+    void Track(SDL_GPUFence *fence)
+    {
+        m_frames.Track(fence, m_current);
+    }
+
+    // Calls the callbacks of all downloads the GPU has finished. Never waits.
+    void Collect()
+    {
+        m_frames.Collect([this](std::vector<Download> &downloads) {
+            for (const Download &download : downloads)
+            {
+                Complete(download);
+            }
+        });
+    }
+
+    size_t PendingFrames() const
+    {
+        return m_frames.Size();
+    }
+
+  private:
+    struct TransferBuffer
+    {
+        SDL_GPUTransferBuffer *transferBuffer;
+        Uint32 size;
+    };
+
+    struct Download
+    {
+        TransferBuffer buffer;
+        Uint32 size;
+        Callback callback;
+        void *userdata;
+    };
+
+    // Takes the smallest pooled transfer buffer of at least size bytes out of the pool,
+    // or creates one with size rounded up to a power of 2.
+    TransferBuffer AcquireBuffer(Uint32 size)
+    {
+        size_t best = m_free.size();
+        for (size_t i = 0; i < m_free.size(); ++i)
+        {
+            if (m_free[i].size >= size &&
+                (best == m_free.size() || m_free[i].size < m_free[best].size))
+            {
+                best = i;
+            }
+        }
+
+        if (best == m_free.size())
+        {
+            Uint32 bufferSize = 64 * 1024;
+            while (bufferSize < size)
+            {
+                bufferSize *= 2;
+            }
+
+            SDL_GPUTransferBufferCreateInfo createInfo{};
+            createInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_DOWNLOAD;
+            createInfo.size = bufferSize;
+            SDL_GPUTransferBuffer *transferBuffer =
+                SDL_CreateGPUTransferBuffer(m_device, &createInfo);
+            return TransferBuffer{transferBuffer, transferBuffer ? bufferSize : 0};
+        }
+
+        TransferBuffer buffer = m_free[best];
+        m_free[best] = m_free.back();
+        m_free.pop_back();
+        return buffer;
+    }
+
+    void Complete(const Download &download)
+    {
+        void *data = SDL_MapGPUTransferBuffer(m_device, download.buffer.transferBuffer, false);
+        if (data)
+        {
+            download.callback(download.userdata, data, download.size);
+            SDL_UnmapGPUTransferBuffer(m_device, download.buffer.transferBuffer);
+        }
+        else
+        {
+            download.callback(download.userdata, nullptr, 0);
+        }
+        m_free.push_back(download.buffer);
+    }
+
+    SDL_GPUDevice *m_device;
+    std::vector<TransferBuffer> m_free;
+    std::vector<Download> m_current;
+    GPUFenceTracker<Download> m_frames;
+};
+
+// Appends the bytes of values to key, so create infos can be hashed and compared by content.
+template <class T> void AppendContentKey(std::string &key, const T *values, size_t count)
+{
+    key.append(reinterpret_cast<const char *>(values), sizeof(T) * count);
+}
+
+template <class T> void AppendContentKey(std::string &key, const T &value)
+{
+    AppendContentKey(key, &value, 1);
+}
+
+struct ContentKeyHash
+{
+    size_t operator()(const std::string &key) const
+    {
+        return SDL_murmur3_32(key.data(), key.size(), 0);
+    }
+};
+
+// Runs the parts of a job on worker threads and the calling thread.
+struct WorkerPool
+{
+    // Runs one part of a job, concurrently with the other parts. Returns false with the SDL
+    // error set on failure.
+    using PartFunction = bool (*)(void *userdata, int part);
+
+    // Starts numThreads - 1 workers; Run() works on the calling thread too.
+    explicit WorkerPool(int numThreads = SDL_GetNumLogicalCPUCores(),
+                        Location location = Location::current())
+        : m_mutex{CreateGuardMutex(location)}, m_work{SDL_CreateSemaphore(0)},
+          m_done{SDL_CreateCondition()}
+    {
+        // Without a mutex, which was reported already, only the calling thread works.
+        if (!m_mutex) [[unlikely]]
+        {
+            return;
+        }
+        if (!m_work || !m_done) [[unlikely]]
+        {
+            FailConstruction(location);
+            return;
+        }
+        for (int i = 1; i < numThreads; ++i)
+        {
+            Thread thread{SDL_CreateThread(WorkerThread, "SDLWorker", this)};
+            if (thread)
+            {
+                m_threads.push_back(std::move(thread));
+            }
+        }
+    }
+    WorkerPool(const WorkerPool &) = delete;
+
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    ~WorkerPool()
+    {
+        {
+            LockedMutex lock = ScopedLock(m_mutex);
+            m_quit = true;
+        }
+        for (size_t i = 0; i < m_threads.size(); ++i)
+        {
+            SDL_SignalSemaphore(m_work.get());
+        }
+        m_threads.clear();
+    }
+
+    int NumThreads() const
+    {
+        return int(m_threads.size()) + 1;
+    }
+
+    // Runs function for the parts 0 to numParts - 1, taking them in order, and returns once
+    // all of them have run. Returns false if any failed, with the error of the first failing
+    // part set on the calling thread. Only one thread may call Run() at a time.
+    bool Run(int numParts, PartFunction function, void *userdata)
+    {
+        if (numParts <= 0)
+        {
+            return true;
+        }
+
+        {
+            LockedMutex lock = ScopedLock(m_mutex);
+            m_function = function;
+            m_userdata = userdata;
+            m_numParts = numParts;
+            m_next = 0;
+            m_finished = 0;
+        }
+        for (size_t i = 0; i < m_threads.size() && int(i) + 1 < numParts; ++i)
+        {
+            SDL_SignalSemaphore(m_work.get());
+        }
+        RunParts();
+
+        std::string error;
+        bool failed = false;
+        {
+            LockedMutex lock = ScopedLock(m_mutex);
+            while (m_finished < m_numParts)
+            {
+                SDL_WaitCondition(m_done.get(), m_mutex.get());
+            }
+            m_numParts = 0;
+            failed = m_failed;
+            m_failed = false;
+            error.swap(m_error);
+        }
+        if (failed) [[unlikely]]
+        {
+            // SDL errors are per thread, so the worker's error is set again on this one.
+            SDL_SetError("%s", error.c_str());
+            return false;
+        }
+        return true;
+    }
+
+    // Splits rows into bands of whole rows, a few per thread so that uneven bands even out,
+    // and runs function(firstRow, numRows) for each. Bands start on rows beginning on a cache
+    // line for the given pitch, so that writing a band doesn't share cache lines with the
+    // next. function returns false with the SDL error set on failure, and so does RunBands().
+    template <class Function> bool RunBands(int rows, int pitch, const Function &function)
+    {
+        int step = SDL_CACHELINE_SIZE;
+        for (int rest = pitch % step; rest != 0;)
+        {
+            int next = step % rest;
+            step = rest;
+            rest = next;
+        }
+        step = SDL_CACHELINE_SIZE / SDL_max(step, 1);
+        int steps = (rows + step - 1) / step;
+
+        struct Bands
+        {
+            const Function &function;
+            int rows;
+            int step;
+            int steps;
+            int numBands;
+        } bands{function, rows, step, steps, SDL_min(steps, NumThreads() * 4)};
+
+        return Run(
+            bands.numBands,
+            [](void *userdata, int band) {
+                Bands &bands = *static_cast<Bands *>(userdata);
+                Sint64 steps = bands.steps;
+                int first = int(steps * band / bands.numBands) * bands.step;
+                int end = int(steps * (band + 1) / bands.numBands) * bands.step;
+                end = SDL_min(end, bands.rows);
+                return bands.function(first, end - first);
+            },
+            &bands);
+    }
+
+  private:
+    static int SDLCALL WorkerThread(void *data)
+    {
+        WorkerPool *pool = static_cast<WorkerPool *>(data);
+        do
+        {
+            SDL_WaitSemaphore(pool->m_work.get());
+        } while (pool->RunParts());
+        return 0;
+    }
+
+    // Run() resets m_numParts once done, so late workers find nothing to run.
+    // Returns false once the pool is being destroyed.
+    bool RunParts()
+    {
+        for (;;)
+        {
+            int part = 0;
+            {
+                LockedMutex lock = ScopedLock(m_mutex);
+                if (m_quit)
+                {
+                    return false;
+                }
+                if (m_next >= m_numParts)
+                {
+                    return true;
+                }
+                part = m_next++;
+            }
+            bool succeeded = m_function(m_userdata, part);
+
+            LockedMutex lock = ScopedLock(m_mutex);
+            if (!succeeded && !m_failed)
+            {
+                m_failed = true;
+                m_error = SDL_GetError();
+            }
+            if (++m_finished == m_numParts)
+            {
+                SDL_SignalCondition(m_done.get());
+            }
+        }
+    }
+
+    Mutex m_mutex;
+    Semaphore m_work;
+    Condition m_done;
+    std::vector<Thread> m_threads;
+    PartFunction m_function = nullptr;
+    void *m_userdata = nullptr;
+    int m_numParts = 0;
+    int m_next = 0;
+    int m_finished = 0;
+    bool m_failed = false;
+    bool m_quit = false;
+    std::string m_error;
+};
+
+// Creates every distinct graphics and compute pipeline only once, and owns them.
+// Create infos are keyed by their contents, including the arrays they point to, while shaders
+// are keyed by identity. Zero-initialize create infos, so their padding fields don't split keys.
+// Safe to use from multiple threads.
+//
+// Save() writes the keys of the cached pipelines to storage, and Prebuild() creates them
+// again on a later run, in parallel, before they are first needed. Graphics pipelines are only
+// saved when both their shaders have a stable ID set via RegisterShader(), and pipelines
+// created with properties are never saved.
+struct GPUPipelineCache
+{
+    explicit GPUPipelineCache(SDL_GPUDevice *device, Location location = Location::current())
+        : m_device{device}, m_mutex{CreateGuardMutex(location)}, m_created{SDL_CreateCondition()}
+    {
+        if (!m_created) [[unlikely]]
+        {
+            FailConstruction(location);
+        }
+    }
+    GPUPipelineCache(const GPUPipelineCache &) = delete;
+
+    GPUPipelineCache &operator=(const GPUPipelineCache &) = delete;
+
+    ~GPUPipelineCache()
+    {
+        for (const auto &[key, pipeline] : m_graphics)
+        {
+            if (pipeline)
+            {
+                SDL_ReleaseGPUGraphicsPipeline(m_device, pipeline);
+            }
+        }
+        for (const auto &[key, pipeline] : m_compute)
+        {
+            if (pipeline)
+            {
+                SDL_ReleaseGPUComputePipeline(m_device, pipeline);
+            }
+        }
+    }
+
+    Result<SDL_GPUGraphicsPipeline *> GetGraphicsPipeline(
+        const SDL_GPUGraphicsPipelineCreateInfo &createInfo,
+        Location location = Location::current())
+    {
+        SDL_GPUGraphicsPipeline *pipeline = FindOrCreate(createInfo);
+        if (!pipeline) [[unlikely]]
+        {
+            return Fail<SDL_GPUGraphicsPipeline *>(location);
+        }
+        return pipeline;
+    }
+
+    Result<SDL_GPUComputePipeline *> GetComputePipeline(
+        const SDL_GPUComputePipelineCreateInfo &createInfo,
+        Location location = Location::current())
+    {
+        SDL_GPUComputePipeline *pipeline = FindOrCreate(createInfo);
+        if (!pipeline) [[unlikely]]
+        {
+            return Fail<SDL_GPUComputePipeline *>(location);
+        }
+        return pipeline;
+    }
+
+    // Gives the shader an ID that stays the same across runs, e.g. a hash of its code,
+    // so graphics pipelines using it can be saved and prebuilt.
+    void RegisterShader(Uint32 id, SDL_GPUShader *shader)
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        m_shaderIDs[shader] = id;
+        m_shaders[id] = shader;
+    }
+
+    Result<void> Save(SDL_Storage *storage, const char *path,
+                      Location location = Location::current())
+    {
+        Key manifest;
+        AppendContentKey(manifest, ManifestMagic);
+        {
+            LockedMutex lock = ScopedLock(m_mutex);
+            for (const auto &[key, pipeline] : m_graphics)
+            {
+                Key entry = key;
+                if (pipeline && Properties(entry) == 0 && ToShaderID(entry, 0) &&
+                    ToShaderID(entry, sizeof(Uint64)))
+                {
+                    AppendEntry(manifest, GraphicsEntry, entry);
+                }
+            }
+            for (const auto &[key, pipeline] : m_compute)
+            {
+                if (pipeline && Properties(key) == 0)
+                {
+                    AppendEntry(manifest, ComputeEntry, key);
+                }
+            }
+        }
+
+        if (!SDL_WriteStorageFile(storage, path, manifest.data(), manifest.size())) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        return Success();
+    }
+
+    // Creates the pipelines saved in path on the threads of pool, which must not run another
+    // job meanwhile, and returns how many of them were created.
+    Result<int> Prebuild(SDL_Storage *storage, const char *path, WorkerPool &pool,
+                         Location location = Location::current())
+    {
+        Uint64 size = 0;
+        if (!SDL_GetStorageFileSize(storage, path, &size)) [[unlikely]]
+        {
+            return Fail<int>(location);
+        }
+        Key manifest(size, '\0');
+        if (!SDL_ReadStorageFile(storage, path, manifest.data(), size)) [[unlikely]]
+        {
+            return Fail<int>(location);
+        }
+
+        PrebuildJobs jobs{this, {}};
+        Reader reader{manifest};
+        Uint32 magic = 0;
+        reader.Read(magic);
+        while (reader.ok && magic == ManifestMagic && reader.Remaining() > 0)
+        {
+            Entry entry;
+            reader.Read(entry.kind);
+            reader.ReadArray(entry.key);
+            bool resolved = entry.kind == ComputeEntry ||
+                            (FromShaderID(entry.key, 0) && FromShaderID(entry.key, sizeof(Uint64)));
+            if (reader.ok && resolved)
+            {
+                jobs.entries.push_back(std::move(entry));
+            }
+        }
+        if (!reader.ok || magic != ManifestMagic) [[unlikely]]
+        {
+            SDL_SetError("%s is not a valid pipeline cache manifest", path);
+            return Fail<int>(location);
+        }
+
+        // A pipeline that fails to build is only left out of the count, and created on demand.
+        pool.Run(
+            int(jobs.entries.size()),
+            [](void *userdata, int part) {
+                PrebuildJobs &jobs = *static_cast<PrebuildJobs *>(userdata);
+                if (jobs.cache->Build(jobs.entries[part]))
+                {
+                    SDL_AddAtomicInt(&jobs.built, 1);
+                }
+                return true;
+            },
+            &jobs);
+        return SDL_GetAtomicInt(&jobs.built);
+    }
+
+    size_t Size()
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        return m_graphics.size() + m_compute.size() - m_creating;
+    }
+
+  private:
+    using Key = std::string;
+
+    template <class T> using Map = std::unordered_map<Key, T *, ContentKeyHash>;
+
+    struct Entry
+    {
+        Uint8 kind;
+        Key key;
+    };
+
+    struct PrebuildJobs
+    {
+        GPUPipelineCache *cache;
+        std::vector<Entry> entries;
+        SDL_AtomicInt built{};
+    };
+
+    // Reads back what AppendContentKey() wrote. Any read past the end clears ok.
+    struct Reader
+    {
+        const Key &data;
+        size_t offset = 0;
+        bool ok = true;
+
+        size_t Remaining() const
+        {
+            return data.size() - offset;
+        }
+
+        template <class T> void Read(T *values, size_t count)
+        {
+            if (!ok || Remaining() / sizeof(T) < count)
+            {
+                ok = false;
+                return;
+            }
+            std::memcpy(values, data.data() + offset, sizeof(T) * count);
+            offset += sizeof(T) * count;
+        }
+
+        template <class T> void Read(T &value)
+        {
+            Read(&value, 1);
+        }
+
+        // Reads an element count followed by the elements.
+        template <class T> void ReadArray(T &values)
+        {
+            Uint32 count = 0;
+            Read(count);
+            if (ok && Remaining() / sizeof(values[0]) >= count)
+            {
+                values.resize(count);
+                Read(values.data(), count);
+            }
+            else
+            {
+                ok = false;
+            }
+        }
+    };
+
+    static constexpr Uint32 ManifestMagic = 0x31435050; // "PPC1"
+    static constexpr Uint8 GraphicsEntry = 'G';
+    static constexpr Uint8 ComputeEntry = 'C';
+
+    static void AppendEntry(Key &manifest, Uint8 kind, const Key &key)
+    {
+        AppendContentKey(manifest, kind);
+        AppendContentKey(manifest, Uint32(key.size()));
+        manifest.append(key);
+    }
+
+    // Shaders are the first two fields of a graphics key, and properties the last field
+    // of every key.
+    static Key GraphicsKey(const SDL_GPUGraphicsPipelineCreateInfo &info)
+    {
+        const SDL_GPUVertexInputState &input = info.vertex_input_state;
+        const SDL_GPUGraphicsPipelineTargetInfo &target = info.target_info;
+        Key key;
+        AppendContentKey(key, Uint64(uintptr_t(info.vertex_shader)));
+        AppendContentKey(key, Uint64(uintptr_t(info.fragment_shader)));
+        AppendContentKey(key, input.num_vertex_buffers);
+        AppendContentKey(key, input.vertex_buffer_descriptions, input.num_vertex_buffers);
+        AppendContentKey(key, input.num_vertex_attributes);
+        AppendContentKey(key, input.vertex_attributes, input.num_vertex_attributes);
+        AppendContentKey(key, info.primitive_type);
+        AppendContentKey(key, info.rasterizer_state);
+        AppendContentKey(key, info.multisample_state);
+        AppendContentKey(key, info.depth_stencil_state);
+        AppendContentKey(key, target.num_color_targets);
+        AppendContentKey(key, target.color_target_descriptions, target.num_color_targets);
+        AppendContentKey(key, target.depth_stencil_format);
+        AppendContentKey(key, target.has_depth_stencil_target);
+        AppendContentKey(key, info.props);
+        return key;
+    }
+
+    static Key ComputeKey(const SDL_GPUComputePipelineCreateInfo &info)
+    {
+        Uint32 entrypointSize = Uint32(std::strlen(info.entrypoint) + 1);
+        Key key;
+        AppendContentKey(key, Uint32(info.code_size));
+        AppendContentKey(key, info.code, info.code_size);
+        AppendContentKey(key, entrypointSize);
+        AppendContentKey(key, info.entrypoint, entrypointSize);
+        AppendContentKey(key, info.format);
+        AppendContentKey(key, info.num_samplers);
+        AppendContentKey(key, info.num_readonly_storage_textures);
+        AppendContentKey(key, info.num_readonly_storage_buffers);
+        AppendContentKey(key, info.num_readwrite_storage_textures);
+        AppendContentKey(key, info.num_readwrite_storage_buffers);
+        AppendContentKey(key, info.num_uniform_buffers);
+        AppendContentKey(key, info.threadcount_x);
+        AppendContentKey(key, info.threadcount_y);
+        AppendContentKey(key, info.threadcount_z);
+        AppendContentKey(key, info.props);
+        return key;
+    }
+
+    static SDL_PropertiesID Properties(const Key &key)
+    {
+        SDL_PropertiesID props = 0;
+        std::memcpy(&props, key.data() + key.size() - sizeof(props), sizeof(props));
+        return props;
+    }
+
+    // Replaces the shader pointer at offset in a graphics key with its registered ID.
+    bool ToShaderID(Key &key, size_t offset) const
+    {
+        Uint64 shader = 0;
+        std::memcpy(&shader, key.data() + offset, sizeof(shader));
+        auto it = m_shaderIDs.find(reinterpret_cast<SDL_GPUShader *>(uintptr_t(shader)));
+        if (it == m_shaderIDs.end())
+        {
+            return false;
+        }
+        Uint64 id = it->second;
+        std::memcpy(key.data() + offset, &id, sizeof(id));
+        return true;
+    }
+
+    bool FromShaderID(Key &key, size_t offset)
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        Uint64 id = 0;
+        if (key.size() < offset + sizeof(id))
+        {
+            return false;
+        }
+        std::memcpy(&id, key.data() + offset, sizeof(id));
+        auto it = m_shaders.find(Uint32(id));
+        if (it == m_shaders.end())
+        {
+            return false;
+        }
+        Uint64 shader = uintptr_t(it->second);
+        std::memcpy(key.data() + offset, &shader, sizeof(shader));
+        return true;
+    }
+
+    // Returns the pipeline for key, waiting while another thread creates it. Otherwise
+    // returns nullptr, with key entered as being created by the calling thread.
+    template <class T> T *FindOrReserve(Map<T> &map, const Key &key)
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        for (;;)
+        {
+            auto [it, inserted] = map.try_emplace(key, nullptr);
+            if (inserted)
+            {
+                ++m_creating;
+                return nullptr;
+            }
+            if (it->second)
+            {
+                return it->second;
+            }
+            SDL_WaitCondition(m_created.get(), m_mutex.get());
+        }
+    }
+
+    // Ends the creation FindOrReserve() entered key for. After a failure, the threads
+    // waiting for the pipeline try to create it themselves.
+    template <class T> T *Publish(Map<T> &map, const Key &key, T *pipeline)
+    {
+        {
+            LockedMutex lock = ScopedLock(m_mutex);
+            if (pipeline)
+            {
+                map[key] = pipeline;
+            }
+            else
+            {
+                map.erase(key);
+            }
+            --m_creating;
+        }
+        SDL_BroadcastCondition(m_created.get());
+        return pipeline;
+    }
+
+    // Pipelines are created without holding the lock, so threads creating different pipelines
+    // don't wait on each other. A thread asking for a pipeline being created waits for it.
+    SDL_GPUGraphicsPipeline *FindOrCreate(const SDL_GPUGraphicsPipelineCreateInfo &createInfo)
+    {
+        Key key = GraphicsKey(createInfo);
+        if (SDL_GPUGraphicsPipeline *pipeline = FindOrReserve(m_graphics, key))
+        {
+            return pipeline;
+        }
+        return Publish(m_graphics, key, SDL_CreateGPUGraphicsPipeline(m_device, &createInfo));
+    }
+
+    SDL_GPUComputePipeline *FindOrCreate(const SDL_GPUComputePipelineCreateInfo &createInfo)
+    {
+        Key key = ComputeKey(createInfo);
+        if (SDL_GPUComputePipeline *pipeline = FindOrReserve(m_compute, key))
+        {
+            return pipeline;
+        }
+        return Publish(m_compute, key, SDL_CreateGPUComputePipeline(m_device, &createInfo));
+    }
+
+    // Creates the pipeline of a manifest entry, with its shader IDs already replaced.
+    bool Build(const Entry &entry)
+    {
+        Reader reader{entry.key};
+        if (entry.kind == GraphicsEntry)
+        {
+            std::vector<SDL_GPUVertexBufferDescription> vertexBuffers;
+            std::vector<SDL_GPUVertexAttribute> vertexAttributes;
+            std::vector<SDL_GPUColorTargetDescription> colorTargets;
+            SDL_GPUGraphicsPipelineCreateInfo info{};
+            Uint64 vertexShader = 0;
+            Uint64 fragmentShader = 0;
+            reader.Read(vertexShader);
+            reader.Read(fragmentShader);
+            reader.ReadArray(vertexBuffers);
+            reader.ReadArray(vertexAttributes);
+            reader.Read(info.primitive_type);
+            reader.Read(info.rasterizer_state);
+            reader.Read(info.multisample_state);
+            reader.Read(info.depth_stencil_state);
+            reader.ReadArray(colorTargets);
+            reader.Read(info.target_info.depth_stencil_format);
+            reader.Read(info.target_info.has_depth_stencil_target);
+            reader.Read(info.props);
+            if (!reader.ok || reader.Remaining() != 0)
+            {
+                return false;
+            }
+            info.vertex_shader = reinterpret_cast<SDL_GPUShader *>(uintptr_t(vertexShader));
+            info.fragment_shader = reinterpret_cast<SDL_GPUShader *>(uintptr_t(fragmentShader));
+            info.vertex_input_state = {vertexBuffers.data(), Uint32(vertexBuffers.size()),
+                                       vertexAttributes.data(), Uint32(vertexAttributes.size())};
+            info.target_info.color_target_descriptions = colorTargets.data();
+            info.target_info.num_color_targets = Uint32(colorTargets.size());
+            return FindOrCreate(info) != nullptr;
+        }
+
+        std::vector<Uint8> code;
+        std::vector<char> entrypoint;
+        SDL_GPUComputePipelineCreateInfo info{};
+        reader.ReadArray(code);
+        reader.ReadArray(entrypoint);
+        reader.Read(info.format);
+        reader.Read(info.num_samplers);
+        reader.Read(info.num_readonly_storage_textures);
+        reader.Read(info.num_readonly_storage_buffers);
+        reader.Read(info.num_readwrite_storage_textures);
+        reader.Read(info.num_readwrite_storage_buffers);
+        reader.Read(info.num_uniform_buffers);
+        reader.Read(info.threadcount_x);
+        reader.Read(info.threadcount_y);
+        reader.Read(info.threadcount_z);
+        reader.Read(info.props);
+        if (!reader.ok || reader.Remaining() != 0 || entrypoint.empty() || entrypoint.back() != 0)
+        {
+            return false;
+        }
+        info.code_size = code.size();
+        info.code = code.data();
+        info.entrypoint = entrypoint.data();
+        return FindOrCreate(info) != nullptr;
+    }
+
+    SDL_GPUDevice *m_device;
+    Mutex m_mutex;
+    Condition m_created;
+    // A null pipeline is being created by some thread.
+    Map<SDL_GPUGraphicsPipeline> m_graphics;
+    Map<SDL_GPUComputePipeline> m_compute;
+    size_t m_creating = 0;
+    std::unordered_map<SDL_GPUShader *, Uint32> m_shaderIDs;
+    std::unordered_map<Uint32, SDL_GPUShader *> m_shaders;
+};
+
+// How GPUObjectCache keys and creates objects of type T.
+template <class T> struct GPUObjectTraits;
+
+template <> struct GPUObjectTraits<SDL_GPUSampler>
+{
+    using CreateInfo = SDL_GPUSamplerCreateInfo;
+
+    // The create info has explicit padding fields, so it can be keyed as a whole.
+    static std::string Key(const CreateInfo &createInfo)
+    {
+        std::string key;
+        AppendContentKey(key, createInfo);
+        return key;
+    }
+
+    static SDL_GPUSampler *Create(SDL_GPUDevice *device, const CreateInfo &createInfo)
+    {
+        return SDL_CreateGPUSampler(device, &createInfo);
+    }
+};
+
+template <> struct GPUObjectTraits<SDL_GPUShader>
+{
+    using CreateInfo = SDL_GPUShaderCreateInfo;
+
+    static std::string Key(const CreateInfo &createInfo)
+    {
+        std::string key;
+        AppendContentKey(key, Uint64(createInfo.code_size));
+        AppendContentKey(key, createInfo.code, createInfo.code_size);
+        AppendContentKey(key, createInfo.entrypoint, std::strlen(createInfo.entrypoint) + 1);
+        AppendContentKey(key, createInfo.format);
+        AppendContentKey(key, createInfo.stage);
+        AppendContentKey(key, createInfo.num_samplers);
+        AppendContentKey(key, createInfo.num_storage_textures);
+        AppendContentKey(key, createInfo.num_storage_buffers);
+        AppendContentKey(key, createInfo.num_uniform_buffers);
+        AppendContentKey(key, createInfo.props);
+        return key;
+    }
+
+    static SDL_GPUShader *Create(SDL_GPUDevice *device, const CreateInfo &createInfo)
+    {
+        return SDL_CreateGPUShader(device, &createInfo);
+    }
+};
+
+// Interns GPU objects: while a handle to an object is alive, creating one from an equal
+// create info returns that same object instead of a duplicate. The object is released
+// with its last handle. Safe to use from multiple threads.
+template <class T> struct GPUObjectCache
+{
+    using CreateInfo = typename GPUObjectTraits<T>::CreateInfo;
+    using Handle = std::shared_ptr<const DeviceOwned<T>>;
+
+    explicit GPUObjectCache(SDL_GPUDevice *device, Location location = Location::current())
+        : m_device{device}, m_mutex{CreateGuardMutex(location)} {};
+    GPUObjectCache(const GPUObjectCache &) = delete;
+
+    GPUObjectCache &operator=(const GPUObjectCache &) = delete;
+
+    Result<Handle> Get(const CreateInfo &createInfo, Location location = Location::current())
+    {
+        std::string key = GPUObjectTraits<T>::Key(createInfo);
+        LockedMutex lock = ScopedLock(m_mutex);
+        std::weak_ptr<const DeviceOwned<T>> &entry = m_objects[key];
+        if (Handle handle = entry.lock())
+        {
+            ++m_hits;
+            return handle;
+        }
+
+        T *object = GPUObjectTraits<T>::Create(m_device, createInfo);
+        if (!object) [[unlikely]]
+        {
+            m_objects.erase(key);
+            return Fail<Handle>(location);
+        }
+        ++m_misses;
+        Handle handle = std::make_shared<const DeviceOwned<T>>(m_device, object);
+        entry = handle;
+        return handle;
+    }
+
+    // Forgets the keys of objects whose handles are all gone.
+    void Prune()
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        std::erase_if(m_objects, [](const auto &entry) { return entry.second.expired(); });
+    }
+
+    // Number of calls to Get() that returned an existing object.
+    Uint64 Hits()
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        return m_hits;
+    }
+
+    // Number of calls to Get() that created an object.
+    Uint64 Misses()
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        return m_misses;
+    }
+
+  private:
+    SDL_GPUDevice *m_device;
+    Mutex m_mutex;
+    std::unordered_map<std::string, std::weak_ptr<const DeviceOwned<T>>, ContentKeyHash> m_objects;
+    Uint64 m_hits = 0;
+    Uint64 m_misses = 0;
+};
+
+using GPUSamplerCache = GPUObjectCache<SDL_GPUSampler>;
+using GPUShaderCache = GPUObjectCache<SDL_GPUShader>;
+
+// Records GPU passes on the threads of a WorkerPool, each pass into its own command buffer, and
+// submits the command buffers so that every pass comes after the passes it depends on. Each
+// command buffer is acquired, recorded and submitted on the same thread, as SDL requires.
+struct GPUCommandRecorder
+{
+    // Records a pass into commandBuffer, without submitting it. Returns false with the SDL error
+    // set on failure, and the command buffer is then canceled, so it must not fail once it has
+    // acquired a swapchain texture.
+    using RecordFunction = bool (*)(void *userdata, SDL_GPUCommandBuffer *commandBuffer);
+    using PassID = int;
+
+    // What a failed AddPass() returns under SDL_HPP_ERROR_CALLBACK, where 0 is the first pass.
+    // A pass depending on it fails to be added in turn.
+    static constexpr PassID InvalidPass = -1;
+
+    // pool must outlive the recorder, and not run another job during Execute().
+    GPUCommandRecorder(SDL_GPUDevice *device, WorkerPool &pool,
+                       Location location = Location::current())
+        : m_device{device}, m_pool{pool}, m_mutex{CreateGuardMutex(location)},
+          m_submitted{SDL_CreateCondition()}
+    {
+        if (!m_submitted) [[unlikely]]
+        {
+            FailConstruction(location);
+        }
+    }
+    GPUCommandRecorder(const GPUCommandRecorder &) = delete;
+
+    GPUCommandRecorder &operator=(const GPUCommandRecorder &) = delete;
+
+    // Adds a pass to the next Execute(). dependencies must be passes added before it.
+    Result<PassID> AddPass(RecordFunction record, void *userdata,
+                           std::initializer_list<PassID> dependencies = {},
+                           Location location = Location::current())
+    {
+        PassID id = PassID(m_passes.size());
+        for (PassID dependency : dependencies)
+        {
+            if (dependency < 0 || dependency >= id) [[unlikely]]
+            {
+                SDL_SetError("Pass %d depends on unknown pass %d", id, dependency);
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_CALLBACK
+                (void)Fail<PassID>(location);
+                return InvalidPass;
+#else
+                return Fail<PassID>(location);
+#endif
+            }
+        }
+        m_passes.push_back({record, userdata, dependencies, false});
+        return id;
+    }
+
+    // Records and submits all added passes, and returns once all of them are submitted or
+    // canceled. Fails with the error of the first pass that failed to record or submit.
+    Result<void> Execute(Location location = Location::current())
+    {
+        // The pool takes passes in the order they were added, so a pass waiting for its
+        // dependencies only ever waits for passes already taken by another thread, which
+        // can't deadlock.
+        bool submitted = m_pool.Run(
+            int(m_passes.size()),
+            [](void *userdata, int pass) {
+                GPUCommandRecorder *recorder = static_cast<GPUCommandRecorder *>(userdata);
+                return recorder->RunPass(recorder->m_passes[pass]);
+            },
+            this);
+        m_passes.clear();
+        if (!submitted) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        return Success();
+    }
+
+  private:
+    struct Pass
+    {
+        RecordFunction record;
+        void *userdata;
+        std::vector<PassID> dependencies;
+        bool submitted;
+    };
+
+    bool RunPass(Pass &pass)
+    {
+        SDL_GPUCommandBuffer *commandBuffer = SDL_AcquireGPUCommandBuffer(m_device);
+        bool recorded = commandBuffer && pass.record(pass.userdata, commandBuffer);
+        if (commandBuffer && !recorded) [[unlikely]]
+        {
+            // Keeps the error of the pass, not that of canceling.
+            std::string error = SDL_GetError();
+            SDL_CancelGPUCommandBuffer(commandBuffer);
+            SDL_SetError("%s", error.c_str());
+        }
+
+        LockedMutex lock = ScopedLock(m_mutex);
+        for (PassID dependency : pass.dependencies)
+        {
+            while (!m_passes[dependency].submitted)
+            {
+                SDL_WaitCondition(m_submitted.get(), m_mutex.get());
+            }
+        }
+        bool submitted = recorded && SDL_SubmitGPUCommandBuffer(commandBuffer);
+        // Also set when failing, so the dependent passes don't wait forever.
+        pass.submitted = true;
+        SDL_BroadcastCondition(m_submitted.get());
+        return submitted;
+    }
+
+    SDL_GPUDevice *m_device;
+    WorkerPool &m_pool;
+    Mutex m_mutex;
+    Condition m_submitted;
+    std::vector<Pass> m_passes;
+};
+
+// Owns a render pass begun with sdl::BeginGPURenderPass, and ends it when going out of scope.
+// Shadows the state bound through it, skipping calls that wouldn't change anything and
+// narrowing slot bindings to the slots that changed. Slots from MaxSlots on aren't shadowed.
+struct RenderPass
+{
+    static constexpr Uint32 MaxSlots = 16;
+
+    explicit RenderPass(SDL_GPURenderPass *renderPass) : m_renderPass{renderPass} {};
+    RenderPass(const RenderPass &) = delete;
+
+    RenderPass &operator=(const RenderPass &) = delete;
+
+    ~RenderPass()
+    {
+        End();
+    }
+
+    SDL_GPURenderPass *Get() const
+    {
+        return m_renderPass;
+    }
+
+    void End()
+    {
+        if (m_renderPass)
+        {
+            SDL_EndGPURenderPass(m_renderPass);
+            m_renderPass = nullptr;
+        }
+    }
+
+    void BindGraphicsPipeline(SDL_GPUGraphicsPipeline *pipeline)
+    {
+        if (Update(m_pipeline, pipeline))
+        {
+            SDL_BindGPUGraphicsPipeline(m_renderPass, pipeline);
+        }
+    }
+
+    void SetViewport(const SDL_GPUViewport &viewport)
+    {
+        if (Update(m_viewport, viewport))
+        {
+            SDL_SetGPUViewport(m_renderPass, &viewport);
+        }
+    }
+
+    void SetScissor(const SDL_Rect &scissor)
+    {
+        if (Update(m_scissor, scissor))
+        {
+            SDL_SetGPUScissor(m_renderPass, &scissor);
+        }
+    }
+
+    void SetBlendConstants(SDL_FColor blendConstants)
+    {
+        if (Update(m_blendConstants, blendConstants))
+        {
+            SDL_SetGPUBlendConstants(m_renderPass, blendConstants);
+        }
+    }
+
+    void SetStencilReference(Uint8 reference)
+    {
+        if (Update(m_stencilReference, reference))
+        {
+            SDL_SetGPUStencilReference(m_renderPass, reference);
+        }
+    }
+
+    void BindVertexBuffers(Uint32 firstSlot, const SDL_GPUBufferBinding *bindings,
+                           Uint32 numBindings)
+    {
+        BindSlots(m_vertexBuffers, firstSlot, bindings, numBindings, SDL_BindGPUVertexBuffers);
+    }
+
+    void BindIndexBuffer(const SDL_GPUBufferBinding &binding, SDL_GPUIndexElementSize size)
+    {
+        if (Update(m_indexBuffer, IndexBinding{binding, size}))
+        {
+            SDL_BindGPUIndexBuffer(m_renderPass, &binding, size);
+        }
+    }
+
+    void BindVertexSamplers(Uint32 firstSlot, const SDL_GPUTextureSamplerBinding *bindings,
+                            Uint32 numBindings)
+    {
+        BindSlots(m_vertexSamplers, firstSlot, bindings, numBindings, SDL_BindGPUVertexSamplers);
+    }
+
+    void BindVertexStorageTextures(Uint32 firstSlot, SDL_GPUTexture *const *textures,
+                                   Uint32 numBindings)
+    {
+        BindSlots(m_vertexStorageTextures, firstSlot, textures, numBindings,
+                  SDL_BindGPUVertexStorageTextures);
+    }
+
+    void BindVertexStorageBuffers(Uint32 firstSlot, SDL_GPUBuffer *const *buffers,
+                                  Uint32 numBindings)
+    {
+        BindSlots(m_vertexStorageBuffers, firstSlot, buffers, numBindings,
+                  SDL_BindGPUVertexStorageBuffers);
+    }
+
+    void BindFragmentSamplers(Uint32 firstSlot, const SDL_GPUTextureSamplerBinding *bindings,
+                              Uint32 numBindings)
+    {
+        BindSlots(m_fragmentSamplers, firstSlot, bindings, numBindings,
+                  SDL_BindGPUFragmentSamplers);
+    }
+
+    void BindFragmentStorageTextures(Uint32 firstSlot, SDL_GPUTexture *const *textures,
+                                     Uint32 numBindings)
+    {
+        BindSlots(m_fragmentStorageTextures, firstSlot, textures, numBindings,
+                  SDL_BindGPUFragmentStorageTextures);
+    }
+
+    void BindFragmentStorageBuffers(Uint32 firstSlot, SDL_GPUBuffer *const *buffers,
+                                    Uint32 numBindings)
+    {
+        BindSlots(m_fragmentStorageBuffers, firstSlot, buffers, numBindings,
+                  SDL_BindGPUFragmentStorageBuffers);
+    }
+
+    // Number of bind and set calls passed on to SDL.
+    Uint32 Issued() const
+    {
+        return m_issued;
+    }
+
+    // Number of bind and set calls skipped because they wouldn't have changed anything.
+    Uint32 Elided() const
+    {
+        return m_elided;
+    }
+
+  private:
+    template <class T>
+    using BindFunction = void (*)(SDL_GPURenderPass *, Uint32, const T *, Uint32);
+
+    struct IndexBinding
+    {
+        SDL_GPUBufferBinding binding;
+        SDL_GPUIndexElementSize size;
+    };
+
+    static bool Same(const IndexBinding &a, const IndexBinding &b)
+    {
+        return Same(a.binding, b.binding) && a.size == b.size;
+    }
+
+    static bool Same(const SDL_GPUBufferBinding &a, const SDL_GPUBufferBinding &b)
+    {
+        return a.buffer == b.buffer && a.offset == b.offset;
+    }
+
+    static bool Same(const SDL_GPUTextureSamplerBinding &a, const SDL_GPUTextureSamplerBinding &b)
+    {
+        return a.texture == b.texture && a.sampler == b.sampler;
+    }
+
+    // For types without padding.
+    template <class T> static bool Same(const T &a, const T &b)
+    {
+        return std::memcmp(&a, &b, sizeof(T)) == 0;
+    }
+
+    // Returns whether the call setting value needs to be issued, counting it.
+    template <class T> bool Update(std::optional<T> &shadow, const T &value)
+    {
+        if (shadow && Same(*shadow, value))
+        {
+            ++m_elided;
+            return false;
+        }
+        shadow = value;
+        ++m_issued;
+        return true;
+    }
+
+    template <class T>
+    void BindSlots(std::optional<T> (&shadow)[MaxSlots], Uint32 firstSlot, const T *bindings,
+                   Uint32 numBindings, BindFunction<T> bind)
+    {
+        if (firstSlot >= MaxSlots || numBindings > MaxSlots - firstSlot)
+        {
+            for (Uint32 slot = firstSlot; slot < MaxSlots; ++slot)
+            {
+                shadow[slot] = bindings[slot - firstSlot];
+            }
+            bind(m_renderPass, firstSlot, bindings, numBindings);
+            ++m_issued;
+            return;
+        }
+
+        Uint32 first = numBindings;
+        Uint32 last = 0;
+        for (Uint32 i = 0; i < numBindings; ++i)
+        {
+            std::optional<T> &slot = shadow[firstSlot + i];
+            if (!slot || !Same(*slot, bindings[i]))
+            {
+                slot = bindings[i];
+                first = first < i ? first : i;
+                last = i;
+            }
+        }
+        if (first == numBindings)
+        {
+            ++m_elided;
+            return;
+        }
+        bind(m_renderPass, firstSlot + first, bindings + first, last - first + 1);
+        ++m_issued;
+    }
+
+    SDL_GPURenderPass *m_renderPass;
+    std::optional<SDL_GPUGraphicsPipeline *> m_pipeline;
+    std::optional<SDL_GPUViewport> m_viewport;
+    std::optional<SDL_Rect> m_scissor;
+    std::optional<SDL_FColor> m_blendConstants;
+    std::optional<Uint8> m_stencilReference;
+    std::optional<IndexBinding> m_indexBuffer;
+    std::optional<SDL_GPUBufferBinding> m_vertexBuffers[MaxSlots];
+    std::optional<SDL_GPUTextureSamplerBinding> m_vertexSamplers[MaxSlots];
+    std::optional<SDL_GPUTexture *> m_vertexStorageTextures[MaxSlots];
+    std::optional<SDL_GPUBuffer *> m_vertexStorageBuffers[MaxSlots];
+    std::optional<SDL_GPUTextureSamplerBinding> m_fragmentSamplers[MaxSlots];
+    std::optional<SDL_GPUTexture *> m_fragmentStorageTextures[MaxSlots];
+    std::optional<SDL_GPUBuffer *> m_fragmentStorageBuffers[MaxSlots];
+    Uint32 m_issued = 0;
+    Uint32 m_elided = 0;
+};
+
+// An upload transfer buffer, and optionally a GPU buffer it is copied to, that grow by
+// doubling to fit what is mapped. Replaced buffers are released right away, which SDL defers
+// until the GPU is done with them.
+struct GPUGrowableBuffer
+{
+    // Without usage, there's only the transfer buffer.
+    GPUGrowableBuffer(SDL_GPUDevice *device, SDL_GPUBufferUsageFlags usage,
+                      Uint32 initialCapacity)
+        : m_device{device}, m_usage{usage}, m_initialCapacity{initialCapacity} {};
+    GPUGrowableBuffer(const GPUGrowableBuffer &) = delete;
+
+    GPUGrowableBuffer &operator=(const GPUGrowableBuffer &) = delete;
+
+    ~GPUGrowableBuffer()
+    {
+        SDL_ReleaseGPUBuffer(m_device, m_buffer);
+        SDL_ReleaseGPUTransferBuffer(m_device, m_transferBuffer);
+    }
+
+    // Maps size bytes of the transfer buffer, cycling it. Returns nullptr on failure.
+    void *Map(Uint32 size)
+    {
+        return Reserve(size) ? SDL_MapGPUTransferBuffer(m_device, m_transferBuffer, true)
+                             : nullptr;
+    }
+
+    void Unmap()
+    {
+        SDL_UnmapGPUTransferBuffer(m_device, m_transferBuffer);
+    }
+
+    // Copies the first size bytes of the transfer buffer to the GPU buffer, cycling it.
+    void Upload(SDL_GPUCopyPass *copyPass, Uint32 size)
+    {
+        SDL_GPUTransferBufferLocation source{m_transferBuffer, 0};
+        SDL_GPUBufferRegion destination{m_buffer, 0, size};
+        SDL_UploadToGPUBuffer(copyPass, &source, &destination, true);
+    }
+
+    SDL_GPUBuffer *Buffer() const
+    {
+        return m_buffer;
+    }
+
+    SDL_GPUTransferBuffer *TransferBuffer() const
+    {
+        return m_transferBuffer;
+    }
+
+  private:
+    bool Reserve(Uint32 size)
+    {
+        if (size <= m_capacity)
+        {
+            return true;
+        }
+        Uint32 capacity = m_capacity ? m_capacity : m_initialCapacity;
+        while (capacity < size)
+        {
+            capacity *= 2;
+        }
+
+        SDL_ReleaseGPUBuffer(m_device, m_buffer);
+        SDL_ReleaseGPUTransferBuffer(m_device, m_transferBuffer);
+        m_buffer = nullptr;
+        m_capacity = 0;
+        if (m_usage)
+        {
+            SDL_GPUBufferCreateInfo bufferInfo{};
+            bufferInfo.usage = m_usage;
+            bufferInfo.size = capacity;
+            m_buffer = SDL_CreateGPUBuffer(m_device, &bufferInfo);
+        }
+        SDL_GPUTransferBufferCreateInfo transferInfo{};
+        transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        transferInfo.size = capacity;
+        m_transferBuffer = SDL_CreateGPUTransferBuffer(m_device, &transferInfo);
+        if ((m_usage && !m_buffer) || !m_transferBuffer)
+        {
+            return false;
+        }
+        m_capacity = capacity;
+        return true;
+    }
+
+    SDL_GPUDevice *m_device;
+    SDL_GPUBufferUsageFlags m_usage;
+    Uint32 m_initialCapacity;
+    SDL_GPUBuffer *m_buffer = nullptr;
+    SDL_GPUTransferBuffer *m_transferBuffer = nullptr;
+    Uint32 m_capacity = 0;
+};
+
+// Sorts indexed draws by a key and issues them through an sdl::RenderPass, which skips the
+// binds that didn't change. Consecutive draws sharing all their state are merged into one
+// SDL_DrawGPUIndexedPrimitivesIndirect. Add() the draws, upload their indirect commands
+// with Prepare() during a copy pass, then issue them with Draw() during the render pass.
+struct GPUDrawQueue
+{
+    struct DrawPacket
+    {
+        // Draws are issued in ascending key order, and in the order they were added for
+        // equal keys. Putting the pipeline and bindings in the high bits makes draws sharing
+        // them consecutive, so they can be merged.
+        Uint64 key;
+        SDL_GPUGraphicsPipeline *pipeline;
+        SDL_GPUBufferBinding vertexBuffer;
+        SDL_GPUBufferBinding indexBuffer;
+        SDL_GPUIndexElementSize indexElementSize;
+        // Bound if texture isn't null.
+        SDL_GPUTextureSamplerBinding fragmentSampler;
+        SDL_GPUIndexedIndirectDrawCommand command;
+    };
+
+    explicit GPUDrawQueue(SDL_GPUDevice *device)
+        : m_indirectBuffer{device, SDL_GPU_BUFFERUSAGE_INDIRECT, 4096} {};
+    GPUDrawQueue(const GPUDrawQueue &) = delete;
+
+    GPUDrawQueue &operator=(const GPUDrawQueue &) = delete;
+
+    // The uniform data is copied, and pushed to slot 0 before the draw.
+    void Add(const DrawPacket &draw, const void *vertexUniforms = nullptr,
+             Uint32 vertexUniformsSize = 0, const void *fragmentUniforms = nullptr,
+             Uint32 fragmentUniformsSize = 0)
+    {
+        m_sorted.push_back({draw.key, Uint32(m_packets.size())});
+        m_packets.push_back({draw, StoreUniforms(vertexUniforms, vertexUniformsSize),
+                             StoreUniforms(fragmentUniforms, fragmentUniformsSize)});
+    }
+
+    // Sorts the draws, and uploads the commands of the merged ones to the indirect buffer.
+    // If this fails, Draw() issues nothing.
+    Result<void> Prepare(SDL_GPUCopyPass *copyPass, Location location = Location::current())
+    {
+        Sort();
+
+        m_runs.clear();
+        Uint32 numCommands = 0;
+        for (Uint32 i = 0; i < m_sorted.size();)
+        {
+            Uint32 end = i + 1;
+            while (end < m_sorted.size() && SameState(m_packets[m_sorted[i].index],
+                                                      m_packets[m_sorted[end].index]))
+            {
+                ++end;
+            }
+            Uint32 count = end - i;
+            m_runs.push_back({i, count, count > 1 ? numCommands : 0});
+            numCommands += count > 1 ? count : 0;
+            i = end;
+        }
+        if (numCommands == 0)
+        {
+            return Success();
+        }
+
+        Uint32 size = numCommands * Uint32(sizeof(SDL_GPUIndexedIndirectDrawCommand));
+        void *mapped = m_indirectBuffer.Map(size);
+        if (!mapped) [[unlikely]]
+        {
+            m_runs.clear();
+            return Fail<void>(location);
+        }
+        auto *commands = static_cast<SDL_GPUIndexedIndirectDrawCommand *>(mapped);
+        for (const Run &run : m_runs)
+        {
+            for (Uint32 i = 0; run.count > 1 && i < run.count; ++i)
+            {
+                const QueuedDraw &draw = m_packets[m_sorted[run.first + i].index];
+                commands[run.firstCommand + i] = draw.draw.command;
+            }
+        }
+        m_indirectBuffer.Unmap();
+        m_indirectBuffer.Upload(copyPass, size);
+        return Success();
+    }
+
+    // Issues the draws sorted by Prepare(), pushing their uniforms to commandBuffer,
+    // and clears the queue.
+    void Draw(RenderPass &renderPass, SDL_GPUCommandBuffer *commandBuffer)
+    {
+        const QueuedDraw *previous = nullptr;
+        m_drawCalls = 0;
+        for (const Run &run : m_runs)
+        {
+            const QueuedDraw &packet = m_packets[m_sorted[run.first].index];
+            const DrawPacket &draw = packet.draw;
+            renderPass.BindGraphicsPipeline(draw.pipeline);
+            renderPass.BindVertexBuffers(0, &draw.vertexBuffer, 1);
+            renderPass.BindIndexBuffer(draw.indexBuffer, draw.indexElementSize);
+            if (draw.fragmentSampler.texture)
+            {
+                renderPass.BindFragmentSamplers(0, &draw.fragmentSampler, 1);
+            }
+            if (packet.vertexUniforms.size &&
+                (!previous || !SameUniforms(previous->vertexUniforms, packet.vertexUniforms)))
+            {
+                SDL_PushGPUVertexUniformData(commandBuffer, 0, Data(packet.vertexUniforms),
+                                             packet.vertexUniforms.size);
+            }
+            if (packet.fragmentUniforms.size &&
+                (!previous || !SameUniforms(previous->fragmentUniforms, packet.fragmentUniforms)))
+            {
+                SDL_PushGPUFragmentUniformData(commandBuffer, 0, Data(packet.fragmentUniforms),
+                                               packet.fragmentUniforms.size);
+            }
+            previous = &packet;
+
+            if (run.count == 1)
+            {
+                const SDL_GPUIndexedIndirectDrawCommand &command = draw.command;
+                SDL_DrawGPUIndexedPrimitives(renderPass.Get(), command.num_indices,
+                                             command.num_instances, command.first_index,
+                                             command.vertex_offset, command.first_instance);
+            }
+            else
+            {
+                Uint32 offset = run.firstCommand * sizeof(SDL_GPUIndexedIndirectDrawCommand);
+                SDL_DrawGPUIndexedPrimitivesIndirect(renderPass.Get(), m_indirectBuffer.Buffer(),
+                                                     offset, run.count);
+            }
+            ++m_drawCalls;
+        }
+        Clear();
+    }
+
+    void Clear()
+    {
+        m_packets.clear();
+        m_sorted.clear();
+        m_scratch.clear();
+        m_runs.clear();
+        m_uniforms.clear();
+    }
+
+    // Number of draw calls the last Draw() issued.
+    Uint32 DrawCalls() const
+    {
+        return m_drawCalls;
+    }
+
+  private:
+    struct Uniforms
+    {
+        Uint32 offset;
+        Uint32 size;
+    };
+
+    struct QueuedDraw
+    {
+        DrawPacket draw;
+        Uniforms vertexUniforms;
+        Uniforms fragmentUniforms;
+    };
+
+    struct SortEntry
+    {
+        Uint64 key;
+        Uint32 index;
+    };
+
+    // Draws merged into one indirect draw when count > 1.
+    struct Run
+    {
+        Uint32 first;
+        Uint32 count;
+        Uint32 firstCommand;
+    };
+
+    Uniforms StoreUniforms(const void *data, Uint32 size)
+    {
+        Uniforms uniforms{Uint32(m_uniforms.size()), size};
+        m_uniforms.insert(m_uniforms.end(), static_cast<const Uint8 *>(data),
+                          static_cast<const Uint8 *>(data) + size);
+        return uniforms;
+    }
+
+    const Uint8 *Data(Uniforms uniforms) const
+    {
+        return m_uniforms.data() + uniforms.offset;
+    }
+
+    bool SameUniforms(Uniforms a, Uniforms b) const
+    {
+        return a.size == b.size && std::memcmp(Data(a), Data(b), a.size) == 0;
+    }
+
+    bool SameState(const QueuedDraw &a, const QueuedDraw &b) const
+    {
+        const DrawPacket &x = a.draw;
+        const DrawPacket &y = b.draw;
+        return x.pipeline == y.pipeline && x.vertexBuffer.buffer == y.vertexBuffer.buffer &&
+               x.vertexBuffer.offset == y.vertexBuffer.offset &&
+               x.indexBuffer.buffer == y.indexBuffer.buffer &&
+               x.indexBuffer.offset == y.indexBuffer.offset &&
+               x.indexElementSize == y.indexElementSize &&
+               x.fragmentSampler.texture == y.fragmentSampler.texture &&
+               x.fragmentSampler.sampler == y.fragmentSampler.sampler &&
+               SameUniforms(a.vertexUniforms, b.vertexUniforms) &&
+               SameUniforms(a.fragmentUniforms, b.fragmentUniforms);
+    }
+
+    // LSD radix sort on 8-bit digits, which is stable. Digits that are the same in every
+    // key are skipped, so keys only using a few bits take few passes.
+    void Sort()
+    {
+        m_scratch.resize(m_sorted.size());
+        for (int shift = 0; shift < 64 && !m_sorted.empty(); shift += 8)
+        {
+            Uint32 offsets[256] = {};
+            for (const SortEntry &entry : m_sorted)
+            {
+                ++offsets[(entry.key >> shift) & 0xFF];
+            }
+            if (offsets[(m_sorted[0].key >> shift) & 0xFF] == m_sorted.size())
+            {
+                continue;
+            }
+
+            Uint32 offset = 0;
+            for (Uint32 &count : offsets)
+            {
+                Uint32 bucketSize = count;
+                count = offset;
+                offset += bucketSize;
+            }
+            for (const SortEntry &entry : m_sorted)
+            {
+                m_scratch[offsets[(entry.key >> shift) & 0xFF]++] = entry;
+            }
+            m_sorted.swap(m_scratch);
+        }
+    }
+
+    GPUGrowableBuffer m_indirectBuffer;
+    std::vector<QueuedDraw> m_packets;
+    std::vector<SortEntry> m_sorted;
+    std::vector<SortEntry> m_scratch;
+    std::vector<Run> m_runs;
+    std::vector<Uint8> m_uniforms;
+    Uint32 m_drawCalls = 0;
+};
+
+// Packs per-draw uniform data into one storage buffer instead of pushing it per draw.
+// Push() returns the index of the data in the buffer, which the draw passes on to its
+// shader, e.g. as first_instance. Upload() copies everything pushed since the last upload
+// during a copy pass, and BindVertex()/BindFragment() bind the buffer to a render pass.
+struct GPUUniformArena
+{
+    explicit GPUUniformArena(SDL_GPUDevice *device)
+        : m_buffer{device, SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ, 64 * 1024} {};
+    GPUUniformArena(const GPUUniformArena &) = delete;
+
+    GPUUniformArena &operator=(const GPUUniformArena &) = delete;
+
+    // Places the data at a multiple of stride, and returns that multiple, so the shader
+    // can read it as element index of a structured buffer with that stride.
+    Uint32 Push(const void *data, Uint32 size, Uint32 stride)
+    {
+        Uint32 index = Uint32((m_data.size() + stride - 1) / stride);
+        m_data.resize(size_t(index) * stride);
+        m_data.insert(m_data.end(), static_cast<const Uint8 *>(data),
+                      static_cast<const Uint8 *>(data) + size);
+        return index;
+    }
+
+    template <class T> Uint32 Push(const T &uniforms)
+    {
+        return Push(&uniforms, sizeof(T), sizeof(T));
+    }
+
+    // Uploads the data pushed since the last upload, replacing it in the storage buffer.
+    // The upload cycles the buffer, so draws still in flight keep reading the previous data.
+    Result<void> Upload(SDL_GPUCopyPass *copyPass, Location location = Location::current())
+    {
+        if (m_data.empty())
+        {
+            return Success();
+        }
+
+        Uint32 size = Uint32(m_data.size());
+        void *mapped = m_buffer.Map(size);
+        if (!mapped) [[unlikely]]
+        {
+            m_data.clear();
+            return Fail<void>(location);
+        }
+        std::memcpy(mapped, m_data.data(), size);
+        m_buffer.Unmap();
+        m_buffer.Upload(copyPass, size);
+        m_data.clear();
+        return Success();
+    }
+
+    void BindVertex(RenderPass &renderPass, Uint32 slot) const
+    {
+        SDL_GPUBuffer *buffer = m_buffer.Buffer();
+        renderPass.BindVertexStorageBuffers(slot, &buffer, 1);
+    }
+
+    void BindFragment(RenderPass &renderPass, Uint32 slot) const
+    {
+        SDL_GPUBuffer *buffer = m_buffer.Buffer();
+        renderPass.BindFragmentStorageBuffers(slot, &buffer, 1);
+    }
+
+    SDL_GPUBuffer *Buffer() const
+    {
+        return m_buffer.Buffer();
+    }
+
+  private:
+    GPUGrowableBuffer m_buffer;
+    std::vector<Uint8> m_data;
+};
+
+// Packs rectangles into a width x height area, using the skyline bottom-left heuristic.
+// Removed rectangles go to a free list, and later inserts that fit reuse them, so an atlas
+// can keep streaming entries in and out without being repacked.
+struct AtlasPacker
+{
+    AtlasPacker(int width, int height) : m_width{width}, m_height{height}
+    {
+        Clear();
+    }
+
+    // Finds room for a w x h rectangle. Returns false if there's none.
+    bool Insert(int w, int h, SDL_Rect &rect)
+    {
+        if (w <= 0 || h <= 0)
+        {
+            return false;
+        }
+        return InsertIntoFreeList(w, h, rect) || InsertIntoSkyline(w, h, rect);
+    }
+
+    // Makes the room of a rectangle returned by Insert() available again.
+    void Remove(const SDL_Rect &rect)
+    {
+        m_free.push_back(rect);
+    }
+
+    void Clear()
+    {
+        m_skyline.assign(1, {0, 0, m_width});
+        m_free.clear();
+    }
+
+  private:
+    struct Segment
+    {
+        int x;
+        int y;
+        int width;
+    };
+
+    // Best fit by area, splitting the rest of the free rectangle in two.
+    bool InsertIntoFreeList(int w, int h, SDL_Rect &rect)
+    {
+        size_t best = m_free.size();
+        for (size_t i = 0; i < m_free.size(); ++i)
+        {
+            const SDL_Rect &free = m_free[i];
+            if (free.w >= w && free.h >= h &&
+                (best == m_free.size() || free.w * free.h < m_free[best].w * m_free[best].h))
+            {
+                best = i;
+            }
+        }
+        if (best == m_free.size())
+        {
+            return false;
+        }
+
+        SDL_Rect free = m_free[best];
+        m_free[best] = m_free.back();
+        m_free.pop_back();
+        rect = {free.x, free.y, w, h};
+        if (free.w > w)
+        {
+            m_free.push_back({free.x + w, free.y, free.w - w, h});
+        }
+        if (free.h > h)
+        {
+            m_free.push_back({free.x, free.y + h, free.w, free.h - h});
+        }
+        return true;
+    }
+
+    // Returns the y a w x h rectangle would be placed at on the segment, or -1.
+    int Fit(size_t index, int w, int h) const
+    {
+        int x = m_skyline[index].x;
+        if (x + w > m_width)
+        {
+            return -1;
+        }
+        int y = 0;
+        for (size_t i = index; i < m_skyline.size() && m_skyline[i].x < x + w; ++i)
+        {
+            y = y > m_skyline[i].y ? y : m_skyline[i].y;
+        }
+        return y + h <= m_height ? y : -1;
+    }
+
+    bool InsertIntoSkyline(int w, int h, SDL_Rect &rect)
+    {
+        size_t best = m_skyline.size();
+        int bestY = m_height;
+        for (size_t i = 0; i < m_skyline.size(); ++i)
+        {
+            int y = Fit(i, w, h);
+            if (y >= 0 && y < bestY)
+            {
+                best = i;
+                bestY = y;
+            }
+        }
+        if (best == m_skyline.size())
+        {
+            return false;
+        }
+
+        rect = {m_skyline[best].x, bestY, w, h};
+        m_skyline.insert(m_skyline.begin() + best, {rect.x, bestY + h, w});
+
+        // Cut the segments now lying below the new one.
+        size_t i = best + 1;
+        while (i < m_skyline.size() && m_skyline[i].x < rect.x + w)
+        {
+            int overlap = rect.x + w - m_skyline[i].x;
+            if (overlap < m_skyline[i].width)
+            {
+                m_skyline[i].x += overlap;
+                m_skyline[i].width -= overlap;
+                break;
+            }
+            m_skyline.erase(m_skyline.begin() + i);
+        }
+
+        // Merge neighbours of the same height.
+        for (size_t j = 0; j + 1 < m_skyline.size();)
+        {
+            if (m_skyline[j].y == m_skyline[j + 1].y)
+            {
+                m_skyline[j].width += m_skyline[j + 1].width;
+                m_skyline.erase(m_skyline.begin() + j + 1);
+            }
+            else
+            {
+                ++j;
+            }
+        }
+        return true;
+    }
+
+    int m_width;
+    int m_height;
+    std::vector<Segment> m_skyline;
+    std::vector<SDL_Rect> m_free;
+};
+
+// Packs surfaces into an SDL_Texture, which it doesn't own. Insert() returns the rectangle
+// an entry got, and Remove() lets later entries reuse it. padding pixels are left between
+// entries, so filtering doesn't bleed between them.
+struct TextureAtlas
+{
+    explicit TextureAtlas(SDL_Texture *texture, int padding = 1)
+        : m_texture{texture}, m_padding{padding},
+          m_packer{texture->w + padding, texture->h + padding} {};
+    TextureAtlas(const TextureAtlas &) = delete;
+
+    TextureAtlas &operator=(const TextureAtlas &) = delete;
+
+    Result<SDL_Rect> Insert(SDL_Surface *surface, Location location = Location::current())
+    {
+        SDL_Rect rect;
+        if (!m_packer.Insert(surface->w + m_padding, surface->h + m_padding, rect)) [[unlikely]]
+        {
+            SDL_SetError("Texture atlas is full");
+            return Fail<SDL_Rect>(location);
+        }
+        rect.w = surface->w;
+        rect.h = surface->h;
+
+        Surface converted;
+        if (surface->format != m_texture->format || SDL_MUSTLOCK(surface))
+        {
+            converted.reset(SDL_ConvertSurface(surface, m_texture->format));
+            surface = converted.get();
+            if (!surface) [[unlikely]]
+            {
+                Remove(rect);
+                return Fail<SDL_Rect>(location);
+            }
+        }
+        if (!SDL_UpdateTexture(m_texture, &rect, surface->pixels, surface->pitch)) [[unlikely]]
+        {
+            Remove(rect);
+            return Fail<SDL_Rect>(location);
+        }
+        return rect;
+    }
+
+    void Remove(const SDL_Rect &rect)
+    {
+        m_packer.Remove({rect.x, rect.y, rect.w + m_padding, rect.h + m_padding});
+    }
+
+    SDL_Texture *Get() const
+    {
+        return m_texture;
+    }
+
+  private:
+    SDL_Texture *m_texture;
+    int m_padding;
+    AtlasPacker m_packer;
+};
+
+// Packs surfaces into an SDL_GPUTexture, which it doesn't own. Insert() converts a surface
+// to the format matching the texture, and stages it. Upload() copies all staged surfaces
+// to the texture during a copy pass. Entries can be used once that copy pass is submitted.
+struct GPUTextureAtlas
+{
+    // format is the SDL_PixelFormat with the layout of the texture's SDL_GPUTextureFormat,
+    // e.g. SDL_PIXELFORMAT_RGBA32 for SDL_GPU_TEXTUREFORMAT_R8G8B8A8_UNORM.
+    GPUTextureAtlas(SDL_GPUDevice *device, SDL_GPUTexture *texture, int width, int height,
+                    SDL_PixelFormat format, int padding = 1)
+        : m_texture{texture}, m_format{format}, m_padding{padding},
+          m_packer{width + padding, height + padding}, m_transferBuffer{device, 0, 256 * 1024} {};
+    GPUTextureAtlas(const GPUTextureAtlas &) = delete;
+
+    GPUTextureAtlas &operator=(const GPUTextureAtlas &) = delete;
+
+    Result<SDL_Rect> Insert(SDL_Surface *surface, Location location = Location::current())
+    {
+        SDL_Rect rect;
+        if (!m_packer.Insert(surface->w + m_padding, surface->h + m_padding, rect)) [[unlikely]]
+        {
+            SDL_SetError("Texture atlas is full");
+            return Fail<SDL_Rect>(location);
+        }
+        rect.w = surface->w;
+        rect.h = surface->h;
+
+        Surface converted;
+        if (surface->format != m_format || SDL_MUSTLOCK(surface))
+        {
+            converted.reset(SDL_ConvertSurface(surface, m_format));
+            surface = converted.get();
+            if (!surface) [[unlikely]]
+            {
+                Remove(rect);
+                return Fail<SDL_Rect>(location);
+            }
+        }
+
+        size_t rowSize = size_t(surface->w) * SDL_BYTESPERPIXEL(m_format);
+        size_t offset = m_staging.size();
+        m_staging.resize(offset + rowSize * surface->h);
+        for (int y = 0; y < surface->h; ++y)
+        {
+            std::memcpy(m_staging.data() + offset + rowSize * y,
+                        static_cast<const Uint8 *>(surface->pixels) + size_t(surface->pitch) * y,
+                        rowSize);
+        }
+        m_pending.push_back({rect, Uint32(offset)});
+        return rect;
+    }
+
+    // Staged entries that haven't been uploaded yet are dropped.
+    void Remove(const SDL_Rect &rect)
+    {
+        for (size_t i = 0; i < m_pending.size(); ++i)
+        {
+            if (m_pending[i].rect.x == rect.x && m_pending[i].rect.y == rect.y)
+            {
+                m_pending.erase(m_pending.begin() + i);
+                break;
+            }
+        }
+        m_packer.Remove({rect.x, rect.y, rect.w + m_padding, rect.h + m_padding});
+    }
+
+    Result<void> Upload(SDL_GPUCopyPass *copyPass, Location location = Location::current())
+    {
+        if (m_pending.empty())
+        {
+            m_staging.clear();
+            return Success();
+        }
+
+        Uint32 size = Uint32(m_staging.size());
+        void *mapped = m_transferBuffer.Map(size);
+        if (!mapped) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        std::memcpy(mapped, m_staging.data(), size);
+        m_transferBuffer.Unmap();
+
+        // Not cycling the texture, as that would discard the entries already in it.
+        for (const Pending &pending : m_pending)
+        {
+            const SDL_Rect &rect = pending.rect;
+            SDL_GPUTextureTransferInfo source{m_transferBuffer.TransferBuffer(), pending.offset,
+                                              Uint32(rect.w), Uint32(rect.h)};
+            SDL_GPUTextureRegion destination{};
+            destination.texture = m_texture;
+            destination.x = Uint32(rect.x);
+            destination.y = Uint32(rect.y);
+            destination.w = Uint32(rect.w);
+            destination.h = Uint32(rect.h);
+            destination.d = 1;
+            SDL_UploadToGPUTexture(copyPass, &source, &destination, false);
+        }
+        m_pending.clear();
+        m_staging.clear();
+        return Success();
+    }
+
+    SDL_GPUTexture *Get() const
+    {
+        return m_texture;
+    }
+
+  private:
+    struct Pending
+    {
+        SDL_Rect rect;
+        Uint32 offset;
+    };
+
+    SDL_GPUTexture *m_texture;
+    SDL_PixelFormat m_format;
+    int m_padding;
+    AtlasPacker m_packer;
+    GPUGrowableBuffer m_transferBuffer;
+    std::vector<Uint8> m_staging;
+    std::vector<Pending> m_pending;
+};
+
+// Batches textured quads into few SDL_RenderGeometryRaw calls. The vertices are kept as
+// separate position, color and texture coordinate arrays, in the layout SDL_RenderGeometryRaw
+// takes. By default sprites are drawn in order, and a batch is rendered whenever the texture
+// changes. With sortByTexture, sprites are grouped by texture until Flush(), which renders
+// one batch per texture, at the cost of sprites of different textures not overlapping in
+// the order they were drawn.
+struct SpriteBatch
+{
+    explicit SpriteBatch(SDL_Renderer *renderer, bool sortByTexture = false)
+        : m_renderer{renderer}, m_sortByTexture{sortByTexture} {};
+
+    // source is in texels, or nullptr for the whole texture.
+    Result<void> Draw(SDL_Texture *texture, const SDL_FRect *source, const SDL_FRect &destination,
+                      SDL_FColor color = {1, 1, 1, 1}, Location location = Location::current())
+    {
+        Batch *batch = FindBatch(texture);
+        if (!batch)
+        {
+            if (!m_sortByTexture && !Render()) [[unlikely]]
+            {
+                return Fail<void>(location);
+            }
+            batch = AddBatch(texture);
+        }
+
+        float u0 = 0;
+        float v0 = 0;
+        float u1 = 1;
+        float v1 = 1;
+        if (source && texture)
+        {
+            u0 = source->x / texture->w;
+            v0 = source->y / texture->h;
+            u1 = (source->x + source->w) / texture->w;
+            v1 = (source->y + source->h) / texture->h;
+        }
+        float x0 = destination.x;
+        float y0 = destination.y;
+        float x1 = destination.x + destination.w;
+        float y1 = destination.y + destination.h;
+        batch->xy.insert(batch->xy.end(), {x0, y0, x1, y0, x1, y1, x0, y1});
+        batch->uv.insert(batch->uv.end(), {u0, v0, u1, v0, u1, v1, u0, v1});
+        batch->colors.insert(batch->colors.end(), {color, color, color, color});
+        return Success();
+    }
+
+    // Renders all sprites drawn so far.
+    Result<void> Flush(Location location = Location::current())
+    {
+        if (!Render()) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        return Success();
+    }
+
+    // Number of SDL_RenderGeometryRaw calls made so far.
+    Uint32 RenderCalls() const
+    {
+        return m_renderCalls;
+    }
+
+  private:
+    struct Batch
+    {
+        SDL_Texture *texture;
+        std::vector<float> xy;
+        std::vector<SDL_FColor> colors;
+        std::vector<float> uv;
+    };
+
+    Batch *FindBatch(SDL_Texture *texture)
+    {
+        if (!m_sortByTexture)
+        {
+            return m_used && m_batches[0].texture == texture ? &m_batches[0] : nullptr;
+        }
+        for (size_t i = 0; i < m_used; ++i)
+        {
+            if (m_batches[i].texture == texture)
+            {
+                return &m_batches[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // Batches are reused, so their arrays keep their capacity from frame to frame.
+    Batch *AddBatch(SDL_Texture *texture)
+    {
+        if (m_used == m_batches.size())
+        {
+            m_batches.emplace_back();
+        }
+        Batch &batch = m_batches[m_used++];
+        batch.texture = texture;
+        batch.xy.clear();
+        batch.colors.clear();
+        batch.uv.clear();
+        return &batch;
+    }
+
+    bool Render()
+    {
+        bool result = true;
+        for (size_t i = 0; i < m_used; ++i)
+        {
+            const Batch &batch = m_batches[i];
+            int numVertices = int(batch.colors.size());
+            int numIndices = numVertices / 4 * 6;
+            // Every batch uses the same quad indices, so they're only ever appended.
+            for (int quad = int(m_indices.size()) / 6; quad < numVertices / 4; ++quad)
+            {
+                int first = quad * 4;
+                m_indices.insert(m_indices.end(),
+                                 {first, first + 1, first + 2, first, first + 2, first + 3});
+            }
+            result &= SDL_RenderGeometryRaw(m_renderer, batch.texture, batch.xy.data(),
+                                            2 * sizeof(float), batch.colors.data(),
+                                            sizeof(SDL_FColor), batch.uv.data(), 2 * sizeof(float),
+                                            numVertices, m_indices.data(), numIndices,
+                                            sizeof(int));
+            ++m_renderCalls;
+        }
+        m_used = 0;
+        return result;
+    }
+
+    SDL_Renderer *m_renderer;
+    bool m_sortByTexture;
+    std::vector<Batch> m_batches;
+    size_t m_used = 0;
+    std::vector<int> m_indices;
+    Uint32 m_renderCalls = 0;
+};
+
+// Collects points, lines and rectangles per color, and renders each kind with one SDL call
+// per color. Lines continuing where the previous line of the same color ended are joined
+// into one SDL_RenderLines polyline. The remaining, independent lines are rendered together
+// as 1 pixel wide quads with one SDL_RenderGeometry, which may differ from SDL_RenderLine by
+// a pixel along diagonal lines. The primitives are kept until Clear(), so the same batch can
+// be rendered again, e.g. with another camera.
+struct PrimitiveBatch
+{
+    void AddPoint(SDL_FPoint point, SDL_FColor color)
+    {
+        Find(color).points.push_back(point);
+    }
+
+    void AddLine(SDL_FPoint from, SDL_FPoint to, SDL_FColor color)
+    {
+        Bucket &bucket = Find(color);
+        if (bucket.lineStarts.empty() || bucket.linePoints.back().x != from.x ||
+            bucket.linePoints.back().y != from.y)
+        {
+            bucket.lineStarts.push_back(int(bucket.linePoints.size()));
+            bucket.linePoints.push_back(from);
+        }
+        bucket.linePoints.push_back(to);
+    }
+
+    void AddRect(const SDL_FRect &rect, SDL_FColor color)
+    {
+        Find(color).rects.push_back(rect);
+    }
+
+    void AddFillRect(const SDL_FRect &rect, SDL_FColor color)
+    {
+        Find(color).fillRects.push_back(rect);
+    }
+
+    // Renders everything at position * zoom + offset, leaving the draw color as it was.
+    Result<void> Render(SDL_Renderer *renderer, float zoom = 1, SDL_FPoint offset = {0, 0},
+                        Location location = Location::current())
+    {
+        const float pointScale[4] = {zoom, zoom, zoom, zoom};
+        const float pointOffset[4] = {offset.x, offset.y, offset.x, offset.y};
+        const float rectOffset[4] = {offset.x, offset.y, 0, 0};
+
+        float r = 0;
+        float g = 0;
+        float b = 0;
+        float a = 1;
+        bool result = SDL_GetRenderDrawColorFloat(renderer, &r, &g, &b, &a);
+        m_renderCalls = 0;
+        for (const Bucket &bucket : m_buckets)
+        {
+            const SDL_FColor &color = bucket.color;
+            result &= SDL_SetRenderDrawColorFloat(renderer, color.r, color.g, color.b, color.a);
+            if (!bucket.points.empty())
+            {
+                Transform(bucket.points, m_points, pointScale, pointOffset);
+                result &= SDL_RenderPoints(renderer, m_points.data(), int(m_points.size()));
+                ++m_renderCalls;
+            }
+            if (!bucket.linePoints.empty())
+            {
+                Transform(bucket.linePoints, m_points, pointScale, pointOffset);
+                m_vertices.clear();
+                m_indices.clear();
+                for (size_t i = 0; i < bucket.lineStarts.size(); ++i)
+                {
+                    int start = bucket.lineStarts[i];
+                    int end = i + 1 < bucket.lineStarts.size() ? bucket.lineStarts[i + 1]
+                                                               : int(m_points.size());
+                    if (end - start == 2)
+                    {
+                        AddLineQuad(m_points[start], m_points[start + 1], color);
+                    }
+                    else
+                    {
+                        result &= SDL_RenderLines(renderer, m_points.data() + start, end - start);
+                        ++m_renderCalls;
+                    }
+                }
+                if (!m_vertices.empty())
+                {
+                    result &= SDL_RenderGeometry(renderer, nullptr, m_vertices.data(),
+                                                 int(m_vertices.size()), m_indices.data(),
+                                                 int(m_indices.size()));
+                    ++m_renderCalls;
+                }
+            }
+            if (!bucket.rects.empty())
+            {
+                Transform(bucket.rects, m_rects, pointScale, rectOffset);
+                result &= SDL_RenderRects(renderer, m_rects.data(), int(m_rects.size()));
+                ++m_renderCalls;
+            }
+            if (!bucket.fillRects.empty())
+            {
+                Transform(bucket.fillRects, m_rects, pointScale, rectOffset);
+                result &= SDL_RenderFillRects(renderer, m_rects.data(), int(m_rects.size()));
+                ++m_renderCalls;
+            }
+        }
+        SDL_SetRenderDrawColorFloat(renderer, r, g, b, a);
+        if (!result) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        return Success();
+    }
+
+    // Number of SDL render calls the last Render() made.
+    Uint32 RenderCalls() const
+    {
+        return m_renderCalls;
+    }
+
+    // Removes all primitives, keeping the memory for the next ones.
+    void Clear()
+    {
+        for (Bucket &bucket : m_buckets)
+        {
+            bucket.points.clear();
+            bucket.linePoints.clear();
+            bucket.lineStarts.clear();
+            bucket.rects.clear();
+            bucket.fillRects.clear();
+        }
+    }
+
+  private:
+    struct Bucket
+    {
+        SDL_FColor color;
+        std::vector<SDL_FPoint> points;
+        std::vector<SDL_FPoint> linePoints;
+        std::vector<int> lineStarts;
+        std::vector<SDL_FRect> rects;
+        std::vector<SDL_FRect> fillRects;
+    };
+
+    Bucket &Find(SDL_FColor color)
+    {
+        for (Bucket &bucket : m_buckets)
+        {
+            if (bucket.color.r == color.r && bucket.color.g == color.g &&
+                bucket.color.b == color.b && bucket.color.a == color.a)
+            {
+                return bucket;
+            }
+        }
+        m_buckets.emplace_back();
+        m_buckets.back().color = color;
+        return m_buckets.back();
+    }
+
+    // Adds a quad covering the pixels of the line from a to b: 1 pixel wide around the pixel
+    // centers, and reaching half a pixel past both ends, as SDL_RenderLine draws both ends.
+    void AddLineQuad(SDL_FPoint a, SDL_FPoint b, SDL_FColor color)
+    {
+        float dx = b.x - a.x;
+        float dy = b.y - a.y;
+        float length = SDL_sqrtf(dx * dx + dy * dy);
+        if (length > 0)
+        {
+            dx *= 0.5f / length;
+            dy *= 0.5f / length;
+        }
+        else
+        {
+            dx = 0.5f;
+        }
+        float ax = a.x + 0.5f - dx;
+        float ay = a.y + 0.5f - dy;
+        float bx = b.x + 0.5f + dx;
+        float by = b.y + 0.5f + dy;
+        int first = int(m_vertices.size());
+        m_vertices.push_back({{ax - dy, ay + dx}, color, {0, 0}});
+        m_vertices.push_back({{ax + dy, ay - dx}, color, {0, 0}});
+        m_vertices.push_back({{bx + dy, by - dx}, color, {0, 0}});
+        m_vertices.push_back({{bx - dy, by + dx}, color, {0, 0}});
+        for (int index : {0, 1, 2, 0, 2, 3})
+        {
+            m_indices.push_back(first + index);
+        }
+    }
+
+    // Copies the floats of source to destination as source * scale + offset, with scale and
+    // offset repeating every 4 floats.
+    template <class T>
+    static void Transform(const std::vector<T> &source, std::vector<T> &destination,
+                          const float (&scale)[4], const float (&offset)[4])
+    {
+        destination.resize(source.size());
+        const float *from = reinterpret_cast<const float *>(source.data());
+        float *to = reinterpret_cast<float *>(destination.data());
+        size_t count = source.size() * sizeof(T) / sizeof(float);
+        size_t i = 0;
+#if defined(SDL_SSE_INTRINSICS)
+        __m128 scale4 = _mm_loadu_ps(scale);
+        __m128 offset4 = _mm_loadu_ps(offset);
+        for (; i + 4 <= count; i += 4)
+        {
+            _mm_storeu_ps(to + i, _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(from + i), scale4), offset4));
+        }
+#elif defined(SDL_NEON_INTRINSICS)
+        float32x4_t scale4 = vld1q_f32(scale);
+        float32x4_t offset4 = vld1q_f32(offset);
+        for (; i + 4 <= count; i += 4)
+        {
+            vst1q_f32(to + i, vmlaq_f32(offset4, vld1q_f32(from + i), scale4));
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            to[i] = from[i] * scale[i % 4] + offset[i % 4];
+        }
+    }
+
+    std::vector<Bucket> m_buckets;
+    std::vector<SDL_FPoint> m_points;
+    std::vector<SDL_FRect> m_rects;
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices;
+    Uint32 m_renderCalls = 0;
+};
+
+// Pixel conversion and blending kernels for common format pairs, in SSE2, AVX2 and NEON
+// variants. Get() picks the fastest variant the CPU supports the first time it's called.
+// The kernels work on little endian 32-bit pixels, with alpha in the top byte.
+struct PixelKernels
+{
+    // Swaps the red and blue channels, e.g. ARGB8888 <-> ABGR8888.
+    void (*swapRedBlue)(const Uint32 *source, Uint32 *destination, size_t count);
+    // RGB24 to XRGB8888, or BGR24 to XBGR8888, setting the top byte to 255.
+    void (*expand24To32)(const Uint8 *source, Uint32 *destination, size_t count);
+    // Blends like SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+    // destination = source + destination * (255 - source alpha) / 255, per channel.
+    void (*blendPremultiplied)(const Uint32 *source, Uint32 *destination, size_t count);
+    const char *name;
+
+    static const PixelKernels &Get()
+    {
+        static const PixelKernels kernels = Variants().back();
+        return kernels;
+    }
+
+    // The scalar kernels, followed by each SIMD variant the CPU supports, from slowest to
+    // fastest, e.g. to test them against each other. Variants without a kernel of their own
+    // use the one of the variant before.
+    static std::vector<PixelKernels> Variants()
+    {
+        std::vector<PixelKernels> variants{
+            {SwapRedBlue, Expand24To32, BlendPremultiplied, "scalar"}};
+#if defined(SDL_SSE2_INTRINSICS)
+        if (SDL_HasSSE2())
+        {
+            variants.push_back({SwapRedBlueSSE2, Expand24To32, BlendPremultipliedSSE2, "SSE2"});
+        }
+#endif
+#if defined(SDL_AVX2_INTRINSICS)
+        if (SDL_HasAVX2())
+        {
+            variants.push_back(
+                {SwapRedBlueAVX2, Expand24To32AVX2, BlendPremultipliedAVX2, "AVX2"});
+        }
+#endif
+#if defined(SDL_NEON_INTRINSICS)
+        if (SDL_HasNEON())
+        {
+            variants.push_back(
+                {SwapRedBlueNEON, Expand24To32NEON, BlendPremultipliedNEON, "NEON"});
+        }
+#endif
+        return variants;
+    }
+
+    // Converts the pixels like SDL_ConvertPixels, with the kernels if they cover the formats.
+    bool Convert(int width, int height, SDL_PixelFormat srcFormat, const void *src,
+                 int srcPitch, SDL_PixelFormat dstFormat, void *dst, int dstPitch) const
+    {
+        auto is = [&](SDL_PixelFormat from, SDL_PixelFormat to) {
+            return SDL_BYTEORDER == SDL_LIL_ENDIAN && srcFormat == from && dstFormat == to;
+        };
+        const Uint8 *source = static_cast<const Uint8 *>(src);
+        Uint8 *destination = static_cast<Uint8 *>(dst);
+
+        if (is(SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888) ||
+            is(SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888) ||
+            is(SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888) ||
+            is(SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888))
+        {
+            for (int y = 0; y < height; ++y, source += srcPitch, destination += dstPitch)
+            {
+                swapRedBlue(reinterpret_cast<const Uint32 *>(source),
+                                    reinterpret_cast<Uint32 *>(destination), size_t(width));
+            }
+            return true;
+        }
+        if (is(SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_XRGB8888) ||
+            is(SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888) ||
+            is(SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_XBGR8888) ||
+            is(SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_ABGR8888))
+        {
+            for (int y = 0; y < height; ++y, source += srcPitch, destination += dstPitch)
+            {
+                expand24To32(source, reinterpret_cast<Uint32 *>(destination), size_t(width));
+            }
+            return true;
+        }
+        return SDL_ConvertPixels(width, height, srcFormat, src, srcPitch, dstFormat, dst,
+                                 dstPitch);
+    }
+
+    // Whether blitting src to dst with SDL_BLENDMODE_BLEND_PREMULTIPLIED can use
+    // blendPremultiplied: both surfaces are ARGB8888, or both ABGR8888, and src has no color
+    // key and no color or alpha modulation.
+    static bool CanBlend(SDL_Surface *src, SDL_Surface *dst)
+    {
+        Uint8 r = 0;
+        Uint8 g = 0;
+        Uint8 b = 0;
+        Uint8 a = 0;
+        return SDL_BYTEORDER == SDL_LIL_ENDIAN && src != dst && src->format == dst->format &&
+               (src->format == SDL_PIXELFORMAT_ARGB8888 ||
+                src->format == SDL_PIXELFORMAT_ABGR8888) &&
+               !SDL_MUSTLOCK(src) && !SDL_MUSTLOCK(dst) && !SDL_SurfaceHasColorKey(src) &&
+               SDL_GetSurfaceColorMod(src, &r, &g, &b) && SDL_GetSurfaceAlphaMod(src, &a) &&
+               (r & g & b & a) == 255;
+    }
+
+    // Blends the pixels of source onto destination, which must be of the same size.
+    void Blend(SDL_Surface *src, const SDL_Rect &source, SDL_Surface *dst,
+               const SDL_Rect &destination) const
+    {
+        for (int row = 0; row < source.h; ++row)
+        {
+            const Uint8 *from = static_cast<const Uint8 *>(src->pixels) +
+                                size_t(source.y + row) * src->pitch + size_t(source.x) * 4;
+            Uint8 *to = static_cast<Uint8 *>(dst->pixels) +
+                        size_t(destination.y + row) * dst->pitch + size_t(destination.x) * 4;
+            blendPremultiplied(reinterpret_cast<const Uint32 *>(from),
+                               reinterpret_cast<Uint32 *>(to), size_t(source.w));
+        }
+    }
+
+  private:
+    // The scalar kernels also finish the pixels left over by the SIMD ones.
+    static void SwapRedBlue(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            Uint32 pixel = source[i];
+            destination[i] =
+                (pixel & 0xFF00FF00) | ((pixel >> 16) & 0xFF) | ((pixel & 0xFF) << 16);
+        }
+    }
+
+    static void Expand24To32(const Uint8 *source, Uint32 *destination, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i, source += 3)
+        {
+            destination[i] =
+                0xFF000000 | (Uint32(source[0]) << 16) | (Uint32(source[1]) << 8) | source[2];
+        }
+    }
+
+    // Divides by 255 the way SDL's blitters do.
+    static Uint32 MultiplyDivide255(Uint32 a, Uint32 b)
+    {
+        Uint32 x = a * b + 1;
+        return (x + (x >> 8)) >> 8;
+    }
+
+    static void BlendPremultiplied(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            Uint32 s = source[i];
+            Uint32 d = destination[i];
+            Uint32 inverseAlpha = 255 - (s >> 24);
+            Uint32 result = 0;
+            for (int shift = 0; shift < 32; shift += 8)
+            {
+                Uint32 channel = ((s >> shift) & 0xFF) +
+                                 MultiplyDivide255((d >> shift) & 0xFF, inverseAlpha);
+                result |= (channel < 255 ? channel : 255) << shift;
+            }
+            destination[i] = result;
+        }
+    }
+
+#if defined(SDL_SSE2_INTRINSICS)
+    SDL_TARGETING("sse2")
+    static void SwapRedBlueSSE2(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        const __m128i greenAlpha = _mm_set1_epi32(int(0xFF00FF00));
+        const __m128i low = _mm_set1_epi32(0xFF);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+            __m128i red = _mm_and_si128(_mm_srli_epi32(pixels, 16), low);
+            __m128i blue = _mm_slli_epi32(_mm_and_si128(pixels, low), 16);
+            pixels = _mm_or_si128(_mm_and_si128(pixels, greenAlpha), _mm_or_si128(red, blue));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i), pixels);
+        }
+        SwapRedBlue(source + i, destination + i, count - i);
+    }
+
+    SDL_TARGETING("sse2")
+    static void BlendPremultipliedSSE2(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi16(1);
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4)
+        {
+            __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + i));
+            __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(destination + i));
+            // Source alpha in every byte of its pixel, inverted.
+            __m128i alpha = _mm_srli_epi32(s, 24);
+            alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 8));
+            alpha = _mm_or_si128(alpha, _mm_slli_epi32(alpha, 16));
+            __m128i inverse = _mm_xor_si128(alpha, _mm_set1_epi32(-1));
+
+            __m128i halves[2];
+            for (int half = 0; half < 2; ++half)
+            {
+                __m128i d16 = half ? _mm_unpackhi_epi8(d, zero) : _mm_unpacklo_epi8(d, zero);
+                __m128i a16 = half ? _mm_unpackhi_epi8(inverse, zero)
+                                   : _mm_unpacklo_epi8(inverse, zero);
+                __m128i x = _mm_add_epi16(_mm_mullo_epi16(d16, a16), one);
+                halves[half] = _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+            }
+            __m128i blended = _mm_adds_epu8(s, _mm_packus_epi16(halves[0], halves[1]));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + i), blended);
+        }
+        BlendPremultiplied(source + i, destination + i, count - i);
+    }
+#endif
+
+#if defined(SDL_AVX2_INTRINSICS)
+    SDL_TARGETING("avx2")
+    static void SwapRedBlueAVX2(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13,
+                                                 12, 15, 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11,
+                                                 14, 13, 12, 15);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+            pixels = _mm256_shuffle_epi8(pixels, shuffle);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), pixels);
+        }
+        SwapRedBlue(source + i, destination + i, count - i);
+    }
+
+    SDL_TARGETING("avx2")
+    static void Expand24To32AVX2(const Uint8 *source, Uint32 *destination, size_t count)
+    {
+        const __m256i shuffle = _mm256_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10,
+                                                 9, -1, 2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1,
+                                                 11, 10, 9, -1);
+        const __m256i alpha = _mm256_set1_epi32(int(0xFF000000));
+        size_t i = 0;
+        // Each 16-byte load uses 12 bytes, so stop early enough not to read past the end.
+        for (; i + 10 <= count; i += 8)
+        {
+            const Uint8 *pixels = source + i * 3;
+            __m256i loaded = _mm256_inserti128_si256(
+                _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels))),
+                _mm_loadu_si128(reinterpret_cast<const __m128i *>(pixels + 12)), 1);
+            __m256i expanded = _mm256_or_si256(_mm256_shuffle_epi8(loaded, shuffle), alpha);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), expanded);
+        }
+        Expand24To32(source + i * 3, destination + i, count - i);
+    }
+
+    SDL_TARGETING("avx2")
+    static void BlendPremultipliedAVX2(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i one = _mm256_set1_epi16(1);
+        const __m256i broadcastAlpha = _mm256_setr_epi8(3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11,
+                                                        15, 15, 15, 15, 3, 3, 3, 3, 7, 7, 7, 7,
+                                                        11, 11, 11, 11, 15, 15, 15, 15);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+            __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(destination + i));
+            __m256i inverse = _mm256_xor_si256(_mm256_shuffle_epi8(s, broadcastAlpha),
+                                               _mm256_set1_epi32(-1));
+
+            __m256i halves[2];
+            for (int half = 0; half < 2; ++half)
+            {
+                __m256i d16 = half ? _mm256_unpackhi_epi8(d, zero) : _mm256_unpacklo_epi8(d, zero);
+                __m256i a16 = half ? _mm256_unpackhi_epi8(inverse, zero)
+                                   : _mm256_unpacklo_epi8(inverse, zero);
+                __m256i x = _mm256_add_epi16(_mm256_mullo_epi16(d16, a16), one);
+                halves[half] = _mm256_srli_epi16(_mm256_add_epi16(x, _mm256_srli_epi16(x, 8)), 8);
+            }
+            __m256i blended = _mm256_adds_epu8(s, _mm256_packus_epi16(halves[0], halves[1]));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), blended);
+        }
+        BlendPremultiplied(source + i, destination + i, count - i);
+    }
+#endif
+
+#if defined(SDL_NEON_INTRINSICS)
+    static void SwapRedBlueNEON(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x16x4_t pixels = vld4q_u8(reinterpret_cast<const Uint8 *>(source + i));
+            uint8x16_t blue = pixels.val[0];
+            pixels.val[0] = pixels.val[2];
+            pixels.val[2] = blue;
+            vst4q_u8(reinterpret_cast<Uint8 *>(destination + i), pixels);
+        }
+        SwapRedBlue(source + i, destination + i, count - i);
+    }
+
+    static void Expand24To32NEON(const Uint8 *source, Uint32 *destination, size_t count)
+    {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16)
+        {
+            uint8x16x3_t pixels = vld3q_u8(source + i * 3);
+            uint8x16x4_t expanded;
+            expanded.val[0] = pixels.val[2];
+            expanded.val[1] = pixels.val[1];
+            expanded.val[2] = pixels.val[0];
+            expanded.val[3] = vdupq_n_u8(255);
+            vst4q_u8(reinterpret_cast<Uint8 *>(destination + i), expanded);
+        }
+        Expand24To32(source + i * 3, destination + i, count - i);
+    }
+
+    static void BlendPremultipliedNEON(const Uint32 *source, Uint32 *destination, size_t count)
+    {
+        const uint16x8_t one = vdupq_n_u16(1);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8)
+        {
+            uint8x8x4_t s = vld4_u8(reinterpret_cast<const Uint8 *>(source + i));
+            uint8x8x4_t d = vld4_u8(reinterpret_cast<const Uint8 *>(destination + i));
+            uint8x8_t inverse = vmvn_u8(s.val[3]);
+            for (int channel = 0; channel < 4; ++channel)
+            {
+                uint16x8_t x = vaddq_u16(vmull_u8(d.val[channel], inverse), one);
+                x = vaddq_u16(x, vshrq_n_u16(x, 8));
+                d.val[channel] = vqadd_u8(s.val[channel], vshrn_n_u16(x, 8));
+            }
+            vst4_u8(reinterpret_cast<Uint8 *>(destination + i), d);
+        }
+        BlendPremultiplied(source + i, destination + i, count - i);
+    }
+#endif
+};
+
+// Like SDL_ConvertPixels, using PixelKernels for ARGB8888 <-> ABGR8888, XRGB8888 <-> XBGR8888,
+// RGB24 to XRGB8888/ARGB8888 and BGR24 to XBGR8888/ABGR8888.
+inline Result<void> ConvertPixelsSIMD(int width, int height, SDL_PixelFormat srcFormat,
+                                      const void *src, int srcPitch, SDL_PixelFormat dstFormat,
+                                      void *dst, int dstPitch,
+                                      Location location = Location::current())
+{
+    bool converted = PixelKernels::Get().Convert(width, height, srcFormat, src, srcPitch,
+                                                 dstFormat, dst, dstPitch);
+    if (!converted) [[unlikely]]
+    {
+        return Fail<void>(location);
+    }
+    return Success();
+}
+
+// Clips blitting srcRect, or all of src, to (x, y) like SDL_BlitSurface: to src, then to the
+// clip rectangle of dst. Returns false if nothing is left to blit.
+inline bool ClipBlit(SDL_Surface *src, const SDL_Rect *srcRect, SDL_Surface *dst, int x, int y,
+                     SDL_Rect &source, SDL_Rect &destination)
+{
+    source = srcRect ? *srcRect : SDL_Rect{0, 0, src->w, src->h};
+    SDL_Rect bounds{0, 0, src->w, src->h};
+    SDL_Rect clipped;
+    if (!SDL_GetRectIntersection(&source, &bounds, &clipped))
+    {
+        return false;
+    }
+    destination = {x + clipped.x - source.x, y + clipped.y - source.y, clipped.w, clipped.h};
+    source = clipped;
+    SDL_GetSurfaceClipRect(dst, &bounds);
+    if (!SDL_GetRectIntersection(&destination, &bounds, &clipped))
+    {
+        return false;
+    }
+    source = {source.x + clipped.x - destination.x, source.y + clipped.y - destination.y,
+              clipped.w, clipped.h};
+    destination = clipped;
+    return true;
+}
+
+// Like SDL_BlitSurface with src in SDL_BLENDMODE_BLEND_PREMULTIPLIED, blitting to (x, y).
+// Uses PixelKernels when PixelKernels::CanBlend().
+inline Result<void> BlitSurfacePremultiplied(SDL_Surface *src, const SDL_Rect *srcRect,
+                                             SDL_Surface *dst, int x, int y,
+                                             Location location = Location::current())
+{
+    if (!PixelKernels::CanBlend(src, dst))
+    {
+        SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+        SDL_GetSurfaceBlendMode(src, &mode);
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        SDL_Rect dstRect{x, y, 0, 0};
+        bool result = SDL_BlitSurface(src, srcRect, dst, &dstRect);
+        SDL_SetSurfaceBlendMode(src, mode);
+        if (!result) [[unlikely]]
+        {
+            return Fail<void>(location);
+        }
+        return Success();
+    }
+
+    SDL_Rect source;
+    SDL_Rect destination;
+    if (ClipBlit(src, srcRect, dst, x, y, source, destination))
+    {
+        PixelKernels::Get().Blend(src, source, dst, destination);
+    }
+    return Success();
+}
+
+// Copies the blend mode and the color and alpha mods of from to to.
+inline void CopySurfaceBlending(SDL_Surface *from, SDL_Surface *to)
+{
+    SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+    Uint8 r = 255;
+    Uint8 g = 255;
+    Uint8 b = 255;
+    Uint8 a = 255;
+    SDL_GetSurfaceBlendMode(from, &mode);
+    SDL_GetSurfaceColorMod(from, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(from, &a);
+    SDL_SetSurfaceBlendMode(to, mode);
+    SDL_SetSurfaceColorMod(to, r, g, b);
+    SDL_SetSurfaceAlphaMod(to, a);
+}
+
+// Blits source of src unscaled to destination of dst, of the same size, in bands of
+// destination rows on pool. Blitting changes the blit maps of both surfaces, so each band blits
+// between surfaces of its own over the same pixels, with the blend mode, color and alpha mods
+// and color key of src. Used by the parallel surface functions below.
+inline bool BlitSurfaceBands(WorkerPool &pool, SDL_Surface *src, const SDL_Rect &source,
+                             SDL_Surface *dst, const SDL_Rect &destination)
+{
+    SDL_Rect clip;
+    SDL_GetSurfaceClipRect(dst, &clip);
+    int top = SDL_max(destination.y, clip.y);
+    int bottom = SDL_min(destination.y + destination.h, clip.y + clip.h);
+    if (bottom <= top)
+    {
+        return true;
+    }
+
+    // Read once here rather than from every band.
+    SDL_Colorspace srcColorspace = SDL_GetSurfaceColorspace(src);
+    SDL_Colorspace dstColorspace = SDL_GetSurfaceColorspace(dst);
+    SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+    Uint8 r = 255;
+    Uint8 g = 255;
+    Uint8 b = 255;
+    Uint8 a = 255;
+    Uint32 key = 0;
+    SDL_GetSurfaceBlendMode(src, &mode);
+    SDL_GetSurfaceColorMod(src, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(src, &a);
+    bool hasKey = SDL_SurfaceHasColorKey(src) && SDL_GetSurfaceColorKey(src, &key);
+
+    return pool.RunBands(bottom - top, dst->pitch, [&](int firstRow, int numRows) {
+        Uint8 *pixels = static_cast<Uint8 *>(dst->pixels) + size_t(top + firstRow) * dst->pitch;
+        Surface from{SDL_CreateSurfaceFrom(src->w, src->h, src->format, src->pixels, src->pitch)};
+        Surface to{SDL_CreateSurfaceFrom(dst->w, numRows, dst->format, pixels, dst->pitch)};
+        if (!from || !to) [[unlikely]]
+        {
+            return false;
+        }
+        SDL_SetSurfaceColorspace(from.get(), srcColorspace);
+        SDL_SetSurfaceColorspace(to.get(), dstColorspace);
+        SDL_SetSurfaceBlendMode(from.get(), mode);
+        SDL_SetSurfaceColorMod(from.get(), r, g, b);
+        SDL_SetSurfaceAlphaMod(from.get(), a);
+        if (hasKey)
+        {
+            SDL_SetSurfaceColorKey(from.get(), true, key);
+        }
+        SDL_Rect bandClip{clip.x, 0, clip.w, numRows};
+        SDL_SetSurfaceClipRect(to.get(), &bandClip);
+        SDL_Rect rect = destination;
+        rect.y -= top + firstRow;
+        return SDL_BlitSurface(from.get(), &source, to.get(), &rect);
+    });
+}
+
+// Like SDL_ConvertSurface, converting in bands of rows on pool with PixelKernels.
+// Surfaces SDL_ConvertPixels can't convert on its own, like indexed, RLE, color keyed or
+// non-sRGB ones, are converted on this thread.
+inline Result<Surface> ConvertSurfaceParallel(WorkerPool &pool, SDL_Surface *surface,
+                                              SDL_PixelFormat format,
+                                              Location location = Location::current())
+{
+    Surface converted;
+    if (SDL_MUSTLOCK(surface) || SDL_ISPIXELFORMAT_INDEXED(surface->format) ||
+        SDL_ISPIXELFORMAT_INDEXED(format) || SDL_ISPIXELFORMAT_FOURCC(surface->format) ||
+        SDL_ISPIXELFORMAT_FOURCC(format) || SDL_SurfaceHasColorKey(surface) ||
+        SDL_GetSurfaceColorspace(surface) != SDL_COLORSPACE_SRGB)
+    {
+        converted.reset(SDL_ConvertSurface(surface, format));
+        if (!converted) [[unlikely]]
+        {
+            return Fail<Surface>(location);
+        }
+        return converted;
+    }
+
+    converted.reset(SDL_CreateSurface(surface->w, surface->h, format));
+    if (!converted) [[unlikely]]
+    {
+        return Fail<Surface>(location);
+    }
+    SDL_Surface *dst = converted.get();
+    bool result = pool.RunBands(surface->h, dst->pitch, [&](int firstRow, int numRows) {
+        const Uint8 *from =
+            static_cast<const Uint8 *>(surface->pixels) + size_t(firstRow) * surface->pitch;
+        Uint8 *to = static_cast<Uint8 *>(dst->pixels) + size_t(firstRow) * dst->pitch;
+        return PixelKernels::Get().Convert(surface->w, numRows, surface->format, from,
+                                           surface->pitch, format, to, dst->pitch);
+    });
+    if (!result) [[unlikely]]
+    {
+        return Fail<Surface>(location);
+    }
+    CopySurfaceBlending(surface, dst);
+    return converted;
+}
+
+// Like BlitSurfacePremultiplied, blending in bands of rows on pool.
+inline Result<void> BlitSurfacePremultipliedParallel(WorkerPool &pool, SDL_Surface *src,
+                                                     const SDL_Rect *srcRect, SDL_Surface *dst,
+                                                     int x, int y,
+                                                     Location location = Location::current())
+{
+    if (src == dst || SDL_MUSTLOCK(src) || SDL_MUSTLOCK(dst) ||
+        SDL_ISPIXELFORMAT_INDEXED(src->format) || SDL_ISPIXELFORMAT_INDEXED(dst->format))
+    {
+        return BlitSurfacePremultiplied(src, srcRect, dst, x, y, location);
+    }
+
+    SDL_Rect source;
+    SDL_Rect destination;
+    if (!ClipBlit(src, srcRect, dst, x, y, source, destination))
+    {
+        return Success();
+    }
+
+    if (PixelKernels::CanBlend(src, dst))
+    {
+        const PixelKernels &kernels = PixelKernels::Get();
+        pool.RunBands(source.h, dst->pitch, [&](int firstRow, int numRows) {
+            SDL_Rect from{source.x, source.y + firstRow, source.w, numRows};
+            SDL_Rect to{destination.x, destination.y + firstRow, destination.w, numRows};
+            kernels.Blend(src, from, dst, to);
+            return true;
+        });
+        return Success();
+    }
+
+    SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+    SDL_GetSurfaceBlendMode(src, &mode);
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    bool result = BlitSurfaceBands(pool, src, source, dst, destination);
+    SDL_SetSurfaceBlendMode(src, mode);
+    if (!result) [[unlikely]]
+    {
+        return Fail<void>(location);
+    }
+    return Success();
+}
+
+// A typed view of the pixels of a surface whose format is known at compile time, unlike
+// ReadSurfacePixel and WriteSurfacePixel, which look up the format for every pixel. Keeps the
+// surface locked while it exists. A row is a span of Pixel, and iterating the view yields the
+// rows, so per-pixel loops compile down to plain (and vectorisable) array accesses.
+// Formats of 1, 2 or 4 bytes per pixel are supported; Pixel holds the packed pixel.
+template <SDL_PixelFormat Format> struct PixelView
+{
+    // The macros test the format in a boolean context, which warns for an enum constant.
+    static constexpr int BytesPerPixel = SDL_BYTESPERPIXEL(Uint32(Format));
+
+    // SDL_BYTESPERPIXEL is 1 or 2 for FOURCC formats, which aren't arrays of pixels.
+    static_assert(!SDL_ISPIXELFORMAT_FOURCC(Uint32(Format)),
+                  "PixelView needs a packed or array format");
+    static_assert(BytesPerPixel == 1 || BytesPerPixel == 2 || BytesPerPixel == 4,
+                  "PixelView needs a format of 1, 2 or 4 bytes per pixel");
+
+    using Pixel = std::conditional_t<BytesPerPixel == 1, Uint8,
+                                     std::conditional_t<BytesPerPixel == 2, Uint16, Uint32>>;
+
+    struct RowIterator
+    {
+        using value_type = std::span<Pixel>;
+        using difference_type = std::ptrdiff_t;
+
+        std::span<Pixel> operator*() const
+        {
+            return {reinterpret_cast<Pixel *>(row), size_t(width)};
+        }
+
+        RowIterator &operator++()
+        {
+            row += pitch;
+            return *this;
+        }
+
+        RowIterator operator++(int)
+        {
+            RowIterator previous = *this;
+            row += pitch;
+            return previous;
+        }
+
+        bool operator==(const RowIterator &other) const
+        {
+            return row == other.row;
+        }
+
+        Uint8 *row = nullptr;
+        int width = 0;
+        int pitch = 0;
+    };
+
+    // Locks surface, which must be in Format, until the returned view is destroyed.
+    static Result<PixelView> Lock(SDL_Surface *surface, Location location = Location::current())
+    {
+        if (surface->format != Format) [[unlikely]]
+        {
+            SDL_SetError("PixelView of %s on a surface in %s", SDL_GetPixelFormatName(Format),
+                         SDL_GetPixelFormatName(surface->format));
+            return Fail<PixelView>(location);
+        }
+        if (!SDL_LockSurface(surface)) [[unlikely]]
+        {
+            return Fail<PixelView>(location);
+        }
+        return PixelView{surface};
+    }
+
+    // An empty view, as returned by a failing Lock() with SDL_HPP_ERROR_CALLBACK.
+    PixelView() {};
+    PixelView(const PixelView &) = delete;
+
+    PixelView &operator=(const PixelView &) = delete;
+
+    PixelView(PixelView &&other) noexcept : m_surface{other.m_surface}
+    {
+        other.m_surface = nullptr;
+    }
+
+    PixelView &operator=(PixelView &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Unlock();
+            m_surface = other.m_surface;
+            other.m_surface = nullptr;
+        }
+        return *this;
+    }
+
+    ~PixelView()
+    {
+        Unlock();
+    }
+
+    void Unlock()
+    {
+        if (m_surface)
+        {
+            SDL_UnlockSurface(m_surface);
+            m_surface = nullptr;
+        }
+    }
+
+    explicit operator bool() const
+    {
+        return m_surface != nullptr;
+    }
+
+    int Width() const
+    {
+        return m_surface ? m_surface->w : 0;
+    }
+
+    int Height() const
+    {
+        return m_surface ? m_surface->h : 0;
+    }
+
+    std::span<Pixel> Row(int y) const
+    {
+        return *RowIterator{RowPointer(y), m_surface->w, m_surface->pitch};
+    }
+
+    std::span<Pixel> operator[](int y) const
+    {
+        return Row(y);
+    }
+
+    Pixel &At(int x, int y) const
+    {
+        return reinterpret_cast<Pixel *>(RowPointer(y))[x];
+    }
+
+    // All pixels as one span if the rows are contiguous in memory, an empty span otherwise.
+    std::span<Pixel> Pixels() const
+    {
+        if (!m_surface || m_surface->pitch != m_surface->w * BytesPerPixel)
+        {
+            return {};
+        }
+        return {static_cast<Pixel *>(m_surface->pixels), size_t(m_surface->w) * m_surface->h};
+    }
+
+    RowIterator begin() const
+    {
+        return m_surface ? RowIterator{RowPointer(0), m_surface->w, m_surface->pitch}
+                         : RowIterator{};
+    }
+
+    RowIterator end() const
+    {
+        return m_surface ? RowIterator{RowPointer(m_surface->h), m_surface->w, m_surface->pitch}
+                         : RowIterator{};
+    }
+
+  private:
+    explicit PixelView(SDL_Surface *surface) : m_surface{surface} {};
+
+    Uint8 *RowPointer(int y) const
+    {
+        return static_cast<Uint8 *>(m_surface->pixels) + ptrdiff_t(y) * m_surface->pitch;
+    }
+
+    SDL_Surface *m_surface = nullptr;
+};
+
+// Expands a channel of the given bits to 8 bits, rounding like SDL does.
+template <int Bits> constexpr Uint8 ExpandPixelChannel(Uint32 value)
+{
+    constexpr Uint32 max = (1u << Bits) - 1;
+    return Uint8((value * 255 + max / 2) / max);
+}
+
+// Like SDL_MapRGBA, for a packed Format known at compile time (see PixelFormatTraits).
+// Compiles down to shifts and masks, which vectorise in loops over arrays of pixels.
+template <SDL_PixelFormat Format> constexpr Uint32 MapRGBA(Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    using Traits = PixelFormatTraits<Format>;
+    return (Uint32(r) >> (8 - Traits::RBits) << Traits::RShift) |
+           (Uint32(g) >> (8 - Traits::GBits) << Traits::GShift) |
+           (Uint32(b) >> (8 - Traits::BBits) << Traits::BShift) |
+           (Uint32(a) >> (8 - Traits::ABits) << Traits::AShift);
+}
+
+template <SDL_PixelFormat Format> constexpr Uint32 MapRGB(Uint8 r, Uint8 g, Uint8 b)
+{
+    return MapRGBA<Format>(r, g, b, 255);
+}
+
+// Like SDL_GetRGBA, for a packed Format known at compile time. Formats without alpha give 255.
+template <SDL_PixelFormat Format>
+constexpr void GetRGBA(Uint32 pixel, Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a)
+{
+    using Traits = PixelFormatTraits<Format>;
+    *r = ExpandPixelChannel<Traits::RBits>((pixel & Traits::RMask) >> Traits::RShift);
+    *g = ExpandPixelChannel<Traits::GBits>((pixel & Traits::GMask) >> Traits::GShift);
+    *b = ExpandPixelChannel<Traits::BBits>((pixel & Traits::BMask) >> Traits::BShift);
+    if constexpr (Traits::ABits > 0)
+    {
+        *a = ExpandPixelChannel<Traits::ABits>((pixel & Traits::AMask) >> Traits::AShift);
+    }
+    else
+    {
+        *a = 255;
+    }
+}
+
+template <SDL_PixelFormat Format>
+constexpr void GetRGB(Uint32 pixel, Uint8 *r, Uint8 *g, Uint8 *b)
+{
+    Uint8 a = 0;
+    GetRGBA<Format>(pixel, r, g, b, &a);
+}
+
+// Recycles the pixels of surfaces of the same size, format and pitch, so that paths creating
+// and destroying same-sized surfaces every frame, like frame capture, stop allocating pixels
+// once warmed up. Rows and pixels are aligned to SDL_GetSIMDAlignment(). The pool must outlive
+// its surfaces, and nothing may keep a surface (through its refcount) past its PooledSurface.
+struct SurfacePool
+{
+    // Destroys a surface and hands its pixels back to the pool.
+    struct Recycler
+    {
+        void operator()(SDL_Surface *surface) const
+        {
+            pool->Recycle(surface);
+        }
+
+        SurfacePool *pool = nullptr;
+    };
+
+    using PooledSurface = std::unique_ptr<SDL_Surface, Recycler>;
+
+    // Keeps up to maxIdle unused pixel buffers of each size, format and pitch.
+    explicit SurfacePool(size_t maxIdle = 4, Location location = Location::current())
+        : m_mutex{CreateGuardMutex(location)}, m_maxIdle{maxIdle} {};
+    SurfacePool(const SurfacePool &) = delete;
+
+    SurfacePool &operator=(const SurfacePool &) = delete;
+
+    ~SurfacePool()
+    {
+        Trim();
+    }
+
+    // Like SDL_CreateSurface, reusing pixels from the pool if there are any to spare. Only
+    // formats of whole bytes per pixel are supported.
+    Result<PooledSurface> Create(int width, int height, SDL_PixelFormat format,
+                                 Location location = Location::current())
+    {
+        size_t alignment = SDL_GetSIMDAlignment();
+        Sint64 pitch = (Sint64(width) * SDL_BYTESPERPIXEL(format) + alignment - 1) /
+                       Sint64(alignment) * Sint64(alignment);
+        bool supported = width >= 0 && height >= 0 && !SDL_ISPIXELFORMAT_FOURCC(format) &&
+                         SDL_BITSPERPIXEL(format) >= 8 &&
+                         pitch * SDL_max(height, 1) <= SDL_MAX_SINT32;
+        if (!supported) [[unlikely]]
+        {
+            SDL_SetError("SurfacePool can't create a %dx%d surface in %s", width, height,
+                         SDL_GetPixelFormatName(format));
+            return Fail<PooledSurface>(location);
+        }
+
+        Key key{width, height, format, int(pitch)};
+        void *pixels = nullptr;
+        {
+            LockedMutex lock = ScopedLock(m_mutex);
+            std::vector<void *> &idle = m_idle[key];
+            if (!idle.empty())
+            {
+                pixels = idle.back();
+                idle.pop_back();
+            }
+        }
+        if (!pixels)
+        {
+            pixels = SDL_aligned_alloc(alignment, size_t(pitch) * SDL_max(height, 1));
+            if (!pixels) [[unlikely]]
+            {
+                return Fail<PooledSurface>(location);
+            }
+        }
+
+        SDL_Surface *surface = SDL_CreateSurfaceFrom(width, height, format, pixels, key.pitch);
+        if (!surface) [[unlikely]]
+        {
+            Return(key, pixels);
+            return Fail<PooledSurface>(location);
+        }
+        return PooledSurface{surface, Recycler{this}};
+    }
+
+    // Frees all the pixels not in use.
+    void Trim()
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        for (auto &[key, idle] : m_idle)
+        {
+            for (void *pixels : idle)
+            {
+                SDL_aligned_free(pixels);
+            }
+        }
+        m_idle.clear();
+    }
+
+  private:
+    struct Key
+    {
+        int width;
+        int height;
+        SDL_PixelFormat format;
+        int pitch;
+
+        bool operator==(const Key &) const = default;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key &key) const
+        {
+            return SDL_murmur3_32(&key, sizeof(key), 0);
+        }
+    };
+
+    void Recycle(SDL_Surface *surface)
+    {
+        Key key{surface->w, surface->h, surface->format, surface->pitch};
+        void *pixels = surface->pixels;
+        SDL_DestroySurface(surface);
+        Return(key, pixels);
+    }
+
+    void Return(const Key &key, void *pixels)
+    {
+        LockedMutex lock = ScopedLock(m_mutex);
+        std::vector<void *> &idle = m_idle[key];
+        if (idle.size() < m_maxIdle)
+        {
+            idle.push_back(pixels);
+        }
+        else
+        {
+            SDL_aligned_free(pixels);
+        }
+    }
+
+    Mutex m_mutex;
+    size_t m_maxIdle;
+    std::unordered_map<Key, std::vector<void *>, KeyHash> m_idle;
+};
+
 } // namespace sdl
@@ -57,6 +57,22 @@ struct Function
         m_isUnchecked = !m_returnsBool && !m_returnsPointer;
 
         m_isVoid = m_returnTypeString == "void";
+
+        CXString comment = clang_Cursor_getRawCommentText(cursor);
+        const char *commentString = clang_getCString(comment);
+        if (commentString)
+        {
+            std::string commentText{commentString};
+            size_t returnsStart = commentText.find("\\returns");
+            if (returnsStart != std::string::npos)
+            {
+                size_t returnsEnd = commentText.find('\\', returnsStart + 1);
+                std::string returnsText =
+                    commentText.substr(returnsStart, returnsEnd - returnsStart);
+                m_documentsErrorReturn = returnsText.find("SDL_GetError") != std::string::npos;
+            }
+        }
+        clang_disposeString(comment);
     }
 
     void AddArgument(CXCursor cursor)
@@ -137,6 +153,26 @@ struct Function
         return m_isVariadic;
     }
 
+    bool IsQuery() const
+    {
+        return m_isQuery;
+    }
+
+    // True if the doxygen \returns text refers to SDL_GetError(),
+    // which is how SDL documents a false/NULL result as an error.
+    bool DocumentsErrorReturn() const
+    {
+        return m_documentsErrorReturn;
+    }
+
+    // A bool function whose result is an answer (e.g. "was there an event?"),
+    // not success/failure, gets passed through instead of checked.
+    void MarkAsQuery()
+    {
+        m_isQuery = true;
+        m_isUnchecked = true;
+    }
+
   private:
     std::string m_name;
     std::string m_namespacedName;
@@ -150,6 +186,8 @@ struct Function
     bool m_isUnchecked;
     bool m_isVoid;
     bool m_isVariadic;
+    bool m_isQuery = false;
+    bool m_documentsErrorReturn = false;
 };
 
 } // namespace zlang
@@ -2,9 +2,57 @@
 
 #include <SDL3/SDL.h>
 
+#include <bit>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
+#include <optional>
 #include <source_location>
+#include <span>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Selects how the wrappers report a failing SDL call. Define SDL_HPP_ERROR_POLICY
+// to one of these before including SDL.hpp; the default is throwing.
+//
+// SDL_HPP_ERROR_THROW: Throw a std::runtime_error.
+// SDL_HPP_ERROR_EXPECTED: Return a std::expected<T, sdl::Error> (C++23).
+// SDL_HPP_ERROR_CALLBACK: Call the function set by sdl::SetErrorCallback and return
+//   false/nullptr as the plain SDL function would. Neither allocates nor unwinds.
+// SDL_HPP_ERROR_ABORT: Log the error and abort.
+
+#define SDL_HPP_ERROR_THROW 0
+#define SDL_HPP_ERROR_EXPECTED 1
+#define SDL_HPP_ERROR_CALLBACK 2
+#define SDL_HPP_ERROR_ABORT 3
+
+#ifndef SDL_HPP_ERROR_POLICY
+#define SDL_HPP_ERROR_POLICY SDL_HPP_ERROR_THROW
+#endif
+
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_EXPECTED
+#include <expected>
+#endif
+
+// Define SDL_HPP_SOURCE_LOCATION to 0 to not capture the caller's source location
+// in the checked wrappers. Their location argument then is an empty struct that
+// takes no register, and errors report an empty location.
+
+#ifndef SDL_HPP_SOURCE_LOCATION
+#define SDL_HPP_SOURCE_LOCATION 1
+#endif
+
+// Keeps the error reporting out of line and out of the way of the wrappers' fast path.
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SDL_HPP_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define SDL_HPP_COLD __declspec(noinline)
+#else
+#define SDL_HPP_COLD
+#endif
 
 // Avoid endless recursion
 
@@ -26,18 +74,134 @@
 namespace sdl
 {
 
-inline void SDLThrow(std::source_location location)
+#if SDL_HPP_SOURCE_LOCATION
+using Location = std::source_location;
+#else
+// Empty stand-in for std::source_location, which costs nothing to pass.
+struct Location
+{
+    static constexpr Location current()
+    {
+        return Location{};
+    }
+
+    constexpr const char *file_name() const
+    {
+        return "";
+    }
+
+    constexpr const char *function_name() const
+    {
+        return "";
+    }
+
+    constexpr unsigned line() const
+    {
+        return 0;
+    }
+
+    constexpr unsigned column() const
+    {
+        return 0;
+    }
+};
+#endif
+
+// A failed SDL call. The message is only looked up (via SDL_GetError) when asked for,
+// so it is only valid until the next SDL call on the same thread fails.
+struct Error
+{
+    Location location;
+
+    const char *Message() const
+    {
+        const char *pErrorMessage = SDL_GetError();
+        if (!pErrorMessage || pErrorMessage[0] == '\0')
+        {
+            pErrorMessage = "(unknown)";
+        }
+        return pErrorMessage;
+    }
+
+    int Format(char *buffer, size_t size) const
+    {
+        return SDL_snprintf(buffer, size, "SDL error: %s", Message());
+    }
+};
+
+[[noreturn]] SDL_HPP_COLD inline void SDLThrow(Location location)
 {
     constexpr size_t BufferSize = 256;
     char error[BufferSize];
-    const char *pErrorMessage = SDL_GetError();
-    if (!pErrorMessage || pErrorMessage[0] == '\0')
+    Error{location}.Format(error, BufferSize);
+    SDL_Log("%s", error);
+    throw std::runtime_error{error};
+}
+
+[[noreturn]] SDL_HPP_COLD inline void SDLAbort(Location location)
+{
+    SDL_Log("SDL error: %s (%s:%u)", Error{location}.Message(), location.file_name(),
+            static_cast<unsigned>(location.line()));
+    std::abort();
+}
+
+using ErrorCallback = void (*)(const Error &error);
+
+inline ErrorCallback errorCallback = nullptr;
+
+inline void SetErrorCallback(ErrorCallback callback)
+{
+    errorCallback = callback;
+}
+
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_EXPECTED
+template <class T> using Result = std::expected<T, Error>;
+#elif SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_CALLBACK
+// As the plain SDL functions do, the checked bool functions return whether they succeeded.
+template <class T> struct CallbackResult
+{
+    using Type = T;
+};
+
+template <> struct CallbackResult<void>
+{
+    using Type = bool;
+};
+
+template <class T> using Result = typename CallbackResult<T>::Type;
+#else
+template <class T> using Result = T;
+#endif
+
+inline Result<void> Success()
+{
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_CALLBACK
+    return true;
+#else
+    return Result<void>();
+#endif
+}
+
+template <class T> SDL_HPP_COLD Result<T> Fail(Location location)
+{
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_EXPECTED
+    return std::unexpected{Error{location}};
+#elif SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_CALLBACK
+    if (errorCallback)
     {
-        pErrorMessage = "(unknown)";
+        errorCallback(Error{location});
     }
-    SDL_snprintf(error, BufferSize, "SDL error: %s", pErrorMessage);
-    SDL_Log(error);
-    throw std::runtime_error{error};
+    else
+    {
+        SDL_Log("SDL error: %s", Error{location}.Message());
+    }
+    // false for Result<void>, nullptr or zero otherwise.
+    return Result<T>();
+#elif SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_ABORT
+    SDLAbort(location);
+#else
+    SDLThrow(location);
+#endif
 }
 
 struct FreeVoid
@@ -62,26 +226,175 @@ template <class T> struct Destroyer
     }
 };
 
+// SDL_WaitThread also takes a status pointer, so the generator doesn't pick it up.
+// An sdl::Thread joins the thread when going out of scope.
+template <> inline void Destroy<SDL_Thread>(SDL_Thread *thread)
+{
+    SDL_WaitThread(thread, nullptr);
+}
+
+using Thread = std::unique_ptr<SDL_Thread, Destroyer<SDL_Thread>>;
+
+// Specialized for the types having an SDL_Unlock* function, so e.g. an sdl::LockedTexture
+// created after a successful sdl::LockTexture unlocks the texture when going out of scope.
+template <class T> void Unlock(T *object)
+{
+}
+
+template <class T> struct Unlocker
+{
+    void operator()(T *object)
+    {
+        Unlock<T>(object);
+    }
+};
+
+// SDL_SpinLock is an int, so its guard gets a deleter of its own rather than an Unlock<int>.
+struct SpinLockUnlocker
+{
+    void operator()(SDL_SpinLock *lock)
+    {
+        SDL_UnlockSpinlock(lock);
+    }
+};
+
+using LockedSpinLock = std::unique_ptr<SDL_SpinLock, SpinLockUnlocker>;
+
+// Masks, shifts and bits of the channels of a packed pixel format, known at compile time.
+template <int bitsPerPixel, int bytesPerPixel, Uint32 rMask, Uint32 gMask, Uint32 bMask,
+          Uint32 aMask>
+struct PackedPixelFormatTraits
+{
+    static constexpr int BitsPerPixel = bitsPerPixel;
+    static constexpr int BytesPerPixel = bytesPerPixel;
+    static constexpr Uint32 RMask = rMask;
+    static constexpr Uint32 GMask = gMask;
+    static constexpr Uint32 BMask = bMask;
+    static constexpr Uint32 AMask = aMask;
+    static constexpr int RShift = rMask ? std::countr_zero(rMask) : 0;
+    static constexpr int GShift = gMask ? std::countr_zero(gMask) : 0;
+    static constexpr int BShift = bMask ? std::countr_zero(bMask) : 0;
+    static constexpr int AShift = aMask ? std::countr_zero(aMask) : 0;
+    static constexpr int RBits = std::popcount(rMask);
+    static constexpr int GBits = std::popcount(gMask);
+    static constexpr int BBits = std::popcount(bMask);
+    static constexpr int ABits = std::popcount(aMask);
+};
+
+// Specialized from the SDL_PixelFormat enum for the packed formats of up to 8 bits per
+// channel, as a PackedPixelFormatTraits.
+template <SDL_PixelFormat Format> struct PixelFormatTraits;
+
 template <class T> void ReleaseFromDevice(SDL_GPUDevice *device, T *object)
 {
 }
 
 template <class T> struct DeviceOwned
 {
+    DeviceOwned() = default;
     DeviceOwned(SDL_GPUDevice *device, T *object) : m_device{device}, m_object{object} {};
     DeviceOwned(const DeviceOwned &) = delete;
+    DeviceOwned(DeviceOwned &&other) noexcept
+        : m_device{other.m_device}, m_object{other.Detach()} {};
 
     DeviceOwned &operator=(const DeviceOwned &) = delete;
 
+    DeviceOwned &operator=(DeviceOwned &&other) noexcept
+    {
+        if (this != &other)
+        {
+            Reset();
+            m_device = other.m_device;
+            m_object = other.Detach();
+        }
+        return *this;
+    }
+
     ~DeviceOwned()
     {
-        if (m_object)
+        Reset();
+    }
+
+    explicit operator bool() const
+    {
+        return m_object != nullptr;
+    }
+
+    SDL_GPUDevice *Device() const
+    {
+        return m_device;
+    }
+
+    T *Get() const
+    {
+        return m_object;
+    }
+
+    T *Detach()
+    {
+        T *object = m_object;
+        m_object = nullptr;
+        return object;
+    }
+
+    // Releases the currently owned object (if any) and takes ownership of the given one.
+    void Reset(T *object = nullptr)
+    {
+        T *previous = m_object;
+        m_object = object;
+        if (previous)
+        {
+            ReleaseFromDevice(m_device, previous);
+        }
+    }
+
+  private:
+    SDL_GPUDevice *m_device = nullptr;
+    T *m_object = nullptr;
+};
+
+// The default Context for SharedDeviceOwned: One SDL_GPUDevice for the whole application.
+struct GPUDeviceContext
+{
+    static SDL_GPUDevice *Device()
+    {
+        return device;
+    }
+
+    static inline SDL_GPUDevice *device = nullptr;
+};
+
+// Like DeviceOwned, but gets the device from Context::Device() instead of storing it,
+// so a handle is only the size of a pointer.
+template <class T, class Context = GPUDeviceContext> struct SharedDeviceOwned
+{
+    SharedDeviceOwned() = default;
+    explicit SharedDeviceOwned(T *object) : m_object{object} {};
+    SharedDeviceOwned(const SharedDeviceOwned &) = delete;
+    SharedDeviceOwned(SharedDeviceOwned &&other) noexcept : m_object{other.Detach()} {};
+
+    SharedDeviceOwned &operator=(const SharedDeviceOwned &) = delete;
+
+    SharedDeviceOwned &operator=(SharedDeviceOwned &&other) noexcept
+    {
+        if (this != &other)
         {
-            ReleaseFromDevice(m_device, m_object);
+            Reset(other.Detach());
         }
+        return *this;
     }
 
-    T *Get()
+    ~SharedDeviceOwned()
+    {
+        Reset();
+    }
+
+    explicit operator bool() const
+    {
+        return m_object != nullptr;
+    }
+
+    T *Get() const
     {
         return m_object;
     }
@@ -93,19 +406,28 @@ template <class T> struct DeviceOwned
         return object;
     }
 
+    void Reset(T *object = nullptr)
+    {
+        T *previous = m_object;
+        m_object = object;
+        if (previous)
+        {
+            ReleaseFromDevice(Context::Device(), previous);
+        }
+    }
+
   private:
-    SDL_GPUDevice *m_device;
     T *m_object = nullptr;
 };
 
-struct Haptic
+struct HapticEffect
 {
-    Haptic(SDL_Haptic *haptic, int effect) : m_haptic{haptic}, m_effect{effect} {};
-    Haptic(const Haptic &) = delete;
+    HapticEffect(SDL_Haptic *haptic, int effect) : m_haptic{haptic}, m_effect{effect} {};
+    HapticEffect(const HapticEffect &) = delete;
 
-    Haptic &operator=(const Haptic &) = delete;
+    HapticEffect &operator=(const HapticEffect &) = delete;
 
-    ~Haptic()
+    ~HapticEffect()
     {
         if (m_haptic)
         {
@@ -141,6 +463,37 @@ struct Properties
     SDL_PropertiesID m_properties;
 };
 
+struct AudioDevice
+{
+    AudioDevice(SDL_AudioDeviceID device) : m_device{device} {};
+    AudioDevice(const AudioDevice &) = delete;
+
+    AudioDevice &operator=(const AudioDevice &) = delete;
+
+    ~AudioDevice()
+    {
+        if (m_device)
+        {
+            SDL_CloseAudioDevice(m_device);
+        }
+    }
+
+    SDL_AudioDeviceID Get() const
+    {
+        return m_device;
+    }
+
+    SDL_AudioDeviceID Detach()
+    {
+        SDL_AudioDeviceID device = m_device;
+        m_device = 0;
+        return device;
+    }
+
+  private:
+    SDL_AudioDeviceID m_device;
+};
+
 struct CameraSurface
 {
     CameraSurface(SDL_Surface *surface, SDL_Camera *camera)
@@ -169,3 +522,53 @@ struct CameraSurface
     SDL_Surface *m_surface;
     SDL_Camera *m_camera;
 };
+
+template <int Capacity> struct EventBatch
+{
+    static_assert(Capacity > 0);
+
+    // Pumps the event loop, then moves up to Capacity pending events into the batch
+    // with a single SDL_PeepEvents call. A full batch means more events may be waiting.
+    Result<int> Drain(Location location = Location::current())
+    {
+        SDL_PumpEvents();
+        int count = SDL_PeepEvents(m_events, Capacity, SDL_GETEVENT, SDL_EVENT_FIRST,
+                                   SDL_EVENT_LAST);
+        if (count < 0) [[unlikely]]
+        {
+            m_count = 0;
+            return Fail<int>(location);
+        }
+        m_count = count;
+        return m_count;
+    }
+
+    int Size() const
+    {
+        return m_count;
+    }
+
+    bool IsFull() const
+    {
+        return m_count == Capacity;
+    }
+
+    const SDL_Event &operator[](int index) const
+    {
+        return m_events[index];
+    }
+
+    const SDL_Event *begin() const
+    {
+        return m_events;
+    }
+
+    const SDL_Event *end() const
+    {
+        return m_events + m_count;
+    }
+
+  private:
+    SDL_Event m_events[Capacity];
+    int m_count = 0;
+};
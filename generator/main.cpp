@@ -1,6 +1,7 @@
 ﻿#include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <set>
 #include <source_location>
 
@@ -16,6 +17,7 @@ namespace zlang
 {
 
 vector<string> structNames{};
+vector<pair<string, unsigned long long>> pixelFormats{};
 
 static std::vector<Function> ParseHeader(const fs::path &path,
                                          const std::vector<std::string> &includePaths)
@@ -64,6 +66,32 @@ static std::vector<Function> ParseHeader(const fs::path &path,
                 break;
             }
 
+            case CXCursor_EnumDecl: {
+                CXString currentDisplayName = clang_getCursorDisplayName(currentCursor);
+                string enumName{clang_getCString(currentDisplayName)};
+                clang_disposeString(currentDisplayName);
+
+                if (enumName == "SDL_PixelFormat")
+                {
+                    clang_visitChildren(
+                        currentCursor,
+                        [](CXCursor constantCursor, CXCursor parentCursor, CXClientData) {
+                            if (clang_getCursorKind(constantCursor) == CXCursor_EnumConstantDecl)
+                            {
+                                CXString constantName = clang_getCursorSpelling(constantCursor);
+                                pixelFormats.emplace_back(
+                                    clang_getCString(constantName),
+                                    clang_getEnumConstantDeclUnsignedValue(constantCursor));
+                                clang_disposeString(constantName);
+                            }
+                            return CXChildVisit_Continue;
+                        },
+                        nullptr);
+                }
+
+                break;
+            }
+
             case CXCursor_FunctionDecl: {
                 Function fn{currentCursor};
 
@@ -93,6 +121,43 @@ static std::vector<Function> ParseHeader(const fs::path &path,
     return functions;
 }
 
+static std::set<std::string> ReadFunctionNames(const fs::path &path)
+{
+    std::set<std::string> names{};
+
+    std::ifstream ifs{path};
+    std::string line;
+    while (std::getline(ifs, line))
+    {
+        size_t start = line.find_first_not_of(" \t\r");
+        if (start == std::string::npos || line[start] == '#')
+        {
+            continue;
+        }
+        size_t end = line.find_last_not_of(" \t\r");
+        names.insert(line.substr(start, end - start + 1));
+    }
+
+    return names;
+}
+
+static void ClassifyQueries(std::vector<Function> &functions,
+                            const std::set<std::string> &queryFunctions)
+{
+    for (Function &fn : functions)
+    {
+        if (queryFunctions.contains(fn.Name()))
+        {
+            fn.MarkAsQuery();
+        }
+        else if (fn.ReturnsBool() && !fn.DocumentsErrorReturn())
+        {
+            cout << "Unclassified bool function (no SDL_GetError() in \\returns): " << fn.Name()
+                 << "\n";
+        }
+    }
+}
+
 static void OutputFunctionArguments(std::ostream &out, const Function &fn, bool namesOnly)
 {
     bool haveOutputAtLeastOneFunctionArgument = false;
@@ -114,17 +179,67 @@ static void OutputFunctionArguments(std::ostream &out, const Function &fn, bool
     }
 }
 
+static bool IsReleaseFunction(const Function &fn)
+{
+    const std::string &name = fn.Name();
+    return name.find("Destroy") != std::string::npos ||
+           name.find("Release") != std::string::npos || name.find("Free") != std::string::npos ||
+           name.find("_free") != std::string::npos || name.starts_with("SDL_Close") ||
+           name.ends_with("_close");
+}
+
+// How well a function fits as the destructor of the type it takes, lower is better.
+// E.g. for SDL_Window, SDL_DestroyWindow (0) beats SDL_DestroyWindowSurface (2),
+// and SDL_CloseIO (1) is still a fit for SDL_IOStream.
+static int DestructorRank(const Function &fn, const std::string &pointedType)
+{
+    std::string typeString = pointedType.starts_with("SDL_") ? pointedType.substr(4) : pointedType;
+
+    for (const std::string prefix : {"SDL_Destroy", "SDL_Close"})
+    {
+        if (fn.Name() == prefix + typeString)
+        {
+            return 0;
+        }
+        if (fn.Name().starts_with(prefix) &&
+            typeString.starts_with(fn.Name().substr(prefix.size())))
+        {
+            return 1;
+        }
+    }
+
+    return 2;
+}
+
 static void OutputDestructors(std::ostream &out, const std::vector<Function> functions)
 {
-    std::set<std::string> alreadyGenerated{};
     std::set<std::string> functionsToIgnore{
         "SDL_MemoryBarrierReleaseFunction", "SDL_DestroyHapticEffect", "SDL_DestroyProperties",
-        "SDL_ReleaseCameraFrame",           "SDL_GL_DestroyContext",   "SDL_Metal_DestroyView"};
+        "SDL_ReleaseCameraFrame",           "SDL_GL_DestroyContext",   "SDL_Metal_DestroyView",
+        "SDL_CloseAsyncIO",                 "SDL_CloseAudioDevice",    "SDL_iconv_close",
+        "SDL_free",                         "SDL_aligned_free"};
 
+    // Pick the best fitting destructor for every type first,
+    // so it doesn't depend on which function happens to come first.
+    std::map<std::string, const Function *> destructors{};
     for (const Function &fn : functions)
     {
-        if (fn.Name().find("Destroy") != std::string::npos ||
-            fn.Name().find("Release") != std::string::npos)
+        if (IsReleaseFunction(fn) && !functionsToIgnore.contains(fn.Name()) &&
+            fn.NumberOfArguments() == 1 && fn.Arguments()[0].IsPointer())
+        {
+            std::string pointedType = fn.Arguments()[0].PointeeTypeString();
+            auto it = destructors.find(pointedType);
+            if (it == destructors.end() ||
+                DestructorRank(fn, pointedType) < DestructorRank(*it->second, pointedType))
+            {
+                destructors[pointedType] = &fn;
+            }
+        }
+    }
+
+    for (const Function &fn : functions)
+    {
+        if (IsReleaseFunction(fn))
         {
             bool handled = false;
 
@@ -133,10 +248,9 @@ static void OutputDestructors(std::ostream &out, const std::vector<Function> fun
                 const Argument &arg = fn.Arguments()[0];
                 std::string pointedType = arg.PointeeTypeString();
 
-                if (arg.IsPointer() && !alreadyGenerated.contains(pointedType))
+                if (arg.IsPointer() && destructors[pointedType] == &fn &&
+                    !functionsToIgnore.contains(fn.Name()))
                 {
-                    alreadyGenerated.insert(pointedType);
-
                     out << "template<>\n";
                     out << "inline void Destroy<" << pointedType << ">(" << arg.Declaration()
                         << ")\n";
@@ -152,7 +266,7 @@ static void OutputDestructors(std::ostream &out, const std::vector<Function> fun
 
                     handled = true;
                 }
-                else if (alreadyGenerated.contains(pointedType))
+                else if (arg.IsPointer())
                 {
                     handled = true;
                 }
@@ -185,6 +299,95 @@ static void OutputDestructors(std::ostream &out, const std::vector<Function> fun
     }
 }
 
+static void OutputUnlockers(std::ostream &out, const std::vector<Function> functions)
+{
+    for (const Function &fn : functions)
+    {
+        // Unlock<> is keyed by the pointee type, so a typedef of a plain type like SDL_SpinLock
+        // would specialize it for every int. Those get their own deleter in the prologue.
+        if (fn.Name().starts_with("SDL_Unlock") && fn.NumberOfArguments() == 1 &&
+            fn.Arguments()[0].IsPointer() && fn.Arguments()[0].PointsToRecord())
+        {
+            const Argument &arg = fn.Arguments()[0];
+            std::string pointedType = arg.PointeeTypeString();
+
+            out << "template<>\n";
+            out << "inline void Unlock<" << pointedType << ">(" << arg.Declaration() << ")\n";
+            out << "{\n";
+            out << "    " << fn.Name() << "(" << arg.Name() << ");\n";
+            out << "}\n\n";
+
+            std::string typeString =
+                pointedType.starts_with("SDL_") ? pointedType.substr(4) : pointedType;
+            std::string unlockerName = "Unlocker<" + pointedType + ">";
+            out << "using Locked" << typeString << " = std::unique_ptr<" << pointedType << ", "
+                << unlockerName << ">;\n\n";
+        }
+    }
+}
+
+// Specializes PixelFormatTraits for the packed pixel formats of up to 8 bits per channel,
+// with the masks decoded from the format like SDL_GetMasksForPixelFormat does.
+static void OutputPixelFormatTraits(std::ostream &out)
+{
+    // SDL_PIXELTYPE_PACKED8 to SDL_PIXELTYPE_PACKED32.
+    constexpr unsigned long long firstPackedType = 4;
+    constexpr unsigned long long lastPackedType = 6;
+
+    // The channels of each SDL_PackedOrder, from the most significant bits on.
+    const string orders[] = {"", "XRGB", "RGBX", "ARGB", "RGBA", "XBGR", "BGRX", "ABGR", "BGRA"};
+
+    // The bits of the channels of each SDL_PackedLayout up to SDL_PACKEDLAYOUT_8888, from the
+    // most significant bits on. The 10 bit layouts that follow are left out.
+    const int layouts[][4] = {{0, 0, 0, 0}, {0, 3, 3, 2}, {4, 4, 4, 4}, {1, 5, 5, 5},
+                              {5, 5, 5, 1}, {0, 5, 6, 5}, {8, 8, 8, 8}};
+
+    std::set<unsigned long long> values{};
+    for (const auto &[name, value] : pixelFormats)
+    {
+        unsigned long long type = (value >> 24) & 0x0F;
+        unsigned long long order = (value >> 20) & 0x0F;
+        unsigned long long layout = (value >> 16) & 0x0F;
+
+        // Aliases like SDL_PIXELFORMAT_RGBA32 depend on the byte order, so only the formats
+        // they alias get specialized.
+        if ((value >> 28) != 1 || type < firstPackedType || type > lastPackedType ||
+            order == 0 || order >= size(orders) || layout == 0 || layout >= size(layouts) ||
+            !values.insert(value).second)
+        {
+            continue;
+        }
+
+        unsigned long long masks[4] = {}; // R, G, B, A
+        int shift = 0;
+        for (int bits : layouts[layout])
+        {
+            shift += bits;
+        }
+        for (int i = 0; i < 4; ++i)
+        {
+            int bits = layouts[layout][i];
+            shift -= bits;
+            size_t channel = string{"RGBA"}.find(orders[order][i]);
+            if (channel != string::npos)
+            {
+                masks[channel] = ((1ull << bits) - 1) << shift;
+            }
+        }
+
+        out << "template<>\n";
+        out << "struct PixelFormatTraits<" << name << "> : PackedPixelFormatTraits<"
+            << ((value >> 8) & 0xFF) << ", " << (value & 0xFF);
+        for (unsigned long long mask : masks)
+        {
+            out << ", 0x" << hex << mask << dec << "u";
+        }
+        out << ">\n";
+        out << "{\n";
+        out << "};\n\n";
+    }
+}
+
 static void OutputFunctions(std::ostream &out, const std::vector<Function> functions)
 {
     std::set<std::string> functionsToSkip{"SDL_size_mul_check_overflow_builtin",
@@ -194,8 +397,13 @@ static void OutputFunctions(std::ostream &out, const std::vector<Function> funct
     {
         if (fn.HasSDLPrefix() && !functionsToSkip.contains(fn.Name()))
         {
-            std::string returnType = fn.ReturnsBool() ? "void" : fn.ReturnTypeString();
-            std::string space = fn.ReturnsPointer() ? "" : " ";
+            // Checked functions return a Result<>, which depends on SDL_HPP_ERROR_POLICY.
+            std::string returnType = fn.ReturnTypeString();
+            if (!fn.IsUnchecked())
+            {
+                returnType = fn.ReturnsBool() ? "Result<void>" : "Result<" + returnType + ">";
+            }
+            std::string space = returnType.ends_with('*') ? "" : " ";
 
             out << "inline " << returnType << space << fn.NamespacedName() << "(";
             OutputFunctionArguments(out, fn, false);
@@ -207,7 +415,7 @@ static void OutputFunctions(std::ostream &out, const std::vector<Function> funct
                     out << ", ";
                 }
 
-                out << "std::source_location location = std::source_location::current()";
+                out << "Location location = Location::current()";
             }
 
             out << ")\n";
@@ -231,16 +439,18 @@ static void OutputFunctions(std::ostream &out, const std::vector<Function> funct
             {
                 out << "    if (!" << fn.Name() << "(";
                 OutputFunctionArguments(out, fn, true);
-                out << "))\n" << "    {\n";
-                out << "        SDLThrow(location);\n";
+                out << ")) [[unlikely]]\n" << "    {\n";
+                out << "        return Fail<void>(location);\n";
                 out << "    }\n";
+                out << "    return Success();\n";
             }
             else if (fn.ReturnsPointer())
             {
                 out << "    " << fn.ReturnTypeString() << "result = " << fn.Name() << "(";
                 OutputFunctionArguments(out, fn, true);
                 out << ");\n";
-                out << "    if (!result)\n    {\n        SDLThrow(location);\n    }\n";
+                out << "    if (!result) [[unlikely]]\n    {\n        return Fail<" << fn.ReturnTypeString()
+                    << ">(location);\n    }\n";
                 out << "    return result;\n";
             }
 
@@ -263,6 +473,7 @@ int main()
     auto outputFile = outputDirectory / "SDL.hpp";
     auto prologueFile = locationPath / "Prologue.h";
     auto epilogueFile = locationPath / "Epilogue.h";
+    auto queryFunctionsFile = locationPath / "QueryFunctions.txt";
 
     std::ofstream out{outputFile};
 
@@ -283,7 +494,10 @@ int main()
     auto sdlIncludeFile = sdlHeaderDirectory / "SDL.h";
 
     std::vector<Function> functions = ParseHeader(sdlIncludeFile, {includePath1});
+    ClassifyQueries(functions, ReadFunctionNames(queryFunctionsFile));
     OutputDestructors(out, functions);
+    OutputUnlockers(out, functions);
+    OutputPixelFormatTraits(out);
     OutputFunctions(out, functions);
 
     std::ifstream ifsEpilogue{epilogueFile};
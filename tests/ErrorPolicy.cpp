@@ -0,0 +1,83 @@
+// Uses the results of checked wrappers the way SDL_HPP_ERROR_POLICY is meant to be used, so a
+// policy whose return types don't allow that fails to compile. Returns non-zero on failure.
+
+#include "SDL.hpp"
+
+#include <type_traits>
+
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_CALLBACK
+static int numErrors = 0;
+
+static void CountError(const sdl::Error &)
+{
+    ++numErrors;
+}
+#endif
+
+int main()
+{
+#if SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_THROW
+    static_assert(std::is_void_v<decltype(sdl::Init(0))>);
+    sdl::Init(0);
+    try
+    {
+        sdl::LockSurface(nullptr);
+        return 1;
+    }
+    catch (const std::runtime_error &)
+    {
+    }
+    try
+    {
+        sdl::CreateSurface(-1, -1, SDL_PIXELFORMAT_ARGB8888);
+        return 1;
+    }
+    catch (const std::runtime_error &)
+    {
+    }
+#elif SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_EXPECTED
+    if (!sdl::Init(0))
+    {
+        return 1;
+    }
+    sdl::Result<void> locked = sdl::LockSurface(nullptr);
+    if (locked || locked.error().location.line() == 0)
+    {
+        return 1;
+    }
+    if (sdl::CreateSurface(-1, -1, SDL_PIXELFORMAT_ARGB8888))
+    {
+        return 1;
+    }
+#elif SDL_HPP_ERROR_POLICY == SDL_HPP_ERROR_CALLBACK
+    sdl::SetErrorCallback(CountError);
+    if (!sdl::Init(0))
+    {
+        return 1;
+    }
+    if (sdl::LockSurface(nullptr))
+    {
+        return 1;
+    }
+    if (sdl::CreateSurface(-1, -1, SDL_PIXELFORMAT_ARGB8888))
+    {
+        return 1;
+    }
+    sdl::WorkerPool pool{1};
+    sdl::GPUCommandRecorder recorder{nullptr, pool};
+    if (recorder.AddPass(nullptr, nullptr, {1}) != sdl::GPUCommandRecorder::InvalidPass)
+    {
+        return 1;
+    }
+    if (numErrors != 3)
+    {
+        return 1;
+    }
+#else
+    // Failing would abort, so only the succeeding path runs.
+    static_assert(std::is_void_v<decltype(sdl::Init(0))>);
+    sdl::Init(0);
+#endif
+    SDL_Quit();
+    return 0;
+}
@@ -0,0 +1,138 @@
+// Checks every PixelKernels variant the CPU supports byte for byte against SDL_ConvertPixels and
+// SDL_BlitSurface, for every width up to past two rounds of the widest SIMD loop, so that each
+// tail length is covered. Rows start one pixel in, so the kernels also see unaligned pointers,
+// and pixels past the end of a row must stay untouched. Returns non-zero on failure.
+
+#include "SDL.hpp"
+
+#include <cstring>
+#include <vector>
+
+constexpr int MaxWidth = 2 * 16 + 16 + 3;
+constexpr int Height = 3;
+constexpr int Offset = 1;
+
+static Uint32 randomState = 1;
+
+static Uint8 Random()
+{
+    randomState = randomState * 1664525 + 1013904223;
+    return Uint8(randomState >> 24);
+}
+
+static Uint32 PixelAt(const Uint8 *pixels, size_t index)
+{
+    Uint32 pixel;
+    std::memcpy(&pixel, pixels + index * 4, sizeof(pixel));
+    return pixel;
+}
+
+static bool CheckConvert(const sdl::PixelKernels &kernels, SDL_PixelFormat from,
+                         SDL_PixelFormat to)
+{
+    int srcBytesPerPixel = SDL_BYTESPERPIXEL(from);
+    int srcPitch = (Offset + MaxWidth) * srcBytesPerPixel;
+    int dstPitch = (Offset + MaxWidth) * 4;
+    std::vector<Uint8> source(size_t(srcPitch) * Height);
+    for (Uint8 &byte : source)
+    {
+        byte = Random();
+    }
+    const Uint8 *src = source.data() + Offset * srcBytesPerPixel;
+
+    // The padding byte of XRGB8888 and XBGR8888 isn't part of the pixel.
+    bool padded = to == SDL_PIXELFORMAT_XRGB8888 || to == SDL_PIXELFORMAT_XBGR8888;
+    Uint32 mask = padded ? 0x00FFFFFF : 0xFFFFFFFF;
+    for (int width = 1; width <= MaxWidth; ++width)
+    {
+        std::vector<Uint8> expected(size_t(dstPitch) * Height);
+        std::vector<Uint8> actual(expected.size());
+        if (!SDL_ConvertPixels(width, Height, from, src, srcPitch, to,
+                               expected.data() + Offset * 4, dstPitch) ||
+            !kernels.Convert(width, Height, from, src, srcPitch, to, actual.data() + Offset * 4,
+                             dstPitch))
+        {
+            SDL_Log("Converting failed: %s", SDL_GetError());
+            return false;
+        }
+        for (size_t i = 0; i < expected.size() / 4; ++i)
+        {
+            if ((PixelAt(expected.data(), i) ^ PixelAt(actual.data(), i)) & mask)
+            {
+                SDL_Log("%s kernels convert %s to %s differently at width %d", kernels.name,
+                        SDL_GetPixelFormatName(from), SDL_GetPixelFormatName(to), width);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool CheckBlend(const sdl::PixelKernels &kernels, SDL_PixelFormat format)
+{
+    sdl::Surface src{sdl::CreateSurface(Offset + MaxWidth, Height, format)};
+    sdl::Surface expected{sdl::CreateSurface(Offset + MaxWidth, Height, format)};
+    sdl::Surface actual{sdl::CreateSurface(Offset + MaxWidth, Height, format)};
+    SDL_SetSurfaceBlendMode(src.get(), SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    // Premultiplied, so no color channel exceeds alpha. Alpha is the top byte in both formats.
+    for (int y = 0; y < Height; ++y)
+    {
+        Uint32 *row = reinterpret_cast<Uint32 *>(static_cast<Uint8 *>(src->pixels) +
+                                                 size_t(y) * src->pitch);
+        for (int x = 0; x < src->w; ++x)
+        {
+            Uint32 alpha = Random();
+            row[x] = alpha << 24;
+            for (int shift = 0; shift < 24; shift += 8)
+            {
+                row[x] |= (Random() % (alpha + 1)) << shift;
+            }
+        }
+    }
+
+    size_t size = size_t(expected->pitch) * Height;
+    for (int width = 1; width <= MaxWidth; ++width)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            static_cast<Uint8 *>(expected->pixels)[i] = Random();
+        }
+        std::memcpy(actual->pixels, expected->pixels, size);
+
+        SDL_Rect rect{Offset, 0, width, Height};
+        SDL_Rect dstRect = rect;
+        if (!SDL_BlitSurface(src.get(), &rect, expected.get(), &dstRect))
+        {
+            SDL_Log("Blitting failed: %s", SDL_GetError());
+            return false;
+        }
+        kernels.Blend(src.get(), rect, actual.get(), rect);
+        if (std::memcmp(expected->pixels, actual->pixels, size) != 0)
+        {
+            SDL_Log("%s kernels blend %s differently at width %d", kernels.name,
+                    SDL_GetPixelFormatName(format), width);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    bool ok = true;
+    for (const sdl::PixelKernels &kernels : sdl::PixelKernels::Variants())
+    {
+        SDL_Log("Checking the %s kernels", kernels.name);
+        ok = CheckConvert(kernels, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888) && ok;
+        ok = CheckConvert(kernels, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888) && ok;
+        ok = CheckConvert(kernels, SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888) && ok;
+        ok = CheckConvert(kernels, SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888) && ok;
+        ok = CheckConvert(kernels, SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_XRGB8888) && ok;
+        ok = CheckConvert(kernels, SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888) && ok;
+        ok = CheckConvert(kernels, SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_XBGR8888) && ok;
+        ok = CheckConvert(kernels, SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_ABGR8888) && ok;
+        ok = CheckBlend(kernels, SDL_PIXELFORMAT_ARGB8888) && ok;
+        ok = CheckBlend(kernels, SDL_PIXELFORMAT_ABGR8888) && ok;
+    }
+    return ok ? 0 : 1;
+}